@@ -53,6 +53,14 @@ std::string getHomeDir()
 
 std::string CRS_PATH = getHomeDir() + "/.bb-crs";
 
+// Block sizes of the structured trace of ClientIVC as serialized by ExecutionTraceUsageTracker, E2E_FULL_TEST if empty
+std::string TRACE_STRUCTURE_PATH;
+// File to which the structured trace proposed for the circuits of a ClientIVC is written, if not empty
+std::string PROPOSED_TRACE_STRUCTURE_PATH;
+// Strategies of the in-circuit scalar multiplications of the ACIR programs, see acir_format::AcirFormat
+size_t MSM_TABLE_BITS = 0;
+bool ECDSA_R1_WINDOWED_BATCH_MUL = false;
+
 const std::filesystem::path current_path = std::filesystem::current_path();
 const auto current_dir = current_path.filename().string();
 
@@ -97,10 +105,21 @@ acir_format::WitnessVector get_witness(std::string const& witness_path)
     return acir_format::witness_buf_to_witness_data(witness_data);
 }
 
+/**
+ * @brief Apply the scalar multiplication strategies given on the command line, which are not part of the bytecode
+ */
+void set_scalar_mul_strategies(acir_format::AcirFormat& constraint_system)
+{
+    constraint_system.msm_table_bits = MSM_TABLE_BITS;
+    constraint_system.ecdsa_r1_windowed_batch_mul = ECDSA_R1_WINDOWED_BATCH_MUL;
+}
+
 acir_format::AcirFormat get_constraint_system(std::string const& bytecode_path, bool honk_recursion)
 {
     auto bytecode = get_bytecode(bytecode_path);
-    return acir_format::circuit_buf_to_acir_format(bytecode, honk_recursion);
+    auto constraint_system = acir_format::circuit_buf_to_acir_format(bytecode, honk_recursion);
+    set_scalar_mul_strategies(constraint_system);
+    return constraint_system;
 }
 
 acir_format::WitnessVectorStack get_witness_stack(std::string const& witness_path)
@@ -112,7 +131,22 @@ acir_format::WitnessVectorStack get_witness_stack(std::string const& witness_pat
 std::vector<acir_format::AcirFormat> get_constraint_systems(std::string const& bytecode_path, bool honk_recursion)
 {
     auto bytecode = get_bytecode(bytecode_path);
-    return acir_format::program_buf_to_acir_format(bytecode, honk_recursion);
+    auto constraint_systems = acir_format::program_buf_to_acir_format(bytecode, honk_recursion);
+    for (auto& constraint_system : constraint_systems) {
+        set_scalar_mul_strategies(constraint_system);
+    }
+    return constraint_systems;
+}
+
+acir_format::AcirProgramStack get_acir_program_stack(std::string const& bytecode_path,
+                                                     std::string const& witness_path,
+                                                     bool honk_recursion)
+{
+    auto program_stack = acir_format::get_acir_program_stack(bytecode_path, witness_path, honk_recursion);
+    for (auto& constraint_system : program_stack.constraint_systems) {
+        set_scalar_mul_strategies(constraint_system);
+    }
+    return program_stack;
 }
 
 std::string to_json(std::vector<bb::fr>& data)
@@ -244,7 +278,7 @@ bool proveAndVerifyHonkProgram(const std::string& bytecodePath, const bool recur
     if constexpr (IsAnyOf<Flavor, UltraFlavor>) {
         honk_recursion = true;
     }
-    auto program_stack = acir_format::get_acir_program_stack(bytecodePath, witnessPath, honk_recursion);
+    auto program_stack = get_acir_program_stack(bytecodePath, witnessPath, honk_recursion);
     while (!program_stack.empty()) {
         auto stack_item = program_stack.back();
         if (!proveAndVerifyHonkAcirFormat<Flavor>(stack_item.constraints, recursive, stack_item.witness)) {
@@ -323,6 +357,35 @@ std::vector<uint8_t> decompressedBuffer(uint8_t* bytes, size_t size)
     return content;
 }
 
+/**
+ * @brief Set the structured trace of a ClientIVC, loading its block sizes from TRACE_STRUCTURE_PATH if given
+ */
+void set_trace_structure(ClientIVC& ivc)
+{
+    if (TRACE_STRUCTURE_PATH.empty()) {
+        ivc.trace_structure = TraceStructure::E2E_FULL_TEST;
+        return;
+    }
+    auto serialized = read_file(TRACE_STRUCTURE_PATH);
+    ivc.trace_structure = ExecutionTraceUsageTracker::to_trace_settings(
+        ExecutionTraceUsageTracker::deserialize_block_sizes(std::string(serialized.begin(), serialized.end())));
+}
+
+/**
+ * @brief Write the structured trace block sizes proposed for the circuits accumulated by a ClientIVC to
+ * PROPOSED_TRACE_STRUCTURE_PATH if given, in the format read by --trace_structure
+ */
+void write_proposed_trace_structure(const ClientIVC& ivc)
+{
+    if (PROPOSED_TRACE_STRUCTURE_PATH.empty()) {
+        return;
+    }
+    const std::string serialized =
+        ExecutionTraceUsageTracker::serialize_block_sizes(ivc.trace_usage_tracker.propose_block_sizes());
+    write_file(PROPOSED_TRACE_STRUCTURE_PATH, std::vector<uint8_t>(serialized.begin(), serialized.end()));
+    vinfo("proposed structured trace written to ", PROPOSED_TRACE_STRUCTURE_PATH);
+}
+
 void client_ivc_prove_output_all_msgpack(const std::string& bytecodePath,
                                          const std::string& witnessPath,
                                          const std::string& outputDir)
@@ -351,6 +414,7 @@ void client_ivc_prove_output_all_msgpack(const std::string& bytecodePath,
             decompressedBuffer(reinterpret_cast<uint8_t*>(wit.data()), wit.size()); // NOLINT
 
         AcirFormat constraints = circuit_buf_to_acir_format(constraint_buf, /*honk_recursion=*/false);
+        set_scalar_mul_strategies(constraints);
         WitnessVector witness = witness_buf_to_witness_data(witness_buf);
 
         folding_stack.push_back(Program{ constraints, witness });
@@ -359,7 +423,7 @@ void client_ivc_prove_output_all_msgpack(const std::string& bytecodePath,
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/1101): remove use of auto_verify_mode
     ClientIVC ivc;
     ivc.auto_verify_mode = true;
-    ivc.trace_structure = TraceStructure::E2E_FULL_TEST;
+    set_trace_structure(ivc);
 
     // Accumulate the entire program stack into the IVC
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/1116): remove manual setting of is_kernel once databus
@@ -378,6 +442,8 @@ void client_ivc_prove_output_all_msgpack(const std::string& bytecodePath,
         ivc.accumulate(circuit);
     }
 
+    write_proposed_trace_structure(ivc);
+
     // Write the proof and verification keys into the working directory in  'binary' format (in practice it seems this
     // directory is passed by bb.js)
     std::string vkPath = outputDir + "/mega_vk"; // the vk of the last circuit in the stack
@@ -450,7 +516,7 @@ bool foldAndVerifyProgram(const std::string& bytecodePath, const std::string& wi
     ivc.auto_verify_mode = true;
     ivc.trace_structure = TraceStructure::SMALL_TEST;
 
-    auto program_stack = acir_format::get_acir_program_stack(
+    auto program_stack = get_acir_program_stack(
         bytecodePath, witnessPath, false); // TODO(https://github.com/AztecProtocol/barretenberg/issues/1013): this
                                            // assumes that folding is never done with ultrahonk.
 
@@ -501,9 +567,9 @@ void client_ivc_prove_output_all(const std::string& bytecodePath,
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/1101): remove use of auto_verify_mode
     ClientIVC ivc;
     ivc.auto_verify_mode = true;
-    ivc.trace_structure = TraceStructure::E2E_FULL_TEST;
+    set_trace_structure(ivc);
 
-    auto program_stack = acir_format::get_acir_program_stack(
+    auto program_stack = get_acir_program_stack(
         bytecodePath, witnessPath, false); // TODO(https://github.com/AztecProtocol/barretenberg/issues/1013): this
                                            // assumes that folding is never done with ultrahonk.
 
@@ -523,6 +589,8 @@ void client_ivc_prove_output_all(const std::string& bytecodePath,
         program_stack.pop_back();
     }
 
+    write_proposed_trace_structure(ivc);
+
     // Write the proof and verification keys into the working directory in  'binary' format (in practice it seems this
     // directory is passed by bb.js)
     std::string vkPath = outputPath + "/mega_vk"; // the vk of the last circuit in the stack
@@ -686,8 +754,14 @@ void gateCount(const std::string& bytecodePath, bool recursive, bool honk_recurs
     auto constraint_systems = get_constraint_systems(bytecodePath, honk_recursion);
     size_t i = 0;
     for (auto constraint_system : constraint_systems) {
-        auto builder = acir_format::create_circuit<Builder>(
-            constraint_system, recursive, 0, {}, honk_recursion, std::make_shared<bb::ECCOpQueue>(), true);
+        auto builder = acir_format::create_circuit<Builder>(constraint_system,
+                                                            recursive,
+                                                            0,
+                                                            {},
+                                                            honk_recursion,
+                                                            std::make_shared<bb::ECCOpQueue>(),
+                                                            /*collect_gates_per_opcode=*/true,
+                                                            /*count_only=*/true);
         builder.finalize_circuit(/*ensure_nonzero=*/true);
         size_t circuit_size = builder.num_gates;
         vinfo("Calculated circuit size in gateCount: ", circuit_size);
@@ -1431,6 +1505,11 @@ int main(int argc, char* argv[])
         bool honk_recursion = flag_present(args, "-h");
         bool recursive = flag_present(args, "--recursive"); // Not every flavor handles it.
         CRS_PATH = get_option(args, "-c", CRS_PATH);
+        TRACE_STRUCTURE_PATH = get_option(args, "--trace_structure", TRACE_STRUCTURE_PATH);
+        PROPOSED_TRACE_STRUCTURE_PATH =
+            get_option(args, "--output_proposed_trace_structure", PROPOSED_TRACE_STRUCTURE_PATH);
+        MSM_TABLE_BITS = std::stoul(get_option(args, "--msm_table_bits", std::to_string(MSM_TABLE_BITS)));
+        ECDSA_R1_WINDOWED_BATCH_MUL = flag_present(args, "--ecdsa_r1_windowed_batch_mul");
 
         // Skip CRS initialization for any command which doesn't require the CRS.
         if (command == "--version") {
@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/vm/avm/generated/circuit_builder.hpp"
+#include "barretenberg/vm/avm/trace/common.hpp"
+#include "barretenberg/vm/avm/trace/trace.hpp"
+#include "barretenberg/vm/constants.hpp"
+
+using namespace benchmark;
+using namespace bb::avm_trace;
+
+namespace {
+
+constexpr uint32_t INITIAL_GAS = 1U << 30;
+
+/**
+ * @brief Generates a trace performing num_additions field additions on top of the full precomputed tables.
+ */
+std::vector<Row> generate_addition_trace(size_t num_additions)
+{
+    VmPublicInputs public_inputs;
+    std::array<FF, KERNEL_INPUTS_LENGTH> kernel_inputs{};
+    kernel_inputs.at(DA_START_GAS_KERNEL_INPUTS_COL_OFFSET) = INITIAL_GAS;
+    kernel_inputs.at(L2_START_GAS_KERNEL_INPUTS_COL_OFFSET) = INITIAL_GAS;
+    std::get<0>(public_inputs) = kernel_inputs;
+
+    AvmTraceBuilder trace_builder(public_inputs);
+    trace_builder.op_set(0, 1, 0, AvmMemoryTag::FF);
+    trace_builder.op_set(0, 1, 1, AvmMemoryTag::FF);
+    for (size_t i = 0; i < num_additions; i++) {
+        trace_builder.op_add(0, 0, 1, 1);
+    }
+    trace_builder.op_return(0, 0, 0);
+    return trace_builder.finalize();
+}
+
+void check_circuit(State& state, bool exit_on_first_failure, bool mutate) noexcept
+{
+    auto trace = generate_addition_trace(static_cast<size_t>(state.range(0)));
+    if (mutate) {
+        // Break the first addition so that the relation checks fail.
+        for (auto& row : trace) {
+            if (row.alu_op_add == FF(1)) {
+                row.alu_ic += FF(1);
+                break;
+            }
+        }
+    }
+    state.counters["num_rows"] = static_cast<double>(trace.size());
+
+    bb::AvmCircuitBuilder circuit_builder;
+    circuit_builder.set_trace(std::move(trace));
+    for (auto _ : state) {
+        try {
+            circuit_builder.check_circuit(exit_on_first_failure);
+        } catch (const std::runtime_error&) {
+            // Failures are expected for mutated traces.
+        }
+    }
+}
+
+void check_circuit_valid(State& state) noexcept
+{
+    check_circuit(state, /*exit_on_first_failure=*/false, /*mutate=*/false);
+}
+
+void check_circuit_invalid(State& state) noexcept
+{
+    check_circuit(state, /*exit_on_first_failure=*/false, /*mutate=*/true);
+}
+
+void check_circuit_invalid_exit_on_first_failure(State& state) noexcept
+{
+    check_circuit(state, /*exit_on_first_failure=*/true, /*mutate=*/true);
+}
+
+} // namespace
+
+BENCHMARK(check_circuit_valid)->Unit(kMillisecond)->RangeMultiplier(4)->Range(1 << 10, 1 << 16);
+BENCHMARK(check_circuit_invalid)->Unit(kMillisecond)->RangeMultiplier(4)->Range(1 << 10, 1 << 16);
+BENCHMARK(check_circuit_invalid_exit_on_first_failure)
+    ->Unit(kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 16);
+
+BENCHMARK_MAIN();
@@ -7,6 +7,7 @@
  *      ff_addition:                            3.8
  *      ff_from_montgomery:                     19.1
  *      ff_invert:                              7001.3
+ *      ff_batch_invert:                        ~65 per element on a single thread
  *      ff_multiplication:                      21.3
  *      ff_reduce:                              5.1
  *      ff_sqr:                                 17.9
@@ -165,6 +166,29 @@ void ff_invert(State& state)
     }
 }
 
+/**
+ * @brief Evaluate field::batch_invert on 2^range(0) elements
+ *
+ * @details Inputs of at least 2 * BATCH_INVERT_MIN_CHUNK_SIZE elements are split across threads by batch_invert
+ * itself. The number of threads is bounded by the number of available cpus, so thread scaling is measured by running
+ * with different values of HARDWARE_CONCURRENCY.
+ * @param state
+ */
+void ff_batch_invert(State& state)
+{
+    numeric::RNG& engine = numeric::get_debug_randomness();
+    const size_t num_elements = 1 << static_cast<size_t>(state.range(0));
+    std::vector<Fr> elements(num_elements);
+    for (auto& element : elements) {
+        element = Fr::random_element(&engine);
+    }
+
+    for (auto _ : state) {
+        Fr::batch_invert(elements);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(num_elements));
+}
+
 /**
  * @brief Evaluate how much conversion to montgomery costs (in cache)
  *
@@ -487,6 +511,7 @@ BENCHMARK(ff_addition)->Unit(kMicrosecond)->DenseRange(12, 30);
 BENCHMARK(ff_multiplication)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_sqr)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_invert)->Unit(kMicrosecond)->DenseRange(12, 19);
+BENCHMARK(ff_batch_invert)->Unit(kMicrosecond)->DenseRange(12, 20, 2);
 BENCHMARK(ff_to_montgomery)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_from_montgomery)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_reduce)->Unit(kMicrosecond)->DenseRange(12, 29);
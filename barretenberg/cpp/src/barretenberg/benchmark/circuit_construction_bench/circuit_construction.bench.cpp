@@ -1,9 +1,14 @@
 
 #include <benchmark/benchmark.h>
 
+#include "barretenberg/common/op_count_google_bench.hpp"
+#include "barretenberg/common/peak_memory.hpp"
 #include "barretenberg/stdlib/primitives/biggroup/biggroup.hpp"
 #include "barretenberg/stdlib/primitives/curves/bn254.hpp"
+#include "barretenberg/stdlib/primitives/group/cycle_group.hpp"
+#include "barretenberg/stdlib_circuit_builders/mock_circuits.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+#include "barretenberg/ultra_honk/decider_proving_key.hpp"
 
 using namespace benchmark;
 using namespace bb;
@@ -40,7 +45,147 @@ void biggroup_construction_bench(State& state)
         state.PauseTiming();
     }
 }
+
+/**
+ * @brief Construct a cycle_group batch_mul of n witness points and scalars with a window of w bits
+ * @details Reports the number of gates of the finalized circuit, to compare the window sizes for a given n
+ */
+void cycle_group_batch_mul_construction_bench(State& state)
+{
+    using cycle_group_ct = stdlib::cycle_group<UltraCircuitBuilder>;
+    const auto num_points = static_cast<size_t>(state.range(0));
+    const auto table_bits = static_cast<size_t>(state.range(1));
+    size_t num_gates = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        UltraCircuitBuilder builder;
+        std::vector<cycle_group_ct> points;
+        std::vector<cycle_group_ct::cycle_scalar> scalars;
+        for (size_t i = 0; i < num_points; ++i) {
+            const auto point = cycle_group_ct::AffineElement::random_element();
+            const auto scalar = cycle_group_ct::ScalarField::random_element();
+            points.emplace_back(cycle_group_ct::from_witness(&builder, point));
+            scalars.emplace_back(cycle_group_ct::cycle_scalar::from_witness(&builder, scalar));
+        }
+        state.ResumeTiming();
+        cycle_group_ct::batch_mul(points, scalars, {}, table_bits);
+        state.PauseTiming();
+        num_gates = builder.get_estimated_num_finalized_gates();
+        state.ResumeTiming();
+    }
+    state.counters["gates"] = static_cast<double>(num_gates);
+}
+
+/**
+ * @brief Construct many small circuits that each perform a few uint32 XOR lookups. The basic tables used are shared
+ * by all builders, so after the first circuit none of them are regenerated
+ */
+void lookup_circuits_construction_bench(State& state)
+{
+    const auto num_circuits = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        for (size_t i = 0; i < num_circuits; ++i) {
+            UltraCircuitBuilder builder;
+            MockCircuits::add_lookup_gates(builder, /*num_iterations=*/4);
+            DoNotOptimize(builder.lookup_tables.data());
+        }
+    }
+}
+
+/**
+ * @brief Finalize a circuit with n ROM arrays, n RAM arrays and range constraints of n different widths
+ * @details Only finalize_circuit() is timed, which sorts the records of every array and every range list
+ */
+void memory_and_range_finalization_bench(State& state)
+{
+    const auto num_arrays = static_cast<size_t>(state.range(0));
+    const size_t array_size = 64;
+    const size_t num_accesses = 1024;
+    for (auto _ : state) {
+        state.PauseTiming();
+        UltraCircuitBuilder builder;
+        for (size_t j = 0; j < num_arrays; ++j) {
+            const size_t rom_id = builder.create_ROM_array(array_size);
+            const size_t ram_id = builder.create_RAM_array(array_size);
+            for (size_t i = 0; i < array_size; ++i) {
+                builder.set_ROM_element(rom_id, i, builder.add_variable(fr::random_element()));
+                builder.init_RAM_element(ram_id, i, builder.add_variable(fr::random_element()));
+            }
+            for (size_t i = 0; i < num_accesses; ++i) {
+                const uint32_t rom_value =
+                    builder.read_ROM_array(rom_id, builder.add_variable(engine.get_random_uint32() % array_size));
+                builder.write_RAM_array(
+                    ram_id, builder.add_variable(engine.get_random_uint32() % array_size), rom_value);
+            }
+            const uint64_t target_range = (1ULL << (j % 10 + 6)) - 1;
+            for (size_t i = 0; i < num_accesses; ++i) {
+                builder.create_new_range_constraint(builder.add_variable(engine.get_random_uint64() % target_range),
+                                                    target_range);
+            }
+        }
+        state.ResumeTiming();
+        builder.finalize_circuit(/*ensure_nonzero=*/false);
+    }
+}
+
+/**
+ * @brief Construct a Mega circuit of 2^n gates (arithmetic, lookup and ecc op gates) and its proving key
+ * @details Reports the peak memory of the builder. The timed proving key construction is dominated by the population
+ * of the execution trace, reported separately as "trace populate" when op counts are enabled.
+ */
+void mega_trace_construction_bench(State& state)
+{
+    bb::srs::init_crs_factory("../srs_db/ignition");
+    const auto log2_num_gates = static_cast<size_t>(state.range(0));
+    size_t peak_builder_memory = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        reset_peak_rss();
+        const size_t memory_before_builder = get_current_rss_bytes();
+        MegaCircuitBuilder builder;
+        MockCircuits::construct_goblin_ecc_op_circuit(builder);
+        MockCircuits::add_lookup_gates(builder, /*num_iterations=*/1 << (log2_num_gates - 6));
+        MockCircuits::construct_arithmetic_circuit(builder, log2_num_gates);
+        peak_builder_memory = std::max(peak_builder_memory, get_peak_rss_bytes() - memory_before_builder);
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        state.ResumeTiming();
+
+        DeciderProvingKey_<MegaFlavor> proving_key(builder);
+        DoNotOptimize(proving_key.proving_key.circuit_size);
+    }
+    state.counters["peak_builder_MiB"] = static_cast<double>(peak_builder_memory) / static_cast<double>(1 << 20);
+}
+
+/**
+ * @brief Construct the proving key of an Ultra circuit of 2^n gates (arithmetic and lookup gates)
+ * @details When op counts are enabled, the phases of the construction are reported separately, in particular
+ * "populating wires and selectors", "constructing copy_cycles" and "compute_permutation_argument_polynomials" of the
+ * trace population.
+ */
+void ultra_proving_key_construction_bench(State& state)
+{
+    bb::srs::init_crs_factory("../srs_db/ignition");
+    const auto log2_num_gates = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        UltraCircuitBuilder builder;
+        MockCircuits::add_lookup_gates(builder, /*num_iterations=*/1 << (log2_num_gates - 6));
+        MockCircuits::construct_arithmetic_circuit(builder, log2_num_gates);
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        state.ResumeTiming();
+
+        DeciderProvingKey_<UltraFlavor> proving_key(builder);
+        DoNotOptimize(proving_key.proving_key.circuit_size);
+    }
+}
 } // namespace
 BENCHMARK(biggroup_construction_bench)->Unit(kMicrosecond)->DenseRange(2, 20);
+BENCHMARK(cycle_group_batch_mul_construction_bench)
+    ->Unit(kMillisecond)
+    ->ArgsProduct({ { 2, 4, 16, 64 }, { 2, 4, 8 } });
+BENCHMARK(lookup_circuits_construction_bench)->Unit(kMillisecond)->RangeMultiplier(4)->Range(1, 64);
+BENCHMARK(memory_and_range_finalization_bench)->Unit(kMillisecond)->RangeMultiplier(4)->Range(1, 64);
+BENCHMARK(mega_trace_construction_bench)->Unit(kMillisecond)->DenseRange(14, 20);
+BENCHMARK(ultra_proving_key_construction_bench)->Unit(kMillisecond)->DenseRange(14, 20);
 
 BENCHMARK_MAIN();
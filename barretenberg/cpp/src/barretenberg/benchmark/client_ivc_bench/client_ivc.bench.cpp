@@ -7,6 +7,7 @@
 
 #include "barretenberg/client_ivc/test_bench_shared.hpp"
 #include "barretenberg/common/op_count_google_bench.hpp"
+#include "barretenberg/common/peak_memory.hpp"
 
 using namespace benchmark;
 using namespace bb;
@@ -45,9 +46,143 @@ BENCHMARK_DEFINE_F(ClientIVCBench, Full)(benchmark::State& state)
     }
 }
 
+/**
+ * @brief Benchmark the prover work for the full PG-Goblin IVC protocol, constructing each circuit concurrently with
+ * the accumulation of the previous ones
+ * @details Reports the end-to-end wall time (circuit construction, accumulation and proving) to compare with Full.
+ */
+BENCHMARK_DEFINE_F(ClientIVCBench, FullPipelined)(benchmark::State& state)
+{
+    ClientIVC ivc;
+    ivc.trace_structure = TraceStructure::CLIENT_IVC_BENCH;
+    auto total_num_circuits = 2 * static_cast<size_t>(state.range(0)); // 2x accounts for kernel circuits
+    auto mocked_vkeys = mock_verification_keys(total_num_circuits);
+
+    for (auto _ : state) {
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        perform_ivc_accumulation_rounds_pipelined(total_num_circuits, ivc, mocked_vkeys, /* mock_vk */ true);
+        ivc.prove();
+    }
+}
+
+/**
+ * @brief Benchmark the accumulation rounds of the IVC with genuine precomputed verification keys, with (1) and without
+ * (0) reuse of the precomputed polynomials of previously seen circuits
+ */
+BENCHMARK_DEFINE_F(ClientIVCBench, AccumulateReusePrecomputedPolynomials)(benchmark::State& state)
+{
+    auto total_num_circuits = 2 * static_cast<size_t>(ClientIVCBench::NUM_ITERATIONS_MEDIUM_COMPLEXITY);
+    PrivateFunctionExecutionMockCircuitProducer circuit_producer;
+    auto precomputed_vkeys =
+        circuit_producer.precompute_verification_keys(total_num_circuits, TraceStructure::CLIENT_IVC_BENCH);
+
+    for (auto _ : state) {
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        ClientIVC ivc;
+        ivc.trace_structure = TraceStructure::CLIENT_IVC_BENCH;
+        ivc.reuse_precomputed_polynomials = state.range(0) != 0;
+        perform_ivc_accumulation_rounds(total_num_circuits, ivc, precomputed_vkeys);
+    }
+}
+
+/**
+ * @brief Benchmark the construction of the proving key of a mock app circuit, the first (large) app for 0 and a
+ * subsequent (small) one for 1
+ * @details Reports the peak memory of the construction, as well as the memory of the polynomials that were allocated
+ * and of those that were never written and so are still backed by shared zeroes (e.g. unused databus columns).
+ */
+BENCHMARK_DEFINE_F(ClientIVCBench, AppProvingKeyMemory)(benchmark::State& state)
+{
+    using DeciderProvingKey = ClientIVC::DeciderProvingKey;
+    using FF = ClientIVC::FF;
+
+    size_t peak_memory = 0;
+    size_t allocated_memory = 0;
+    size_t shared_zeroes_memory = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        PrivateFunctionExecutionMockCircuitProducer circuit_producer;
+        auto op_queue = std::make_shared<ECCOpQueue>();
+        // Skip the first app and kernel to get to a small app
+        for (size_t idx = 0; idx < 2 * static_cast<size_t>(state.range(0)); ++idx) {
+            circuit_producer.create_next_circuit_base_logic(op_queue);
+        }
+        auto circuit = circuit_producer.create_next_circuit_base_logic(op_queue);
+        reset_peak_rss();
+        const size_t memory_before_key = get_current_rss_bytes();
+        state.ResumeTiming();
+
+        DeciderProvingKey proving_key(circuit, TraceStructure::CLIENT_IVC_BENCH);
+
+        state.PauseTiming();
+        peak_memory = std::max(peak_memory, get_peak_rss_bytes() - memory_before_key);
+        allocated_memory = 0;
+        shared_zeroes_memory = 0;
+        for (auto& polynomial : proving_key.proving_key.polynomials.get_unshifted()) {
+            auto& memory = polynomial.is_copy_on_write() ? shared_zeroes_memory : allocated_memory;
+            memory += polynomial.size() * sizeof(FF);
+        }
+        // NOTE: google bench is very finnicky, must end in ResumeTiming() for correctness
+        state.ResumeTiming();
+    }
+    const auto to_mib = [](size_t bytes) { return static_cast<double>(bytes) / static_cast<double>(1 << 20); };
+    state.counters["peak_proving_key_MiB"] = to_mib(peak_memory);
+    state.counters["allocated_polynomials_MiB"] = to_mib(allocated_memory);
+    state.counters["shared_zero_polynomials_MiB"] = to_mib(shared_zeroes_memory);
+}
+
+/**
+ * @brief Benchmark the prover work for the full PG-Goblin IVC protocol with the hand tuned CLIENT_IVC_BENCH (0) and
+ * E2E_FULL_TEST (1) structured traces, and with the structure proposed from the block usage of the circuits (2)
+ * @details The proposed structure is derived from an IVC over the same circuits with CLIENT_IVC_BENCH. Structures that
+ * cannot accommodate the circuits are skipped. Reports the total size of the blocks of the structured trace.
+ */
+BENCHMARK_DEFINE_F(ClientIVCBench, ProposedStructure)(benchmark::State& state)
+{
+    auto total_num_circuits = 2 * static_cast<size_t>(ClientIVCBench::NUM_ITERATIONS_MEDIUM_COMPLEXITY);
+    auto mocked_vkeys = mock_verification_keys(total_num_circuits);
+
+    ClientIVC tuning_ivc;
+    tuning_ivc.trace_structure = TraceStructure::CLIENT_IVC_BENCH;
+    perform_ivc_accumulation_rounds(total_num_circuits, tuning_ivc, mocked_vkeys, /* mock_vk */ true);
+    const auto proposed_block_sizes = tuning_ivc.trace_usage_tracker.propose_block_sizes();
+    info("Proposed structured trace block sizes:\n",
+         ExecutionTraceUsageTracker::serialize_block_sizes(proposed_block_sizes));
+
+    const std::array<TraceSettings, 3> trace_structures{ TraceStructure::CLIENT_IVC_BENCH,
+                                                         TraceStructure::E2E_FULL_TEST,
+                                                         ExecutionTraceUsageTracker::to_trace_settings(
+                                                             proposed_block_sizes) };
+    const TraceSettings& trace_structure = trace_structures[static_cast<size_t>(state.range(0))];
+    MegaArithmetization::TraceBlocks blocks;
+    blocks.set_fixed_block_sizes(trace_structure);
+    for (auto [block, proposed_size] : zip_view(blocks.get(), proposed_block_sizes.get())) {
+        if (block.get_fixed_size() < proposed_size) {
+            state.SkipWithError("The structured trace cannot accommodate the circuits");
+            return;
+        }
+    }
+    state.counters["structured_trace_size"] = static_cast<double>(blocks.get_total_structured_size());
+
+    for (auto _ : state) {
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        ClientIVC ivc;
+        ivc.trace_structure = trace_structure;
+        perform_ivc_accumulation_rounds(total_num_circuits, ivc, mocked_vkeys, /* mock_vk */ true);
+        ivc.prove();
+    }
+}
+
 #define ARGS Arg(ClientIVCBench::NUM_ITERATIONS_MEDIUM_COMPLEXITY)->Arg(2)
 
 BENCHMARK_REGISTER_F(ClientIVCBench, Full)->Unit(benchmark::kMillisecond)->ARGS;
+BENCHMARK_REGISTER_F(ClientIVCBench, FullPipelined)->Unit(benchmark::kMillisecond)->UseRealTime()->ARGS;
+BENCHMARK_REGISTER_F(ClientIVCBench, AccumulateReusePrecomputedPolynomials)
+    ->Unit(benchmark::kMillisecond)
+    ->Arg(0)
+    ->Arg(1);
+BENCHMARK_REGISTER_F(ClientIVCBench, AppProvingKeyMemory)->Unit(benchmark::kMillisecond)->Arg(0)->Arg(1);
+BENCHMARK_REGISTER_F(ClientIVCBench, ProposedStructure)->Unit(benchmark::kMillisecond)->DenseRange(0, 2);
 
 } // namespace
 
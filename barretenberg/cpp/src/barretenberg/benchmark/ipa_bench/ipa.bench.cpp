@@ -1,4 +1,5 @@
 #include "barretenberg/commitment_schemes/ipa/ipa.hpp"
+#include "barretenberg/common/op_count_google_bench.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include <benchmark/benchmark.h>
 
@@ -44,6 +45,8 @@ void ipa_open(State& state) noexcept
         // initialize empty prover transcript
         auto prover_transcript = std::make_shared<NativeTranscript>();
         state.ResumeTiming();
+        // Report the time spent in the MSMs and the folds of all rounds
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
         // Compute proof
         IPA<Curve>::compute_opening_proof(ck, { poly, opening_pair }, prover_transcript);
         // Store info for verifier
@@ -66,7 +69,87 @@ void ipa_verify(State& state) noexcept
         ASSERT(result);
     }
 }
+
+/**
+ * @brief A single round of IPA::compute_opening_proof, folding vectors of size 2 * 2^range(0): the MSMs for L and R,
+ * then the fold of G, a and b. An opening of a polynomial of size 2ᵏ runs one round of every size 2ᵏ⁻¹, ..., 1
+ */
+void ipa_round(State& state) noexcept
+{
+    numeric::RNG& engine = numeric::get_debug_randomness();
+    const size_t round_size = 1UL << static_cast<size_t>(state.range(0));
+    std::span<Curve::AffineElement> srs_elements = ck->srs->get_monomial_points();
+    // The SRS is stored as a pippenger point table, see IPA::compute_opening_proof_internal
+    std::vector<Curve::AffineElement> G_table(srs_elements.begin(),
+                                              srs_elements.begin() + static_cast<std::ptrdiff_t>(round_size * 4));
+    std::vector<Curve::AffineElement> G_vec(round_size * 2);
+    Polynomial a_vec(round_size * 2);
+    std::vector<Fr> b_vec(round_size * 2);
+    for (size_t i = 0; i < round_size * 2; ++i) {
+        G_vec[i] = srs_elements[i * 2];
+        a_vec.at(i) = Fr::random_element(&engine);
+        b_vec[i] = Fr::random_element(&engine);
+    }
+    const Fr round_challenge = Fr::random_element(&engine);
+    const Fr round_challenge_inv = round_challenge.invert();
+    for (auto _ : state) {
+        auto L_i = scalar_multiplication::pippenger<Curve>({ 0, { &a_vec.at(0), round_size } },
+                                                           std::span{ G_table }.subspan(round_size * 2, round_size * 2),
+                                                           ck->pippenger_runtime_state,
+                                                           false);
+        auto R_i = scalar_multiplication::pippenger<Curve>({ 0, { &a_vec.at(round_size), round_size } },
+                                                           std::span{ G_table }.subspan(0, round_size * 2),
+                                                           ck->pippenger_runtime_state,
+                                                           false);
+        DoNotOptimize(L_i);
+        DoNotOptimize(R_i);
+        auto G_hi_by_inverse_challenge = Curve::Element::batch_mul_with_endomorphism(
+            std::span{ G_vec }.subspan(round_size, round_size), round_challenge_inv);
+        DoNotOptimize(IPA<Curve>::fold_round(G_vec,
+                                             G_hi_by_inverse_challenge,
+                                             G_table,
+                                             a_vec,
+                                             b_vec,
+                                             round_size,
+                                             round_challenge,
+                                             round_challenge_inv));
+    }
+}
+
+/**
+ * @brief The dominant step of each round of IPA::compute_opening_proof: folding the generator vector as
+ * G_lo + G_hi⋅u⁻¹ for a round of size 2^range(0) (an opening of a polynomial of size 2ᵏ runs
+ * one round of every size 2ᵏ⁻¹, ..., 1), with batch_mul_with_endomorphism chunks of at most range(1) points
+ */
+void ipa_round_fold_generators(State& state) noexcept
+{
+    numeric::RNG& engine = numeric::get_debug_randomness();
+    const size_t round_size = 1UL << static_cast<size_t>(state.range(0));
+    const auto max_chunk_size = static_cast<size_t>(state.range(1));
+    std::vector<Curve::AffineElement> G_vec(2 * round_size);
+    for (auto& point : G_vec) {
+        point = Curve::AffineElement(Curve::Element::random_element(&engine));
+    }
+    const auto round_challenge_inv = Fr::random_element(&engine);
+    std::vector<Curve::AffineElement> G_vec_new(round_size);
+    for (auto _ : state) {
+        auto G_hi_by_inverse_challenge = Curve::Element::batch_mul_with_endomorphism(
+            std::span{ G_vec.begin() + static_cast<std::ptrdiff_t>(round_size), G_vec.end() },
+            round_challenge_inv,
+            max_chunk_size);
+        Curve::Element::batch_affine_add(
+            std::span{ G_vec.begin(), G_vec.begin() + static_cast<std::ptrdiff_t>(round_size) },
+            G_hi_by_inverse_challenge,
+            G_vec_new);
+        DoNotOptimize(G_vec_new.data());
+    }
+}
 } // namespace
+BENCHMARK(ipa_round_fold_generators)
+    ->Unit(kMillisecond)
+    ->ArgsProduct({ benchmark::CreateDenseRange(0, MAX_POLYNOMIAL_DEGREE_LOG2 - 1, 1),
+                    { 1 << 10, Curve::Element::BATCH_MUL_MAX_CHUNK_SIZE } });
+BENCHMARK(ipa_round)->Unit(kMillisecond)->DenseRange(0, MAX_POLYNOMIAL_DEGREE_LOG2 - 1)->Setup(DoSetup);
 BENCHMARK(ipa_open)
     ->Unit(kMillisecond)
     ->DenseRange(MIN_POLYNOMIAL_DEGREE_LOG2, MAX_POLYNOMIAL_DEGREE_LOG2)
@@ -1,5 +1,6 @@
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
@@ -82,6 +83,28 @@ int pippenger()
     return 0;
 }
 
+int fixed_base_msm(const size_t window_bits)
+{
+    using Table = scalar_multiplication::FixedBaseTable<curve::BN254>;
+    std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
+    auto table = Table::load_or_compute(reference_string->get_monomial_points(), NUM_POINTS, window_bits, "../srs_db");
+    std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
+    std::chrono::milliseconds diff = std::chrono::duration_cast<std::chrono::milliseconds>(time_end - time_start);
+    std::cout << "window bits: " << window_bits << ", table memory: " << (table->get_memory_usage() >> 20)
+              << "MiB, table load/compute time: " << diff.count() << "ms" << std::endl;
+
+    for (size_t i = 0; i < 5; ++i) {
+        time_start = std::chrono::steady_clock::now();
+        g1::element result = table->msm(
+            PolynomialSpan<const curve::BN254::ScalarField>{ /*start_index*/ 0, { &scalars[0], /*size*/ NUM_POINTS } });
+        time_end = std::chrono::steady_clock::now();
+        auto run_time = std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start);
+        std::cout << "run time: " << run_time.count() << "us" << std::endl;
+        std::cout << result.x << std::endl;
+    }
+    return 0;
+}
+
 int coset_fft_split()
 {
     std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
@@ -117,5 +140,10 @@ int main()
     pippenger();
     pippenger();
     pippenger();
+    // Trade memory for MSM time with precomputed shifted copies of the SRS points
+    for (const size_t window_bits : { 12, 16, 20 }) {
+        std::cout << "executing fixed base msm" << std::endl;
+        fixed_base_msm(window_bits);
+    }
     return 0;
 }
@@ -1,5 +1,6 @@
 #include <benchmark/benchmark.h>
 
+#include "barretenberg/common/peak_memory.hpp"
 #include "barretenberg/protogalaxy/protogalaxy_prover.hpp"
 #include "barretenberg/stdlib_circuit_builders/mock_circuits.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
@@ -42,9 +43,21 @@ void _bench_round(::benchmark::State& state, void (*F)(ProtogalaxyProver_<Decide
     folding_prover.transcript = Flavor::Transcript::prover_init_empty();
     folding_prover.run_oink_prover_on_each_incomplete_key();
 
+    size_t peak_round_memory = 0;
     for (auto _ : state) {
+        state.PauseTiming();
+        reset_peak_rss();
+        const size_t memory_before_round = get_current_rss_bytes();
+        state.ResumeTiming();
+
         F(folding_prover);
+
+        state.PauseTiming();
+        peak_round_memory = std::max(peak_round_memory, get_peak_rss_bytes() - memory_before_round);
+        state.ResumeTiming();
     }
+    // Additional memory held at the peak of the round, on top of what was resident when it started
+    state.counters["peak_round_MiB"] = static_cast<double>(peak_round_memory) / static_cast<double>(1 << 20);
 }
 
 void bench_round_mega(::benchmark::State& state, void (*F)(ProtogalaxyProver_<DeciderProvingKeys_<MegaFlavor, 2>>&))
@@ -1,5 +1,10 @@
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/eccvm/eccvm_flavor.hpp"
 #include "barretenberg/polynomials/univariate.hpp"
+#include "barretenberg/stdlib_circuit_builders/mega_flavor.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
+#include "barretenberg/sumcheck/sumcheck_round.hpp"
+#include "barretenberg/translator_vm/translator_flavor.hpp"
 #include <benchmark/benchmark.h>
 
 using namespace benchmark;
@@ -55,9 +60,49 @@ void self_extend_2_to_11(State& state) noexcept
     }
 }
 
+// Exercises the precomputed extension table used whenever the initial length is greater than 2
+void self_extend_4_to_11(State& state) noexcept
+{
+    auto univariate = Univariate<FF, 11>::get_random();
+
+    for (auto _ : state) {
+        univariate.self_extend_from<4>();
+    }
+}
+
+/**
+ * @brief Extend every edge of a full set of prover polynomials, as done in each sumcheck round. Reports edges/s.
+ */
+template <typename Flavor> void extend_edges(State& state) noexcept
+{
+    using ProverPolynomials = typename Flavor::ProverPolynomials;
+    using Polynomial = typename Flavor::Polynomial;
+
+    const size_t round_size = static_cast<size_t>(state.range(0));
+    ProverPolynomials polynomials;
+    for (auto& poly : polynomials.get_all()) {
+        poly = Polynomial::random(round_size);
+    }
+    SumcheckProverRound<Flavor> round(round_size);
+    typename Flavor::ExtendedEdges extended_edges;
+
+    for (auto _ : state) {
+        for (size_t edge_idx = 0; edge_idx < round_size; edge_idx += 2) {
+            round.extend_edges(extended_edges, polynomials, edge_idx);
+            DoNotOptimize(extended_edges);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(round_size / 2));
+}
+
 BENCHMARK(extend_2_to_11);
 BENCHMARK(fake_extend_2_to_11);
 BENCHMARK(self_extend_2_to_11);
+BENCHMARK(self_extend_4_to_11);
+BENCHMARK(extend_edges<UltraFlavor>)->Arg(1 << 10);
+BENCHMARK(extend_edges<MegaFlavor>)->Arg(1 << 10);
+BENCHMARK(extend_edges<TranslatorFlavor>)->Arg(1 << 10);
+BENCHMARK(extend_edges<ECCVMFlavor>)->Arg(1 << 10);
 
 } // namespace bb::benchmark
 
@@ -61,6 +61,35 @@ template <typename Flavor, typename Relation> void execute_relation_for_pg_univa
     execute_relation<Flavor, Relation, Input, Accumulator>(state);
 }
 
+// As above, but always through the generic relation arithmetic, bypassing any specialised accumulation kernel. Compare
+// with execute_relation_for_univariates / execute_relation_for_pg_univariates to see the gain from a kernel.
+template <typename Flavor, typename RelationImpl>
+void execute_generic_relation_for_univariates(::benchmark::State& state)
+{
+    using Input = typename Flavor::ExtendedEdges;
+    using Accumulator = typename Relation<RelationImpl>::SumcheckTupleOfUnivariatesOverSubrelations;
+
+    execute_relation<Flavor, RelationImpl, Input, Accumulator>(state);
+}
+
+template <typename Flavor, typename RelationImpl>
+void execute_generic_relation_for_pg_univariates(::benchmark::State& state)
+{
+    using DeciderProvingKeys = DeciderProvingKeys_<Flavor>;
+    using Input = ProtogalaxyProverInternal<DeciderProvingKeys>::ExtendedUnivariatesNoOptimisticSkipping;
+    using Accumulator =
+        typename Relation<RelationImpl>::template ProtogalaxyTupleOfUnivariatesOverSubrelationsNoOptimisticSkipping<
+            DeciderProvingKeys::NUM>;
+
+    execute_relation<Flavor, RelationImpl, Input, Accumulator>(state);
+}
+
+// Generic arithmetic for relations with a specialised kernel (PG prover combiner and Sumcheck prover work)
+BENCHMARK(execute_generic_relation_for_pg_univariates<UltraFlavor, UltraArithmeticRelationImpl<Fr>>);
+BENCHMARK(execute_generic_relation_for_pg_univariates<UltraFlavor, DeltaRangeConstraintRelationImpl<Fr>>);
+BENCHMARK(execute_generic_relation_for_univariates<UltraFlavor, UltraArithmeticRelationImpl<Fr>>);
+BENCHMARK(execute_generic_relation_for_univariates<UltraFlavor, DeltaRangeConstraintRelationImpl<Fr>>);
+
 // Ultra relations (PG prover combiner work)
 BENCHMARK(execute_relation_for_pg_univariates<UltraFlavor, UltraArithmeticRelation<Fr>>);
 BENCHMARK(execute_relation_for_pg_univariates<UltraFlavor, DeltaRangeConstraintRelation<Fr>>);
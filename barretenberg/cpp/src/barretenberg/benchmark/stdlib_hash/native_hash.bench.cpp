@@ -0,0 +1,223 @@
+/**
+ * @file native_hash.bench.cpp
+ * @brief Throughput of the native hashes used in witness generation, comparing the portable implementations, the
+ * hardware accelerated single message paths (selected at runtime) and the batch APIs
+ */
+#include "barretenberg/crypto/aes128/aes128.hpp"
+#include "barretenberg/crypto/keccak/keccak.hpp"
+#include "barretenberg/crypto/sha256/sha256.hpp"
+#include <benchmark/benchmark.h>
+#include <random>
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+
+constexpr size_t NUM_MESSAGES = 1024;
+
+std::vector<uint8_t> random_bytes(std::mt19937& engine, size_t num_bytes)
+{
+    std::vector<uint8_t> bytes(num_bytes);
+    for (auto& byte : bytes) {
+        byte = static_cast<uint8_t>(engine());
+    }
+    return bytes;
+}
+
+std::vector<std::vector<uint8_t>> random_messages(size_t message_size)
+{
+    std::mt19937 engine(42);
+    std::vector<std::vector<uint8_t>> messages(NUM_MESSAGES);
+    for (auto& message : messages) {
+        message = random_bytes(engine, message_size);
+    }
+    return messages;
+}
+
+void set_throughput(State& state, size_t bytes_per_iteration)
+{
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(bytes_per_iteration));
+}
+
+std::vector<std::array<uint32_t, 16>> random_sha256_blocks()
+{
+    std::mt19937 engine(42);
+    std::vector<std::array<uint32_t, 16>> blocks(NUM_MESSAGES);
+    for (auto& block : blocks) {
+        for (auto& word : block) {
+            word = static_cast<uint32_t>(engine());
+        }
+    }
+    return blocks;
+}
+
+void sha256_compression_portable(State& state) noexcept
+{
+    const auto blocks = random_sha256_blocks();
+    std::vector<std::array<uint32_t, 8>> states(NUM_MESSAGES);
+    for (auto _ : state) {
+        for (size_t i = 0; i < NUM_MESSAGES; ++i) {
+            states[i] = crypto::detail::sha256_block_portable(states[i], blocks[i]);
+        }
+        DoNotOptimize(states.data());
+    }
+    set_throughput(state, NUM_MESSAGES * 64);
+}
+BENCHMARK(sha256_compression_portable);
+
+void sha256_compression(State& state) noexcept
+{
+    const auto blocks = random_sha256_blocks();
+    std::vector<std::array<uint32_t, 8>> states(NUM_MESSAGES);
+    for (auto _ : state) {
+        for (size_t i = 0; i < NUM_MESSAGES; ++i) {
+            states[i] = crypto::sha256_block(states[i], blocks[i]);
+        }
+        DoNotOptimize(states.data());
+    }
+    set_throughput(state, NUM_MESSAGES * 64);
+}
+BENCHMARK(sha256_compression);
+
+void sha256_compression_batch(State& state) noexcept
+{
+    const auto blocks = random_sha256_blocks();
+    std::vector<std::array<uint32_t, 8>> states(NUM_MESSAGES);
+    for (auto _ : state) {
+        crypto::sha256_block_batch(states, blocks);
+        DoNotOptimize(states.data());
+    }
+    set_throughput(state, NUM_MESSAGES * 64);
+}
+BENCHMARK(sha256_compression_batch);
+
+void sha256_hash(State& state) noexcept
+{
+    const size_t message_size = static_cast<size_t>(state.range(0));
+    const auto messages = random_messages(message_size);
+    for (auto _ : state) {
+        for (const auto& message : messages) {
+            DoNotOptimize(crypto::sha256(message));
+        }
+    }
+    set_throughput(state, NUM_MESSAGES * message_size);
+}
+BENCHMARK(sha256_hash)->Arg(64)->Arg(1024);
+
+void sha256_hash_batch(State& state) noexcept
+{
+    const size_t message_size = static_cast<size_t>(state.range(0));
+    const auto messages = random_messages(message_size);
+    for (auto _ : state) {
+        DoNotOptimize(crypto::sha256_batch(messages));
+    }
+    set_throughput(state, NUM_MESSAGES * message_size);
+}
+BENCHMARK(sha256_hash_batch)->Arg(64)->Arg(1024);
+
+void keccakf1600(State& state) noexcept
+{
+    std::vector<std::array<uint64_t, 25>> states(NUM_MESSAGES);
+    for (auto _ : state) {
+        for (auto& keccak_state : states) {
+            ethash_keccakf1600(keccak_state.data());
+        }
+        DoNotOptimize(states.data());
+    }
+    set_throughput(state, NUM_MESSAGES * 200);
+}
+BENCHMARK(keccakf1600);
+
+void keccakf1600_batch(State& state) noexcept
+{
+    std::vector<std::array<uint64_t, 25>> states(NUM_MESSAGES);
+    for (auto _ : state) {
+        ethash_keccakf1600_batch(reinterpret_cast<uint64_t(*)[25]>(states.data()), NUM_MESSAGES);
+        DoNotOptimize(states.data());
+    }
+    set_throughput(state, NUM_MESSAGES * 200);
+}
+BENCHMARK(keccakf1600_batch);
+
+void keccak256_hash(State& state) noexcept
+{
+    const size_t message_size = static_cast<size_t>(state.range(0));
+    const auto messages = random_messages(message_size);
+    for (auto _ : state) {
+        for (const auto& message : messages) {
+            DoNotOptimize(ethash_keccak256(message.data(), message.size()));
+        }
+    }
+    set_throughput(state, NUM_MESSAGES * message_size);
+}
+BENCHMARK(keccak256_hash)->Arg(64)->Arg(1024);
+
+void keccak256_hash_batch(State& state) noexcept
+{
+    const size_t message_size = static_cast<size_t>(state.range(0));
+    const auto messages = random_messages(message_size);
+    std::vector<const uint8_t*> data;
+    std::vector<size_t> sizes;
+    for (const auto& message : messages) {
+        data.push_back(message.data());
+        sizes.push_back(message.size());
+    }
+    std::vector<struct keccak256> hashes(NUM_MESSAGES);
+    for (auto _ : state) {
+        ethash_keccak256_batch(data.data(), sizes.data(), NUM_MESSAGES, hashes.data());
+        DoNotOptimize(hashes.data());
+    }
+    set_throughput(state, NUM_MESSAGES * message_size);
+}
+BENCHMARK(keccak256_hash_batch)->Arg(64)->Arg(1024);
+
+/**
+ * @brief CBC encryption of NUM_MESSAGES buffers: portable (0), accelerated one buffer at a time (1) and batched (2)
+ */
+void aes128_encrypt_cbc(State& state) noexcept
+{
+    const size_t buffer_size = 1024;
+    auto buffers = random_messages(buffer_size);
+    std::mt19937 engine(42);
+    std::vector<std::vector<uint8_t>> keys(NUM_MESSAGES);
+    std::vector<std::vector<uint8_t>> ivs(NUM_MESSAGES);
+    std::vector<uint8_t*> buffer_ptrs;
+    std::vector<uint8_t*> iv_ptrs;
+    std::vector<const uint8_t*> key_ptrs;
+    for (size_t i = 0; i < NUM_MESSAGES; ++i) {
+        keys[i] = random_bytes(engine, 16);
+        ivs[i] = random_bytes(engine, 16);
+        buffer_ptrs.push_back(buffers[i].data());
+        iv_ptrs.push_back(ivs[i].data());
+        key_ptrs.push_back(keys[i].data());
+    }
+    const std::vector<size_t> lengths(NUM_MESSAGES, buffer_size);
+
+    for (auto _ : state) {
+        switch (state.range(0)) {
+        case 0:
+            for (size_t i = 0; i < NUM_MESSAGES; ++i) {
+                crypto::detail::aes128_encrypt_buffer_cbc_portable(
+                    buffer_ptrs[i], iv_ptrs[i], key_ptrs[i], buffer_size);
+            }
+            break;
+        case 1:
+            for (size_t i = 0; i < NUM_MESSAGES; ++i) {
+                crypto::aes128_encrypt_buffer_cbc(buffer_ptrs[i], iv_ptrs[i], key_ptrs[i], buffer_size);
+            }
+            break;
+        default:
+            crypto::aes128_encrypt_buffers_cbc(
+                buffer_ptrs.data(), iv_ptrs.data(), key_ptrs.data(), lengths.data(), NUM_MESSAGES);
+            break;
+        }
+        DoNotOptimize(buffers.data());
+    }
+    set_throughput(state, NUM_MESSAGES * buffer_size);
+}
+BENCHMARK(aes128_encrypt_cbc)->DenseRange(0, 2);
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -117,6 +117,33 @@ void native_pedersen_hash_pair_bench(State& state) noexcept
 }
 BENCHMARK(native_pedersen_hash_pair_bench)->Unit(benchmark::kMillisecond)->MinTime(3);
 
+void native_pedersen_hash_batch_bench(State& state) noexcept
+{
+    const size_t num_hashes = static_cast<size_t>(state.range(0));
+    std::vector<std::vector<grumpkin::fq>> inputs(num_hashes);
+    for (auto& input : inputs) {
+        input = { grumpkin::fq::random_element(), grumpkin::fq::random_element() };
+    }
+    for (auto _ : state) {
+        DoNotOptimize(crypto::pedersen_hash::hash_batch(inputs));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(num_hashes));
+}
+BENCHMARK(native_pedersen_hash_batch_bench)->RangeMultiplier(16)->Range(16, 1 << 16)->Unit(benchmark::kMillisecond);
+
+void native_pedersen_hash_buffer_bench(State& state) noexcept
+{
+    std::vector<uint8_t> buffer(static_cast<size_t>(state.range(0)));
+    for (auto& byte : buffer) {
+        byte = static_cast<uint8_t>(grumpkin::fq::random_element().data[0]);
+    }
+    for (auto _ : state) {
+        DoNotOptimize(crypto::pedersen_hash::hash_buffer(buffer));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(native_pedersen_hash_buffer_bench)->Arg(64)->Arg(1024);
+
 void construct_pedersen_proving_keys_bench(State& state) noexcept
 {
     for (auto _ : state) {
@@ -8,6 +8,8 @@
 #include "barretenberg/stdlib/encryption/ecdsa/ecdsa.hpp"
 #include "barretenberg/stdlib/hash/keccak/keccak.hpp"
 #include "barretenberg/stdlib/hash/sha256/sha256.hpp"
+#include "barretenberg/stdlib/primitives/curves/secp256r1.hpp"
+#include "barretenberg/stdlib/primitives/group/cycle_group.hpp"
 #include "barretenberg/ultra_honk/ultra_prover.hpp"
 
 namespace bb::mock_circuits {
@@ -37,6 +39,65 @@ template <typename Builder> void generate_basic_arithmetic_circuit(Builder& buil
     }
 }
 
+/**
+ * @brief Generate a circuit of secp256r1 ECDSA signature verifications, with the 1-bit batch_mul or with the 4-bit
+ * windowed wnaf_batch_mul
+ *
+ * @param num_iterations number of signature verifications to perform
+ */
+template <typename Builder, bool use_windowed_batch_mul>
+void generate_ecdsa_r1_verification_circuit(Builder& builder, size_t num_iterations)
+{
+    using curve = stdlib::secp256r1<Builder>;
+    using fr = typename curve::fr;
+    using fq = typename curve::fq;
+    using g1 = typename curve::g1;
+
+    std::string message_string = "Instructions unclear, ask again later.";
+
+    crypto::ecdsa_key_pair<fr, g1> account;
+    for (size_t i = 0; i < num_iterations; i++) {
+        account.private_key = fr::random_element();
+        account.public_key = g1::one * account.private_key;
+
+        crypto::ecdsa_signature signature =
+            crypto::ecdsa_construct_signature<crypto::Sha256Hasher, fq, fr, g1>(message_string, account);
+
+        std::vector<uint8_t> rr(signature.r.begin(), signature.r.end());
+        std::vector<uint8_t> ss(signature.s.begin(), signature.s.end());
+
+        typename curve::g1_bigfr_ct public_key = curve::g1_bigfr_ct::from_witness(&builder, account.public_key);
+        stdlib::ecdsa_signature<Builder> sig{ typename curve::byte_array_ct(&builder, rr),
+                                              typename curve::byte_array_ct(&builder, ss),
+                                              stdlib::uint8<Builder>(&builder, signature.v) };
+        typename curve::byte_array_ct message(&builder, message_string);
+
+        stdlib::ecdsa_verify_signature<Builder,
+                                       curve,
+                                       typename curve::fq_ct,
+                                       typename curve::bigfr_ct,
+                                       typename curve::g1_bigfr_ct>(message, public_key, sig, use_windowed_batch_mul);
+    }
+}
+
+/**
+ * @brief Generate a circuit of a cycle_group batch_mul of num_points witness points and scalars, with Straus tables of
+ * table_bits bits
+ */
+template <typename Builder, size_t table_bits>
+void generate_cycle_group_batch_mul_circuit(Builder& builder, size_t num_points)
+{
+    using cycle_group_ct = stdlib::cycle_group<Builder>;
+    std::vector<cycle_group_ct> points;
+    std::vector<typename cycle_group_ct::cycle_scalar> scalars;
+    for (size_t i = 0; i < num_points; ++i) {
+        points.emplace_back(cycle_group_ct::from_witness(&builder, cycle_group_ct::AffineElement::random_element()));
+        scalars.emplace_back(
+            cycle_group_ct::cycle_scalar::from_witness(&builder, cycle_group_ct::ScalarField::random_element()));
+    }
+    cycle_group_ct::batch_mul(points, scalars, {}, table_bits);
+}
+
 template <typename Prover>
 Prover get_prover(void (*test_circuit_function)(typename Prover::Flavor::CircuitBuilder&, size_t),
                   size_t num_iterations)
@@ -17,6 +17,17 @@ static void construct_proof_ultrahonk(State& state,
         state, test_circuit_function, num_iterations);
 }
 
+/**
+ * @brief Benchmark: Construction of a Ultra Honk proof for a batch_mul of 64 points with the given window size
+ */
+static void construct_proof_ultrahonk_batch_mul(State& state,
+                                                void (*test_circuit_function)(UltraCircuitBuilder&, size_t)) noexcept
+{
+    size_t num_points = 64;
+    bb::mock_circuits::construct_proof_with_specified_num_iterations<UltraProver>(
+        state, test_circuit_function, num_points);
+}
+
 /**
  * @brief Benchmark: Construction of a Ultra Plonk proof with 2**n gates
  */
@@ -36,11 +47,32 @@ BENCHMARK_CAPTURE(construct_proof_ultrahonk,
                   ecdsa_verification,
                   &stdlib::generate_ecdsa_verification_test_circuit<UltraCircuitBuilder>)
     ->Unit(kMillisecond);
+BENCHMARK_CAPTURE(construct_proof_ultrahonk,
+                  ecdsa_r1_verification,
+                  &bb::mock_circuits::generate_ecdsa_r1_verification_circuit<UltraCircuitBuilder, false>)
+    ->Unit(kMillisecond);
+BENCHMARK_CAPTURE(construct_proof_ultrahonk,
+                  ecdsa_r1_verification_windowed,
+                  &bb::mock_circuits::generate_ecdsa_r1_verification_circuit<UltraCircuitBuilder, true>)
+    ->Unit(kMillisecond);
 BENCHMARK_CAPTURE(construct_proof_ultrahonk,
                   merkle_membership,
                   &stdlib::generate_merkle_membership_test_circuit<UltraCircuitBuilder>)
     ->Unit(kMillisecond);
 
+BENCHMARK_CAPTURE(construct_proof_ultrahonk_batch_mul,
+                  table_bits_2,
+                  &bb::mock_circuits::generate_cycle_group_batch_mul_circuit<UltraCircuitBuilder, 2>)
+    ->Unit(kMillisecond);
+BENCHMARK_CAPTURE(construct_proof_ultrahonk_batch_mul,
+                  table_bits_4,
+                  &bb::mock_circuits::generate_cycle_group_batch_mul_circuit<UltraCircuitBuilder, 4>)
+    ->Unit(kMillisecond);
+BENCHMARK_CAPTURE(construct_proof_ultrahonk_batch_mul,
+                  table_bits_8,
+                  &bb::mock_circuits::generate_cycle_group_batch_mul_circuit<UltraCircuitBuilder, 8>)
+    ->Unit(kMillisecond);
+
 BENCHMARK(construct_proof_ultrahonk_power_of_2)
     // 2**15 gates to 2**20 gates
     ->DenseRange(15, 20)
@@ -1,4 +1,5 @@
 #include "barretenberg/benchmark/ultra_bench/mock_circuits.hpp"
+#include "barretenberg/common/op_count_google_bench.hpp"
 #include "barretenberg/plonk/composer/ultra_composer.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
 
@@ -26,6 +27,44 @@ static void construct_proof_ultraplonk_power_of_2(State& state) noexcept
         state, &bb::mock_circuits::generate_basic_arithmetic_circuit<UltraCircuitBuilder>, log2_of_gates);
 }
 
+/**
+ * @brief Benchmark: The work queue processing (FFTs, IFFTs and commitments) of an Ultra Plonk proof with 2**n gates,
+ * i.e. construct_proof without the work of the rounds themselves
+ * @details Batching the transforms of a stage only pays off with several threads; on a single thread the queue takes
+ * about as long as processing its items one after the other.
+ */
+static void process_work_queue_ultraplonk_power_of_2(State& state) noexcept
+{
+    auto log2_of_gates = static_cast<size_t>(state.range(0));
+    srs::init_crs_factory("../srs_db/ignition");
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto prover = bb::mock_circuits::get_prover<plonk::UltraProver>(
+            &bb::mock_circuits::generate_basic_arithmetic_circuit<UltraCircuitBuilder>, log2_of_gates);
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        const auto process_queue = [&]() {
+            state.ResumeTiming();
+            prover.queue.process_queue();
+            state.PauseTiming();
+        };
+        prover.execute_preamble_round();
+        process_queue();
+        prover.execute_first_round();
+        process_queue();
+        prover.execute_second_round();
+        process_queue();
+        prover.execute_third_round();
+        process_queue();
+        prover.execute_fourth_round();
+        process_queue();
+        prover.execute_fifth_round();
+        prover.execute_sixth_round();
+        process_queue();
+        // NOTE: google bench is very finnicky, must end in ResumeTiming() for correctness
+        state.ResumeTiming();
+    }
+}
+
 // Define benchmarks
 BENCHMARK_CAPTURE(construct_proof_ultraplonk, sha256, &stdlib::generate_sha256_test_circuit<UltraCircuitBuilder>)
     ->Unit(kMillisecond);
@@ -45,4 +84,6 @@ BENCHMARK(construct_proof_ultraplonk_power_of_2)
     ->DenseRange(15, 20)
     ->Unit(kMillisecond);
 
+BENCHMARK(process_work_queue_ultraplonk_power_of_2)->DenseRange(15, 20)->Unit(kMillisecond);
+
 BENCHMARK_MAIN();
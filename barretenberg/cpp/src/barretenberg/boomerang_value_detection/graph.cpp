@@ -642,10 +642,11 @@ inline void Graph_<FF>::process_current_plookup_gate(bb::UltraCircuitBuilder& ul
     auto table_index = static_cast<size_t>(lookup_block.q_3()[gate_index]);
     for (const auto& table : lookup_tables) {
         if (table.table_index == table_index) {
-            std::set<bb::fr> column_1(table.column_1.begin(), table.column_1.end());
-            std::set<bb::fr> column_2(table.column_2.begin(), table.column_2.end());
-            std::set<bb::fr> column_3(table.column_3.begin(), table.column_3.end());
-            bb::plookup::BasicTableId table_id = table.id;
+            const auto& basic_table = *table.basic_table;
+            std::set<bb::fr> column_1(basic_table.column_1.begin(), basic_table.column_1.end());
+            std::set<bb::fr> column_2(basic_table.column_2.begin(), basic_table.column_2.end());
+            std::set<bb::fr> column_3(basic_table.column_3.begin(), basic_table.column_3.end());
+            bb::plookup::BasicTableId table_id = basic_table.id;
             // false cases for AES
             this->remove_unnecessary_aes_plookup_variables(
                 variables_in_one_gate, ultra_circuit_builder, table_id, gate_index);
@@ -122,6 +122,30 @@ TEST(UltraCircuitConstructor, BadLookupFailure)
     EXPECT_FALSE(CircuitChecker::check(builder));
 }
 
+/**
+ * @brief Builders share the process-wide basic tables rather than each constructing their own copy, while the lookups
+ * recorded against a table remain per builder
+ */
+TEST(UltraCircuitConstructor, SharedBasicTables)
+{
+    UltraCircuitBuilder builder_1;
+    UltraCircuitBuilder builder_2;
+    MockCircuits::add_lookup_gates(builder_1, /*num_iterations=*/2);
+    MockCircuits::add_lookup_gates(builder_2, /*num_iterations=*/1);
+
+    ASSERT_EQ(builder_1.lookup_tables.size(), builder_2.lookup_tables.size());
+    for (size_t i = 0; i < builder_1.lookup_tables.size(); ++i) {
+        const auto& table_1 = builder_1.lookup_tables[i];
+        const auto& table_2 = builder_2.lookup_tables[i];
+        EXPECT_EQ(table_1.basic_table, table_2.basic_table);
+        EXPECT_EQ(table_1.basic_table, plookup::get_basic_table(table_1.basic_table->id));
+        EXPECT_EQ(table_1.lookup_gates.size(), 2 * table_2.lookup_gates.size());
+    }
+
+    EXPECT_TRUE(CircuitChecker::check(builder_1));
+    EXPECT_TRUE(CircuitChecker::check(builder_2));
+}
+
 TEST(UltraCircuitConstructor, BaseCase)
 {
     UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
@@ -897,6 +921,138 @@ TEST(UltraCircuitConstructor, RangeChecksOnDuplicates)
     EXPECT_EQ(result, true);
 }
 
+/**
+ * @brief Finalize a circuit with several ROM and RAM arrays (some with cells that are never written) and range lists
+ * @details The arrays and lists are sorted concurrently at finalization, which must not change the resulting circuit
+ */
+TEST(UltraCircuitConstructor, FinalizeManyMemoryArraysAndRangeLists)
+{
+    const auto construct_circuit = [](UltraCircuitBuilder& builder) {
+        const size_t num_arrays = 8;
+        const size_t array_size = 16;
+        for (size_t j = 0; j < num_arrays; ++j) {
+            // Leave the last j cells of each array uninitialized
+            const size_t rom_id = builder.create_ROM_array(array_size);
+            const size_t ram_id = builder.create_RAM_array(array_size);
+            for (size_t i = 0; i < array_size - j; ++i) {
+                builder.set_ROM_element(rom_id, i, builder.add_variable(fr(i * j)));
+                builder.init_RAM_element(ram_id, i, builder.add_variable(fr(i + j)));
+            }
+            for (size_t i = 0; i < 3 * array_size; ++i) {
+                const size_t index = (i * 7 + j) % (array_size - j);
+                const uint32_t rom_value = builder.read_ROM_array(rom_id, builder.add_variable(index));
+                if (i % 3 == 0) {
+                    builder.write_RAM_array(ram_id, builder.add_variable(index), rom_value);
+                } else {
+                    builder.read_RAM_array(ram_id, builder.add_variable(index));
+                }
+            }
+        }
+        for (size_t i = 0; i < 64; ++i) {
+            const uint64_t target_range = (1ULL << (i % 8 + 4)) - 1;
+            // Use the variable in a gate, otherwise its tag is not part of the tag check
+            const uint32_t variable = builder.add_variable(i * 3 % target_range);
+            builder.fix_witness(variable, i * 3 % target_range);
+            builder.create_new_range_constraint(variable, target_range);
+        }
+    };
+    UltraCircuitBuilder builder;
+    construct_circuit(builder);
+    UltraCircuitBuilder duplicate_builder;
+    construct_circuit(duplicate_builder);
+
+    EXPECT_TRUE(CircuitChecker::check(builder));
+    builder.finalize_circuit(/*ensure_nonzero=*/false);
+    duplicate_builder.finalize_circuit(/*ensure_nonzero=*/false);
+    EXPECT_EQ(builder, duplicate_builder);
+}
+
+// A count only builder generates the same witness and exactly the same gate counts as the full builder, including when
+// it is switched to count only with gates already added
+TEST(UltraCircuitConstructor, CountOnly)
+{
+    const auto construct_circuit = [](UltraCircuitBuilder& builder, bool set_count_only_halfway) {
+        using affine_element = grumpkin::g1::affine_element;
+        using element = grumpkin::g1::element;
+        // Reseed the engine the mock gates draw their witnesses from, so that both builders get the same witness
+        numeric::get_debug_randomness(/*reset=*/true);
+        MockCircuits::add_arithmetic_gates(builder, 1 << 6);
+        MockCircuits::add_lookup_gates(builder, 2);
+        if (set_count_only_halfway) {
+            builder.set_count_only();
+        }
+        MockCircuits::add_lookup_gates(builder, 2);
+
+        // A chain of additions and doublings, each fused into the previous elliptic gate
+        affine_element p1 = crypto::pedersen_commitment::commit_native({ bb::fr(1) }, 0);
+        const affine_element p2 = crypto::pedersen_commitment::commit_native({ bb::fr(1) }, 1);
+        uint32_t x1 = builder.add_variable(p1.x);
+        uint32_t y1 = builder.add_variable(p1.y);
+        const uint32_t x2 = builder.add_variable(p2.x);
+        const uint32_t y2 = builder.add_variable(p2.y);
+        for (size_t i = 0; i < 8; ++i) {
+            const affine_element p3 = (i % 2 == 0) ? affine_element(element(p1) + element(p2))
+                                                    : affine_element(element(p1).dbl());
+            const uint32_t x3 = builder.add_variable(p3.x);
+            const uint32_t y3 = builder.add_variable(p3.y);
+            if (i % 2 == 0) {
+                builder.create_ecc_add_gate({ x1, y1, x2, y2, x3, y3, 1 });
+            } else {
+                builder.create_ecc_dbl_gate({ x1, y1, x3, y3 });
+            }
+            p1 = p3;
+            x1 = x3;
+            y1 = y3;
+        }
+
+        const size_t rom_id = builder.create_ROM_array(8);
+        const size_t ram_id = builder.create_RAM_array(8);
+        for (size_t i = 0; i < 6; ++i) {
+            builder.set_ROM_element(rom_id, i, builder.add_variable(fr(i)));
+            builder.init_RAM_element(ram_id, i, builder.add_variable(fr(i + 1)));
+        }
+        for (size_t i = 0; i < 12; ++i) {
+            const uint32_t value = builder.read_ROM_array(rom_id, builder.add_variable(i % 6));
+            builder.write_RAM_array(ram_id, builder.add_variable((i * 5) % 6), value);
+        }
+
+        // Range constraints on variables in the same equivalence class are only applied once
+        for (size_t i = 0; i < 16; ++i) {
+            const uint32_t a = builder.add_variable(i);
+            const uint32_t b = builder.add_variable(i);
+            builder.assert_equal(a, b);
+            builder.create_new_range_constraint(a, 1 << 8);
+            builder.create_new_range_constraint(b, 1 << 8);
+        }
+    };
+
+    for (const bool set_count_only_halfway : { false, true }) {
+        UltraCircuitBuilder builder;
+        construct_circuit(builder, /*set_count_only_halfway=*/false);
+        UltraCircuitBuilder count_only_builder;
+        if (!set_count_only_halfway) {
+            count_only_builder.set_count_only();
+        }
+        construct_circuit(count_only_builder, set_count_only_halfway);
+        EXPECT_TRUE(count_only_builder.is_count_only());
+
+        EXPECT_EQ(count_only_builder.variables, builder.variables);
+        EXPECT_EQ(count_only_builder.num_gates, builder.num_gates);
+        EXPECT_EQ(count_only_builder.get_estimated_num_finalized_gates(), builder.get_estimated_num_finalized_gates());
+        EXPECT_EQ(count_only_builder.get_estimated_total_circuit_size(), builder.get_estimated_total_circuit_size());
+
+        builder.finalize_circuit(/*ensure_nonzero=*/true);
+        count_only_builder.finalize_circuit(/*ensure_nonzero=*/true);
+        EXPECT_EQ(count_only_builder.get_num_finalized_gates(), builder.get_num_finalized_gates());
+        EXPECT_EQ(count_only_builder.get_finalized_total_circuit_size(), builder.get_finalized_total_circuit_size());
+        auto count_only_blocks = count_only_builder.blocks.get();
+        auto blocks = builder.blocks.get();
+        for (size_t i = 0; i < blocks.size(); ++i) {
+            EXPECT_EQ(count_only_blocks[i].size(), blocks[i].size());
+        }
+    }
+}
+
 TEST(UltraCircuitConstructor, CheckCircuitShowcase)
 {
     UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
@@ -1,8 +1,90 @@
 #include "barretenberg/client_ivc/client_ivc.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ultra_honk/oink_prover.hpp"
+#ifndef NO_MULTITHREADING
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#endif
 
 namespace bb {
 
+#ifndef NO_MULTITHREADING
+namespace {
+/**
+ * @brief The circuits constructed by the producer thread of ClientIVC::accumulate_pipelined, waiting to be accumulated
+ * @details Holds at most `capacity` circuits: the producer waits while the queue is full and the consumer while it is
+ * empty. An exception thrown by the producer is rethrown to the consumer, and a consumer that stops early closes the
+ * queue so that the producer stops too.
+ */
+class PipelinedCircuitQueue {
+  public:
+    using ClientCircuit = ClientIVC::ClientCircuit;
+
+    explicit PipelinedCircuitQueue(size_t capacity)
+        : capacity(std::max<size_t>(capacity, 1))
+    {}
+
+    /**
+     * @brief Add a circuit, waiting while the queue is full
+     * @return false if the queue has been closed, in which case the producer should stop
+     */
+    bool push(ClientCircuit&& circuit)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        not_full.wait(lock, [this] { return circuits.size() < capacity || closed; });
+        if (closed) {
+            return false;
+        }
+        circuits.emplace_back(std::move(circuit));
+        not_empty.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Remove the oldest circuit, waiting while the queue is empty
+     */
+    ClientCircuit pop()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        not_empty.wait(lock, [this] { return !circuits.empty() || producer_exception; });
+        if (circuits.empty()) {
+            std::rethrow_exception(producer_exception);
+        }
+        ClientCircuit circuit = std::move(circuits.front());
+        circuits.pop_front();
+        not_full.notify_one();
+        return circuit;
+    }
+
+    void set_producer_exception(std::exception_ptr exception)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        producer_exception = std::move(exception);
+        not_empty.notify_one();
+    }
+
+    void close()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        closed = true;
+        not_full.notify_one();
+    }
+
+  private:
+    size_t capacity;
+    std::deque<ClientCircuit> circuits;
+    std::exception_ptr producer_exception;
+    bool closed = false;
+    std::mutex mutex;
+    std::condition_variable not_full;
+    std::condition_variable not_empty;
+};
+} // namespace
+#endif
+
 /**
  * @brief Instantiate a stdlib verification queue for use in the kernel completion logic
  * @details Construct a stdlib proof/verification_key for each entry in the native verification queue. By default, both
@@ -170,14 +252,27 @@ void ClientIVC::accumulate(ClientCircuit& circuit, const std::shared_ptr<Verific
     // verifier.
     circuit.add_pairing_point_accumulator(stdlib::recursion::init_default_agg_obj_indices<ClientCircuit>(circuit));
 
+    // Precomputed polynomials are only cached/reused for keys that are folded into the accumulator since the
+    // polynomials of the accumulator itself are modified in place by folding. A mock vk cannot identify the circuit.
+    const bool reuse_precomputed = reuse_precomputed_polynomials && initialized && precomputed_vk && !mock_vk;
+
+    const uint256_t vk_hash = reuse_precomputed ? precomputed_vk->hash() : uint256_t(0);
+
     // Construct the proving key for circuit
     std::shared_ptr<DeciderProvingKey> proving_key;
     if (!initialized) {
         proving_key = std::make_shared<DeciderProvingKey>(circuit, trace_structure);
         trace_usage_tracker = ExecutionTraceUsageTracker(trace_structure);
+    } else if (const auto* precomputed = reuse_precomputed ? find_precomputed_polynomials(vk_hash) : nullptr) {
+        vinfo("reusing precomputed polynomials");
+        proving_key = std::make_shared<DeciderProvingKey>(
+            circuit, *precomputed, trace_structure, fold_output.accumulator->proving_key.commitment_key);
     } else {
         proving_key = std::make_shared<DeciderProvingKey>(
             circuit, trace_structure, fold_output.accumulator->proving_key.commitment_key);
+        if (reuse_precomputed) {
+            cache_precomputed_polynomials(vk_hash, proving_key->share_precomputed_polynomials());
+        }
     }
 
     vinfo("getting honk vk... precomputed?: ", precomputed_vk);
@@ -219,6 +314,121 @@ void ClientIVC::accumulate(ClientCircuit& circuit, const std::shared_ptr<Verific
     }
 }
 
+/**
+ * @brief Accumulate a stack of circuits, constructing each circuit concurrently with the accumulation of the previous
+ * ones
+ * @details Circuits are constructed in order by construct_next_circuit on a thread of their own, at most
+ * max_queued_circuits ahead of the circuit being accumulated, and accumulated in order on the calling thread. Each
+ * circuit is constructed on an op queue of its own, whose ops are transferred to the IVC op queue when the circuit is
+ * accumulated, so the accumulated circuits, and hence all proofs, are the same as when constructing and accumulating
+ * the circuits one after the other. The kernel logic (recursive verifiers, databus consistency checks) depends on the
+ * proofs of the preceding circuits, so it is completed on accumulation, i.e. auto_verify_mode must be set and
+ * construct_next_circuit only constructs the base logic of the kernels (marking them with
+ * databus_propagation_data.is_kernel).
+ *
+ * @param num_circuits
+ * @param construct_next_circuit Constructs the next circuit on the given op queue. It runs concurrently with the
+ * accumulation, so it must not access the IVC. Its parallel_for calls run serially.
+ * @param precomputed_vks Empty, or a verification key for each circuit (see accumulate)
+ * @param mock_vk See accumulate
+ */
+void ClientIVC::accumulate_pipelined(const size_t num_circuits,
+                                     const CircuitConstructor& construct_next_circuit,
+                                     const std::vector<std::shared_ptr<VerificationKey>>& precomputed_vks,
+                                     const bool mock_vk)
+{
+    ASSERT(auto_verify_mode);
+    ASSERT(precomputed_vks.empty() || precomputed_vks.size() == num_circuits);
+
+    const auto accumulate_circuit = [&](ClientCircuit& circuit, const size_t circuit_idx) {
+        // Transfer the ops of the circuit to the IVC op queue, as if it had been constructed on it
+        goblin.op_queue->append_subsequent_queue(*circuit.op_queue);
+        circuit.op_queue = goblin.op_queue;
+        accumulate(circuit, precomputed_vks.empty() ? nullptr : precomputed_vks[circuit_idx], mock_vk);
+    };
+
+#ifdef NO_MULTITHREADING
+    for (size_t circuit_idx = 0; circuit_idx < num_circuits; ++circuit_idx) {
+        ClientCircuit circuit = construct_next_circuit(std::make_shared<ECCOpQueue>());
+        accumulate_circuit(circuit, circuit_idx);
+    }
+#else
+    PipelinedCircuitQueue queue(max_queued_circuits);
+    std::thread producer([&]() {
+        // The accumulation on the calling thread uses the thread pool
+        SerialParallelForScope serial_parallel_for;
+        try {
+            for (size_t circuit_idx = 0; circuit_idx < num_circuits; ++circuit_idx) {
+                if (!queue.push(construct_next_circuit(std::make_shared<ECCOpQueue>()))) {
+                    return;
+                }
+            }
+        } catch (...) {
+            queue.set_producer_exception(std::current_exception());
+        }
+    });
+
+    try {
+        for (size_t circuit_idx = 0; circuit_idx < num_circuits; ++circuit_idx) {
+            ClientCircuit circuit = queue.pop();
+            accumulate_circuit(circuit, circuit_idx);
+        }
+    } catch (...) {
+        queue.close();
+        producer.join();
+        throw;
+    }
+    producer.join();
+#endif
+}
+
+/**
+ * @brief Find the cached precomputed polynomials of a previously folded circuit with the given verification key hash
+ * @details A hit marks the entry as the most recently used.
+ *
+ * @return A pointer into the cache, valid until the next insertion, or nullptr if no circuit with this verification key
+ * is cached
+ */
+const ClientIVC::DeciderProvingKey::PrecomputedPolynomials* ClientIVC::find_precomputed_polynomials(
+    const uint256_t& vk_hash)
+{
+    auto it = std::find_if(precomputed_polynomials_cache.begin(),
+                           precomputed_polynomials_cache.end(),
+                           [&](const CachedPrecomputedPolynomials& entry) { return entry.vk_hash == vk_hash; });
+    if (it == precomputed_polynomials_cache.end()) {
+        return nullptr;
+    }
+    std::rotate(it, it + 1, precomputed_polynomials_cache.end());
+    return &precomputed_polynomials_cache.back().polynomials;
+}
+
+/**
+ * @brief Cache the precomputed polynomials of a folded circuit, evicting the least recently used entries while the
+ * cache exceeds max_precomputed_polynomials_cache_bytes
+ * @details The size of an entry is that of its polynomials' memory, some of which may be shared with other entries or
+ * keys, so it is an upper bound on the memory the cache keeps alive.
+ */
+void ClientIVC::cache_precomputed_polynomials(const uint256_t& vk_hash,
+                                              DeciderProvingKey::PrecomputedPolynomials&& polynomials)
+{
+    size_t num_bytes = 0;
+    for (const auto& polynomial : polynomials.get_all()) {
+        num_bytes += polynomial.size() * sizeof(FF);
+    }
+    precomputed_polynomials_cache.push_back({ vk_hash, std::move(polynomials), num_bytes });
+
+    size_t total_bytes = 0;
+    for (const auto& entry : precomputed_polynomials_cache) {
+        total_bytes += entry.num_bytes;
+    }
+    auto first_kept = precomputed_polynomials_cache.begin();
+    while (first_kept != precomputed_polynomials_cache.end() && total_bytes > max_precomputed_polynomials_cache_bytes) {
+        total_bytes -= first_kept->num_bytes;
+        ++first_kept;
+    }
+    precomputed_polynomials_cache.erase(precomputed_polynomials_cache.begin(), first_kept);
+}
+
 /**
  * @brief Construct the hiding circuit, which recursively verifies the last folding proof and decider proof, and
  * then produce a proof of the circuit's correctness with MegaHonk.
@@ -339,6 +549,8 @@ HonkProof ClientIVC::decider_prove() const
 {
     vinfo("prove decider...");
     MegaDeciderProver decider_prover(fold_output.accumulator);
+    // The accumulator is discarded once the decider proof is constructed
+    decider_prover.memory_manager.release_after_last_use = true;
     return decider_prover.construct_proof();
     vinfo("finished decider proving.");
 }
@@ -382,7 +594,7 @@ std::vector<std::shared_ptr<ClientIVC::VerificationKey>> ClientIVC::precompute_f
     }
 
     // Reset the scheme so it can be reused for actual accumulation, maintaining the trace structure setting as is
-    TraceStructure structure = trace_structure;
+    TraceSettings structure = trace_structure;
     bool auto_verify = auto_verify_mode;
     *this = ClientIVC();
     this->trace_structure = structure;
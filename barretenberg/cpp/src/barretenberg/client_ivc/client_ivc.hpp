@@ -11,6 +11,7 @@
 #include "barretenberg/ultra_honk/decider_prover.hpp"
 #include "barretenberg/ultra_honk/decider_verifier.hpp"
 #include <algorithm>
+#include <functional>
 
 namespace bb {
 
@@ -57,6 +58,9 @@ class ClientIVC {
 
     using DataBusDepot = stdlib::DataBusDepot<ClientCircuit>;
 
+    // Constructs the next circuit to be accumulated on the given op queue, see accumulate_pipelined
+    using CircuitConstructor = std::function<ClientCircuit(const std::shared_ptr<ECCOpQueue>&)>;
+
     /**
      * @brief A full  proof for the IVC scheme containing a Mega proof showing correctness of the hiding circuit (which
      * recursive verified the last folding and decider proof) and a Goblin proof (translator VM, ECCVM and last merge
@@ -115,8 +119,8 @@ class ClientIVC {
     // Management of linking databus commitments between circuits in the IVC
     DataBusDepot bus_depot;
 
-    // A flag indicating whether or not to construct a structured trace in the DeciderProvingKey
-    TraceStructure trace_structure = TraceStructure::NONE;
+    // The structure of the trace of the DeciderProvingKeys, if any
+    TraceSettings trace_structure;
 
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/1101): eventually do away with this.
     // Setting auto_verify_mode = true will cause kernel completion logic to be added to kernels automatically
@@ -124,6 +128,30 @@ class ClientIVC {
 
     bool initialized = false; // Is the IVC accumulator initialized
 
+    // Setting reuse_precomputed_polynomials = true causes the precomputed polynomials (selectors, sigmas/ids, tables,
+    // lagranges) of each folded circuit to be cached, keyed by the hash of its precomputed verification key. A later
+    // circuit with an identical verification key then only has its witness polynomials constructed. This trades memory
+    // for proving key construction time.
+    bool reuse_precomputed_polynomials = false;
+
+    // Bound on the size in bytes of the cached precomputed polynomials, beyond which the least recently used entries
+    // are evicted
+    size_t max_precomputed_polynomials_cache_bytes = size_t(1) << 31;
+
+    // Maximum number of circuits constructed by accumulate_pipelined ahead of the circuit being accumulated, each of
+    // which is held in memory until it is accumulated
+    size_t max_queued_circuits = 1;
+
+    struct CachedPrecomputedPolynomials {
+        uint256_t vk_hash;
+        DeciderProvingKey::PrecomputedPolynomials polynomials;
+        size_t num_bytes;
+    };
+
+    // Cache of precomputed polynomials of previously folded circuits, used if reuse_precomputed_polynomials = true,
+    // ordered from least to most recently used
+    std::vector<CachedPrecomputedPolynomials> precomputed_polynomials_cache;
+
     void instantiate_stdlib_verification_queue(
         ClientCircuit& circuit, const std::vector<std::shared_ptr<RecursiveVerificationKey>>& input_keys = {});
 
@@ -150,6 +178,11 @@ class ClientIVC {
                     const std::shared_ptr<VerificationKey>& precomputed_vk = nullptr,
                     bool mock_vk = false);
 
+    void accumulate_pipelined(size_t num_circuits,
+                              const CircuitConstructor& construct_next_circuit,
+                              const std::vector<std::shared_ptr<VerificationKey>>& precomputed_vks = {},
+                              bool mock_vk = false);
+
     Proof prove();
 
     HonkProof construct_and_prove_hiding_circuit();
@@ -167,5 +200,11 @@ class ClientIVC {
 
     std::vector<std::shared_ptr<VerificationKey>> precompute_folding_verification_keys(
         std::vector<ClientCircuit> circuits);
+
+  private:
+    const DeciderProvingKey::PrecomputedPolynomials* find_precomputed_polynomials(const uint256_t& vk_hash);
+
+    void cache_precomputed_polynomials(const uint256_t& vk_hash,
+                                       DeciderProvingKey::PrecomputedPolynomials&& polynomials);
 };
 } // namespace bb
\ No newline at end of file
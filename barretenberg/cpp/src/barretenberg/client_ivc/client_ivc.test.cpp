@@ -76,7 +76,7 @@ class ClientIVCTests : public ::testing::Test {
         }
 
         auto precompute_verification_keys(const size_t num_circuits,
-                                          TraceStructure trace_structure,
+                                          const TraceSettings& trace_structure,
                                           size_t log2_num_gates = 16)
         {
             ClientIVC ivc; // temporary IVC instance needed to produce the complete kernel circuits
@@ -295,6 +295,41 @@ TEST_F(ClientIVCTests, BasicStructured)
     EXPECT_TRUE(ivc.prove_and_verify());
 };
 
+/**
+ * @brief A structured trace proposed from the block usage of a set of circuits can be loaded to accumulate them
+ *
+ */
+TEST_F(ClientIVCTests, ProposedStructure)
+{
+    size_t NUM_CIRCUITS = 4;
+    const auto accumulate_circuits = [&](ClientIVC& ivc) {
+        MockCircuitProducer circuit_producer;
+        size_t log2_num_gates = 5;
+        for (size_t idx = 0; idx < NUM_CIRCUITS; ++idx) {
+            auto circuit = circuit_producer.create_next_circuit(ivc, log2_num_gates);
+            ivc.accumulate(circuit);
+            log2_num_gates += 2;
+        }
+    };
+
+    // Collect the block usage of the circuits with a generous structure
+    ClientIVC ivc;
+    ivc.trace_structure = TraceStructure::SMALL_TEST;
+    accumulate_circuits(ivc);
+    const std::string serialized_block_sizes =
+        ExecutionTraceUsageTracker::serialize_block_sizes(ivc.trace_usage_tracker.propose_block_sizes());
+
+    // Accumulate the same circuits with the proposed structure, which yields a smaller accumulator
+    ClientIVC tuned_ivc;
+    tuned_ivc.trace_structure = ExecutionTraceUsageTracker::to_trace_settings(
+        ExecutionTraceUsageTracker::deserialize_block_sizes(serialized_block_sizes));
+    accumulate_circuits(tuned_ivc);
+    EXPECT_LT(tuned_ivc.fold_output.accumulator->proving_key.circuit_size,
+              ivc.fold_output.accumulator->proving_key.circuit_size);
+
+    EXPECT_TRUE(tuned_ivc.prove_and_verify());
+};
+
 /**
  * @brief Prove and verify accumulation of an arbitrary set of circuits using precomputed verification keys
  *
@@ -344,6 +379,101 @@ TEST_F(ClientIVCTests, StructuredPrecomputedVKs)
     EXPECT_TRUE(ivc.prove_and_verify());
 };
 
+/**
+ * @brief Perform accumulation with a structured trace and precomputed verification keys, reusing the precomputed
+ * polynomials of circuits whose verification key has already been seen
+ *
+ */
+TEST_F(ClientIVCTests, StructuredPrecomputedVKsReusePrecomputedPolynomials)
+{
+    ClientIVC ivc;
+    ivc.trace_structure = TraceStructure::SMALL_TEST;
+    ivc.reuse_precomputed_polynomials = true;
+
+    size_t NUM_CIRCUITS = 6;
+    size_t log2_num_gates = 5; // number of gates in baseline mocked circuit
+
+    MockCircuitProducer circuit_producer;
+
+    auto precomputed_vks =
+        circuit_producer.precompute_verification_keys(NUM_CIRCUITS, ivc.trace_structure, log2_num_gates);
+
+    // Construct and accumulate set of circuits using the precomputed vkeys
+    for (size_t idx = 0; idx < NUM_CIRCUITS; ++idx) {
+        auto circuit = circuit_producer.create_next_circuit(ivc, log2_num_gates);
+        ivc.accumulate(circuit, precomputed_vks[idx]);
+    }
+
+    // The app circuits all share a structure so fewer sets of polynomials than folded circuits have been cached
+    EXPECT_LT(ivc.precomputed_polynomials_cache.size(), NUM_CIRCUITS - 1);
+
+    EXPECT_TRUE(ivc.prove_and_verify());
+};
+
+/**
+ * @brief Check that the cache of precomputed polynomials is kept within its bound by evicting entries
+ *
+ */
+TEST_F(ClientIVCTests, StructuredPrecomputedVKsPrecomputedPolynomialsCacheBound)
+{
+    ClientIVC ivc;
+    ivc.trace_structure = TraceStructure::SMALL_TEST;
+    ivc.reuse_precomputed_polynomials = true;
+    // Too small to hold a single set of polynomials
+    ivc.max_precomputed_polynomials_cache_bytes = 1;
+
+    size_t NUM_CIRCUITS = 4;
+    size_t log2_num_gates = 5; // number of gates in baseline mocked circuit
+
+    MockCircuitProducer circuit_producer;
+
+    auto precomputed_vks =
+        circuit_producer.precompute_verification_keys(NUM_CIRCUITS, ivc.trace_structure, log2_num_gates);
+
+    for (size_t idx = 0; idx < NUM_CIRCUITS; ++idx) {
+        auto circuit = circuit_producer.create_next_circuit(ivc, log2_num_gates);
+        ivc.accumulate(circuit, precomputed_vks[idx]);
+        EXPECT_TRUE(ivc.precomputed_polynomials_cache.empty());
+    }
+
+    EXPECT_TRUE(ivc.prove_and_verify());
+};
+
+/**
+ * @brief Accumulate circuits that are constructed concurrently with the accumulation, using the verification keys of
+ * the same circuits constructed and accumulated one after the other, i.e. pipelining must not change the circuits
+ *
+ */
+TEST_F(ClientIVCTests, PipelinedAccumulation)
+{
+    ClientIVC ivc;
+    ivc.trace_structure = TraceStructure::SMALL_TEST;
+    ivc.auto_verify_mode = true;
+
+    size_t NUM_CIRCUITS = 6;
+    size_t log2_num_gates = 5; // number of gates in baseline mocked circuit
+
+    MockCircuitProducer circuit_producer;
+
+    auto precomputed_vks =
+        circuit_producer.precompute_verification_keys(NUM_CIRCUITS, ivc.trace_structure, log2_num_gates);
+
+    // Construct the same circuits as the circuit producer, except that the kernel logic is completed on accumulation
+    size_t circuit_idx = 0;
+    ivc.accumulate_pipelined(
+        NUM_CIRCUITS,
+        [&](const std::shared_ptr<ECCOpQueue>& op_queue) {
+            Builder circuit{ op_queue };
+            MockCircuits::construct_arithmetic_circuit(circuit, log2_num_gates);
+            MockCircuits::construct_goblin_ecc_op_circuit(circuit);
+            circuit.databus_propagation_data.is_kernel = (circuit_idx++ % 2 == 1);
+            return circuit;
+        },
+        precomputed_vks);
+
+    EXPECT_TRUE(ivc.prove_and_verify());
+};
+
 /**
  * @brief Run a test using functions shared with the ClientIVC benchmark.
  * @details We do have this in addition to the above tests anyway so we can believe that the benchmark is running on
@@ -367,6 +497,25 @@ TEST(ClientIVCBenchValidation, Full6)
     EXPECT_TRUE(verified);
 }
 
+/**
+ * @brief Test the pipelined accumulation of the ClientIVC benchmark with genuine verification keys
+ */
+TEST(ClientIVCBenchValidation, Full6Pipelined)
+{
+    bb::srs::init_crs_factory("../srs_db/ignition");
+    bb::srs::init_grumpkin_crs_factory("../srs_db/grumpkin");
+
+    ClientIVC ivc;
+    ivc.trace_structure = TraceStructure::CLIENT_IVC_BENCH;
+    size_t total_num_circuits{ 12 };
+    PrivateFunctionExecutionMockCircuitProducer circuit_producer;
+    auto precomputed_vkeys = circuit_producer.precompute_verification_keys(total_num_circuits, ivc.trace_structure);
+    perform_ivc_accumulation_rounds_pipelined(total_num_circuits, ivc, precomputed_vkeys);
+    auto proof = ivc.prove();
+    bool verified = verify_ivc(proof, ivc);
+    EXPECT_TRUE(verified);
+}
+
 /**
  * @brief Test that running the benchmark suite with movked verification keys will not error out.
  */
@@ -101,17 +101,31 @@ class PrivateFunctionExecutionMockCircuitProducer {
      * @brief Create the next circuit (app/kernel) in a mocked private function execution stack
      */
     ClientCircuit create_next_circuit(ClientIVC& ivc, bool force_is_kernel = false)
+    {
+        ClientCircuit circuit = create_next_circuit_base_logic(ivc.goblin.op_queue, force_is_kernel);
+        if (circuit.databus_propagation_data.is_kernel) {
+            ivc.complete_kernel_circuit_logic(circuit); // complete with recursive verifiers etc
+        }
+        return circuit;
+    }
+
+    /**
+     * @brief Create the next circuit (app/kernel) on the given op queue, leaving the completion of the kernel logic to
+     * the IVC (auto_verify_mode). Does not access the IVC, e.g. for ClientIVC::accumulate_pipelined.
+     */
+    ClientCircuit create_next_circuit_base_logic(const std::shared_ptr<ECCOpQueue>& op_queue,
+                                                 bool force_is_kernel = false)
     {
         circuit_counter++;
 
         // Assume only every second circuit is a kernel, unless force_is_kernel == true
         bool is_kernel = (circuit_counter % 2 == 0) || force_is_kernel;
 
-        ClientCircuit circuit{ ivc.goblin.op_queue };
+        ClientCircuit circuit{ op_queue };
         if (is_kernel) {
             GoblinMockCircuits::construct_mock_folding_kernel(circuit); // construct mock base logic
             mock_databus.populate_kernel_databus(circuit);              // populate databus inputs/outputs
-            ivc.complete_kernel_circuit_logic(circuit);                 // complete with recursive verifiers etc
+            circuit.databus_propagation_data.is_kernel = true;
         } else {
             bool use_large_circuit = (circuit_counter == 1);                            // first circuit is size 2^19
             GoblinMockCircuits::construct_mock_app_circuit(circuit, use_large_circuit); // construct mock app
@@ -135,7 +149,7 @@ class PrivateFunctionExecutionMockCircuitProducer {
      * @param trace_structure Trace structuring must be known in advance because it effects the VKs
      * @return set of num_circuits-many verification keys
      */
-    auto precompute_verification_keys(const size_t num_circuits, TraceStructure trace_structure)
+    auto precompute_verification_keys(const size_t num_circuits, const TraceSettings& trace_structure)
     {
         ClientIVC ivc; // temporary IVC instance needed to produce the complete kernel circuits
         ivc.trace_structure = trace_structure;
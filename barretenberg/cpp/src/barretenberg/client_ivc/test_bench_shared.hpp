@@ -50,6 +50,32 @@ void perform_ivc_accumulation_rounds(size_t NUM_CIRCUITS,
     }
 }
 
+/**
+ * @brief Perform a specified number of circuit accumulation rounds, constructing each circuit concurrently with the
+ * accumulation of the previous ones (see ClientIVC::accumulate_pipelined)
+ *
+ * @param NUM_CIRCUITS Number of circuits to accumulate (apps + kernels)
+ */
+void perform_ivc_accumulation_rounds_pipelined(size_t NUM_CIRCUITS,
+                                               ClientIVC& ivc,
+                                               auto& precomputed_vks,
+                                               const bool& mock_vk = false)
+{
+    ASSERT(precomputed_vks.size() == NUM_CIRCUITS); // ensure presence of a precomputed VK for each circuit
+
+    PrivateFunctionExecutionMockCircuitProducer circuit_producer;
+
+    ivc.auto_verify_mode = true; // the kernel logic is completed on accumulation
+    ivc.accumulate_pipelined(
+        NUM_CIRCUITS,
+        [&](const std::shared_ptr<ECCOpQueue>& op_queue) {
+            PROFILE_THIS_NAME("construct_circuits");
+            return circuit_producer.create_next_circuit_base_logic(op_queue);
+        },
+        precomputed_vks,
+        mock_vk);
+}
+
 std::vector<std::shared_ptr<typename MegaFlavor::VerificationKey>> mock_verification_keys(const size_t num_circuits)
 {
 
@@ -195,6 +195,40 @@ template <typename Curve> void bench_commit_random_non_power_of_2(::benchmark::S
     }
 }
 
+// Commit to a polynomial with dense random entries below 2^16 (e.g. lookup read counts or range constrained wires)
+template <typename Curve> void bench_commit_small_values(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+    auto& engine = numeric::get_debug_randomness();
+
+    const size_t num_points = 1 << state.range(0);
+    auto polynomial = Polynomial<Fr>(num_points);
+    for (size_t i = 0; i < num_points; i++) {
+        polynomial.at(i) = engine.get_random_uint16();
+    }
+    for (auto _ : state) {
+        key->commit(polynomial);
+    }
+}
+
+// Commit to a polynomial with dense random entries in {0, 1} (e.g. selectors or lookup read tags)
+template <typename Curve> void bench_commit_boolean(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+    auto& engine = numeric::get_debug_randomness();
+
+    const size_t num_points = 1 << state.range(0);
+    auto polynomial = Polynomial<Fr>(num_points);
+    for (size_t i = 0; i < num_points; i++) {
+        polynomial.at(i) = engine.get_random_uint8() & 1;
+    }
+    for (auto _ : state) {
+        key->commit(polynomial);
+    }
+}
+
 // Commit to a polynomial with block structured random entries using the basic commit method
 template <typename Curve> void bench_commit_structured_random_poly(::benchmark::State& state)
 {
@@ -268,6 +302,12 @@ BENCHMARK(bench_commit_random<curve::BN254>)
 BENCHMARK(bench_commit_random_non_power_of_2<curve::BN254>)
     ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
     ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_small_values<curve::BN254>)
+    ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_boolean<curve::BN254>)
+    ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
+    ->Unit(benchmark::kMillisecond);
 BENCHMARK(bench_commit_structured_random_poly<curve::BN254>)->Unit(benchmark::kMillisecond);
 BENCHMARK(bench_commit_structured_random_poly_preprocessed<curve::BN254>)->Unit(benchmark::kMillisecond);
 BENCHMARK(bench_commit_mock_z_perm<curve::BN254>)->Unit(benchmark::kMillisecond);
@@ -10,6 +10,7 @@
 #include "barretenberg/common/debug_log.hpp"
 #include "barretenberg/common/op_count.hpp"
 #include "barretenberg/ecc/batched_affine_addition/batched_affine_addition.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/ecc/scalar_multiplication/sorted_msm.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
@@ -20,8 +21,11 @@
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <string_view>
 
 namespace bb {
@@ -52,9 +56,16 @@ template <class Curve> class CommitmentKey {
     }
 
   public:
+    // Polynomials whose coefficients are all at most this value are committed to via commit_small_scalars
+    static constexpr uint64_t MAX_SMALL_SCALAR = (1 << 16) - 1;
+    // Number of coefficients checked at a time by get_small_scalars before it looks for a large one found elsewhere
+    static constexpr size_t SMALL_SCALAR_CHUNK_SIZE = 1 << 10;
+
     scalar_multiplication::pippenger_runtime_state<Curve> pippenger_runtime_state;
     std::shared_ptr<srs::factories::CrsFactory<Curve>> crs_factory;
     std::shared_ptr<srs::factories::ProverCrs<Curve>> srs;
+    // Precomputed shifted copies of the SRS points used by commit if set, see enable_fixed_base_msm
+    std::shared_ptr<scalar_multiplication::FixedBaseTable<Curve>> fixed_base_table;
 
     CommitmentKey() = delete;
 
@@ -115,12 +126,191 @@ template <class Curve> class CommitmentKey {
 
         std::span<G1> point_table = srs->get_monomial_points().subspan(actual_start_index * 2);
         DEBUG_LOG_ALL(polynomial.span);
+
+        // Polynomials with small coefficients (e.g. lookup read counts/tags, boolean selectors, range constrained
+        // wires) are committed to by summing the points for each coefficient value rather than via pippenger
+        if (auto small_scalars = get_small_scalars(polynomial)) {
+            return commit_small_scalars(*small_scalars, point_table.subspan(relative_start_index * 2));
+        }
+
+        if (fixed_base_table && polynomial.end_index() <= fixed_base_table->get_num_points()) {
+            return fixed_base_table->msm(polynomial);
+        }
+
         Commitment point = scalar_multiplication::pippenger_unsafe_optimized_for_non_dyadic_polys<Curve>(
             { relative_start_index, polynomial.span }, point_table, pippenger_runtime_state);
         DEBUG_LOG(point);
         return point;
     };
 
+    /**
+     * @brief Compute commitments to polynomials supported on the first num_points SRS points via fixed-base MSMs
+     * @details The table of shifted SRS points takes ⌈129/window_bits⌉ times the memory of the SRS point table, and
+     * wider windows make commitments faster up to the point where combining the 2^window_bits buckets dominates; see
+     * FixedBaseTable. If cache_dir is given, the table is computed once and memory mapped from there afterwards.
+     */
+    void enable_fixed_base_msm(size_t num_points, size_t window_bits, const std::string& cache_dir = "")
+    {
+        if (num_points > srs->get_monomial_size()) {
+            throw_or_abort("CommitmentKey: not enough SRS points for the requested fixed base table.");
+        }
+        fixed_base_table = scalar_multiplication::FixedBaseTable<Curve>::load_or_compute(
+            srs->get_monomial_points(), num_points, window_bits, cache_dir);
+    }
+
+    /**
+     * @brief Whether every coefficient in the span is at most MAX_SMALL_SCALAR
+     */
+    static bool are_small_scalars(std::span<const Fr> coefficients)
+    {
+        return std::all_of(coefficients.begin(), coefficients.end(), [](const Fr& coefficient) {
+            return static_cast<uint256_t>(coefficient) <= MAX_SMALL_SCALAR;
+        });
+    }
+
+    /**
+     * @brief Convert the coefficients of a polynomial to integers if they are all at most MAX_SMALL_SCALAR
+     * @details The coefficients are first checked in chunks of SMALL_SCALAR_CHUNK_SIZE, and the check stops as soon as
+     * a large coefficient is found. The first chunk is checked before starting any threads, which is usually enough to
+     * rule out a polynomial with random coefficients. The integers are only allocated and computed once every
+     * coefficient is known to be small.
+     *
+     * @return The coefficients as integers, or std::nullopt if some coefficient is too large
+     */
+    static std::optional<std::vector<uint32_t>> get_small_scalars(PolynomialSpan<const Fr> polynomial)
+    {
+        const size_t poly_size = polynomial.size();
+        if (poly_size == 0 || !are_small_scalars(polynomial.span.first(std::min(poly_size, SMALL_SCALAR_CHUNK_SIZE)))) {
+            return std::nullopt;
+        }
+
+        std::atomic<bool> all_small = true;
+        if (poly_size > SMALL_SCALAR_CHUNK_SIZE) {
+            const auto remaining = polynomial.span.subspan(SMALL_SCALAR_CHUNK_SIZE);
+            parallel_for_range(remaining.size(), [&](size_t start, size_t end) {
+                for (size_t chunk_start = start; chunk_start < end; chunk_start += SMALL_SCALAR_CHUNK_SIZE) {
+                    if (!all_small.load(std::memory_order_relaxed)) {
+                        return;
+                    }
+                    const size_t chunk_size = std::min(SMALL_SCALAR_CHUNK_SIZE, end - chunk_start);
+                    if (!are_small_scalars(remaining.subspan(chunk_start, chunk_size))) {
+                        all_small.store(false, std::memory_order_relaxed);
+                        return;
+                    }
+                }
+            });
+        }
+        if (!all_small) {
+            return std::nullopt;
+        }
+
+        std::vector<uint32_t> values(poly_size);
+        parallel_for_range(poly_size, [&](size_t start, size_t end) {
+            for (size_t idx = start; idx < end; ++idx) {
+                values[idx] = static_cast<uint32_t>(static_cast<uint256_t>(polynomial.span[idx]).data[0]);
+            }
+        });
+        return values;
+    }
+
+    /**
+     * @brief Commit to a polynomial with small coefficients by bucketing the points by coefficient value
+     * @details The points are sorted by the value of their scalar and the points in each bucket are summed using
+     * batched affine addition, giving B_v = ∑_{i : aᵢ = v} Gᵢ for each distinct nonzero value v. With the distinct
+     * values v₁ < ... < vₘ (and v₀ = 0), the commitment ∑ᵥ v⋅B_v is then accumulated as ∑ₖ (vₖ - vₖ₋₁)⋅(B_{vₖ} + ... +
+     * B_{vₘ}), which costs only a few group operations per distinct value. Polynomials with coefficients in {0, 1}
+     * reduce to a single batched affine summation.
+     *
+     * @param values The coefficients of the polynomial, each at most MAX_SMALL_SCALAR
+     * @param point_table Point table (raw SRS points at even indices) aligned with the start of the polynomial
+     * @return Commitment
+     */
+    Commitment commit_small_scalars(const std::vector<uint32_t>& values, std::span<G1> point_table)
+    {
+        BB_OP_COUNT_TIME();
+        using Element = typename Curve::Element;
+        using BatchedAddition = BatchedAffineAddition<Curve>;
+
+        const size_t poly_size = values.size();
+        const uint32_t max_value = *std::max_element(values.begin(), values.end());
+        if (max_value == 0) {
+            return Commitment::infinity();
+        }
+
+        // Count the occurrences of each value within each thread's block. Each thread handles at least as many
+        // coefficients as there are possible values so that the counts take no more memory than the coefficients.
+        const size_t num_buckets = static_cast<size_t>(max_value) + 1;
+        const size_t num_threads =
+            calculate_num_threads(poly_size, std::max(num_buckets, static_cast<size_t>(DEFAULT_MIN_ITERS_PER_THREAD)));
+        const size_t block_size = (poly_size + num_threads - 1) / num_threads; // round up
+        std::vector<std::vector<size_t>> thread_bucket_offsets(num_threads);
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            auto& counts = thread_bucket_offsets[thread_idx];
+            counts.assign(num_buckets, 0);
+            const size_t start = thread_idx * block_size;
+            const size_t end = std::min(poly_size, (thread_idx + 1) * block_size);
+            for (size_t idx = start; idx < end; ++idx) {
+                counts[values[idx]]++;
+            }
+        });
+
+        // Convert the counts into the offset at which each thread writes the points of each bucket, skipping the zero
+        // bucket, and record the size and value of each nonempty bucket
+        std::vector<size_t> bucket_sizes;
+        std::vector<uint32_t> bucket_values;
+        size_t num_nonzero_scalars = 0;
+        for (size_t value = 1; value < num_buckets; ++value) {
+            size_t bucket_size = 0;
+            for (auto& offsets : thread_bucket_offsets) {
+                const size_t count = offsets[value];
+                offsets[value] = num_nonzero_scalars + bucket_size;
+                bucket_size += count;
+            }
+            if (bucket_size > 0) {
+                bucket_sizes.emplace_back(bucket_size);
+                bucket_values.emplace_back(static_cast<uint32_t>(value));
+                num_nonzero_scalars += bucket_size;
+            }
+        }
+
+        // Sort the raw SRS points into their buckets
+        std::vector<G1> points(num_nonzero_scalars);
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            auto& offsets = thread_bucket_offsets[thread_idx];
+            const size_t start = thread_idx * block_size;
+            const size_t end = std::min(poly_size, (thread_idx + 1) * block_size);
+            for (size_t idx = start; idx < end; ++idx) {
+                if (values[idx] != 0) {
+                    points[offsets[values[idx]]++] = point_table[idx * 2];
+                }
+            }
+        });
+
+        // Reduce each bucket to a single point
+        auto bucket_sums = BatchedAddition::add_in_place(points, bucket_sizes);
+
+        // Accumulate ∑ₖ (vₖ - vₖ₋₁)⋅(B_{vₖ} + ... + B_{vₘ}) from the largest value down
+        Element running_sum = Element::infinity();
+        Element result = Element::infinity();
+        for (size_t k = bucket_sums.size(); k-- > 0;) {
+            running_sum += bucket_sums[k];
+            uint32_t gap = bucket_values[k] - (k > 0 ? bucket_values[k - 1] : 0);
+            // Double-and-add for the (small) gap
+            Element multiple = running_sum;
+            while (true) {
+                if ((gap & 1) != 0) {
+                    result += multiple;
+                }
+                gap >>= 1;
+                if (gap == 0) {
+                    break;
+                }
+                multiple.self_dbl();
+            }
+        }
+        return result;
+    }
+
     /**
      * @brief Efficiently commit to a sparse polynomial
      * @details Iterate through the {point, scalar} pairs that define the inputs to the commitment MSM, maintain (copy)
@@ -97,6 +97,80 @@ template <typename Curve_> class IPA {
 #ifdef IPA_FUZZ_TEST
    friend class ProxyCaller;
 #endif
+   /**
+    * @brief Fold the vectors of an IPA prover round in a single pass and compute the inner products of the next round
+    *
+    * @details Computes, in place, \f$\vec{G}_{new}=\vec{G}_{low}+u^{-1}\cdot\vec{G}_{high}\f$ (given
+    * \f$u^{-1}\cdot\vec{G}_{high}\f$), \f$\vec{a}_{new}=\vec{a}_{low}+u\cdot\vec{a}_{high}\f$ and
+    * \f$\vec{b}_{new}=\vec{b}_{low}+u^{-1}\cdot\vec{b}_{high}\f$, along with the pippenger point table of
+    * \f$\vec{G}_{new}\f$ used by the MSMs of the next round. Iteration j folds the entries j and j + round_size/2
+    * together, which are exactly the pairs whose products make up the inner products of the next round, so those are
+    * accumulated in the same pass. The points are added with batched affine additions: as in
+    * GroupElement::batch_affine_add, no point of \f$\vec{G}_{low}\f$ may be equal to ± the corresponding point of
+    * \f$u^{-1}\cdot\vec{G}_{high}\f$.
+    *
+    * @param round_size The size of the folded vectors
+    * @return The inner products (< a_vec_new_lo, b_vec_new_hi >, < a_vec_new_hi, b_vec_new_lo >) of the next round
+    */
+   static std::pair<Fr, Fr> fold_round(std::span<Commitment> G_vec,
+                                       std::span<const Commitment> G_hi_by_inverse_challenge,
+                                       std::span<Commitment> G_table,
+                                       bb::Polynomial<Fr>& a_vec,
+                                       std::vector<Fr>& b_vec,
+                                       const size_t round_size,
+                                       const Fr& round_challenge,
+                                       const Fr& round_challenge_inv)
+   {
+       using Fq = typename Curve::BaseField;
+       const Fq beta = Fq::cube_root_of_unity();
+       const size_t next_round_size = round_size / 2;
+       // The final round folds to a single entry, which has no partner
+       const size_t num_iterations = std::max(next_round_size, size_t(1));
+       const size_t entries_per_iteration = round_size == 1 ? 1 : 2;
+
+       std::vector<std::pair<Fr, Fr>> inner_prods(get_num_cpus(), { Fr::zero(), Fr::zero() });
+       parallel_for_heuristic(
+           num_iterations,
+           [&](size_t start, size_t end, size_t chunk_index) {
+               const size_t num_entries = (end - start) * entries_per_iteration;
+               // The entry folded in position k of this chunk
+               const auto entry = [&](size_t k) {
+                   return k < end - start ? start + k : next_round_size + start + (k - (end - start));
+               };
+               // Batch invert the denominators x_hi - x_lo of the point additions
+               std::vector<Fq> denominators(num_entries);
+               for (size_t k = 0; k < num_entries; k++) {
+                   const size_t j = entry(k);
+                   denominators[k] = G_hi_by_inverse_challenge[j].x - G_vec[j].x;
+               }
+               Fq::batch_invert(std::span{ denominators });
+               for (size_t k = 0; k < num_entries; k++) {
+                   const size_t j = entry(k);
+                   const Commitment& lhs = G_vec[j];
+                   const Commitment& rhs = G_hi_by_inverse_challenge[j];
+                   const Fq lambda = (rhs.y - lhs.y) * denominators[k];
+                   Commitment sum;
+                   sum.x = lambda.sqr() - lhs.x - rhs.x;
+                   sum.y = lambda * (lhs.x - sum.x) - lhs.y;
+                   G_vec[j] = sum;
+                   // See generate_pippenger_point_table
+                   G_table[j * 2] = sum;
+                   G_table[j * 2 + 1].x = beta * sum.x;
+                   G_table[j * 2 + 1].y = -sum.y;
+
+                   a_vec.at(j) += round_challenge * a_vec[round_size + j];
+                   b_vec[j] += round_challenge_inv * b_vec[round_size + j];
+               }
+               if (next_round_size > 0) {
+                   for (size_t j = start; j < end; j++) {
+                       inner_prods[chunk_index].first += a_vec[j] * b_vec[next_round_size + j];
+                       inner_prods[chunk_index].second += a_vec[next_round_size + j] * b_vec[j];
+                   }
+               }
+           }, thread_heuristics::FF_MULTIPLICATION_COST * 24 + thread_heuristics::FF_ADDITION_COST * 14);
+       return sum_pairs(inner_prods);
+   }
+
    /**
     * @brief Compute an inner product argument proof for opening a single polynomial at a single evaluation point.
     *
@@ -169,6 +243,9 @@ template <typename Curve_> class IPA {
         auto a_vec = polynomial.full();
         std::span<Commitment> srs_elements = ck->srs->get_monomial_points();
         std::vector<Commitment> G_vec_local(poly_length);
+        // The pippenger point table of G_vec_local, kept up to date by fold_round so that the MSMs of each round don't
+        // have to allocate and compute their own
+        std::vector<Commitment> G_table(poly_length * 2);
 
         if (poly_length * 2 > srs_elements.size()) {
             throw_or_abort("potential bug: Not enough SRS points for IPA!");
@@ -176,12 +253,15 @@ template <typename Curve_> class IPA {
 
         // The SRS stored in the commitment key is the result after applying the pippenger point table so the
         // values at odd indices contain the point {srs[i-1].x * beta, srs[i-1].y}, where beta is the endomorphism
-        // G_vec_local should use only the original SRS thus we extract only the even indices.
+        // G_vec_local should use only the original SRS thus we extract only the even indices, while its point table is
+        // a prefix of the SRS.
         parallel_for_heuristic(
             poly_length,
             [&](size_t i) {
                 G_vec_local[i] = srs_elements[i * 2];
-            }, thread_heuristics::FF_COPY_COST);
+                G_table[i * 2] = srs_elements[i * 2];
+                G_table[i * 2 + 1] = srs_elements[i * 2 + 1];
+            }, thread_heuristics::FF_COPY_COST * 3);
 
         // Step 5.
         // Compute vector b (vector of the powers of the challenge)
@@ -208,33 +288,39 @@ template <typename Curve_> class IPA {
         GroupElement R_i;
         std::size_t round_size = poly_length;
 
+        // The inner products of the first round. Those of later rounds are accumulated by fold_round
+        auto inner_prods = parallel_for_heuristic(
+            poly_length / 2,
+            std::pair{Fr::zero(), Fr::zero()},
+            [&](size_t j, std::pair<Fr, Fr>& inner_prod_left_right) {
+                // Compute inner_prod_L := < a_vec_lo, b_vec_hi >
+                inner_prod_left_right.first += a_vec[j] * b_vec[poly_length / 2 + j];
+                // Compute inner_prod_R := < a_vec_hi, b_vec_lo >
+                inner_prod_left_right.second += a_vec[poly_length / 2 + j] * b_vec[j];
+            }, thread_heuristics::FF_ADDITION_COST * 2 + thread_heuristics::FF_MULTIPLICATION_COST * 2);
+        // Sum inner product contributions computed in parallel and unpack the std::pair
+        auto [inner_prod_L, inner_prod_R] = sum_pairs(inner_prods);
+
         // Step 6.
         // Perform IPA reduction rounds
         for (size_t i = 0; i < log_poly_length; i++) {
             round_size /= 2;
-            // Run scalar products in parallel
-            auto inner_prods = parallel_for_heuristic(
-                round_size,
-                std::pair{Fr::zero(), Fr::zero()},
-                [&](size_t j, std::pair<Fr, Fr>& inner_prod_left_right) {
-                    // Compute inner_prod_L := < a_vec_lo, b_vec_hi >
-                    inner_prod_left_right.first += a_vec[j] * b_vec[round_size + j];
-                    // Compute inner_prod_R := < a_vec_hi, b_vec_lo >
-                    inner_prod_left_right.second += a_vec[round_size + j] * b_vec[j];
-                }, thread_heuristics::FF_ADDITION_COST * 2 + thread_heuristics::FF_MULTIPLICATION_COST * 2);
-            // Sum inner product contributions computed in parallel and unpack the std::pair
-            auto [inner_prod_L, inner_prod_R] = sum_pairs(inner_prods);
-            // Step 6.a (using letters, because doxygen automatically converts the sublist counters to letters :( )
-            // L_i = < a_vec_lo, G_vec_hi > + inner_prod_L * aux_generator
-            L_i = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                {0, {&a_vec.at(0), /*size*/ round_size}}, {&G_vec_local[round_size], /*size*/ round_size}, ck->pippenger_runtime_state);
-            L_i += aux_generator * inner_prod_L;
-
-            // Step 6.b
-            // R_i = < a_vec_hi, G_vec_lo > + inner_prod_R * aux_generator
-            R_i = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                {0, {&a_vec.at(round_size), /*size*/ round_size}}, {&G_vec_local[0], /*size*/ round_size}, ck->pippenger_runtime_state);
-            R_i += aux_generator * inner_prod_R;
+            const std::span<const Commitment> G_table_lo{ G_table.data(), round_size * 2 };
+            const std::span<const Commitment> G_table_hi{ G_table.data() + round_size * 2, round_size * 2 };
+            {
+                PROFILE_THIS_NAME("IPA::compute_L_R");
+                // Step 6.a (using letters, because doxygen automatically converts the sublist counters to letters :( )
+                // L_i = < a_vec_lo, G_vec_hi > + inner_prod_L * aux_generator
+                L_i = bb::scalar_multiplication::pippenger<Curve>(
+                    {0, {&a_vec.at(0), /*size*/ round_size}}, G_table_hi, ck->pippenger_runtime_state, false);
+                L_i += aux_generator * inner_prod_L;
+
+                // Step 6.b
+                // R_i = < a_vec_hi, G_vec_lo > + inner_prod_R * aux_generator
+                R_i = bb::scalar_multiplication::pippenger<Curve>(
+                    {0, {&a_vec.at(round_size), /*size*/ round_size}}, G_table_lo, ck->pippenger_runtime_state, false);
+                R_i += aux_generator * inner_prod_R;
+            }
 
             // Step 6.c
             // Send commitments to the verifier
@@ -251,27 +337,23 @@ template <typename Curve_> class IPA {
             }
             const Fr round_challenge_inv = round_challenge.invert();
 
-            // Step 6.e
+            PROFILE_THIS_NAME("IPA::fold");
+            // Steps 6.e, 6.f and 6.g
             // G_vec_new = G_vec_lo + G_vec_hi * round_challenge_inv
+            // a_vec_new = a_vec_lo + a_vec_hi * round_challenge
+            // b_vec_new = b_vec_lo + b_vec_hi * round_challenge_inv
             auto G_hi_by_inverse_challenge = GroupElement::batch_mul_with_endomorphism(
                 std::span{ G_vec_local.begin() + static_cast<std::ptrdiff_t>(round_size),
                            G_vec_local.begin() + static_cast<std::ptrdiff_t>(round_size * 2) },
                 round_challenge_inv);
-            GroupElement::batch_affine_add(
-                std::span{ G_vec_local.begin(), G_vec_local.begin() + static_cast<std::ptrdiff_t>(round_size) },
-                G_hi_by_inverse_challenge,
-                G_vec_local);
-
-            // Steps 6.e and 6.f
-            // Update the vectors a_vec, b_vec.
-            // a_vec_new = a_vec_lo + a_vec_hi * round_challenge
-            // b_vec_new = b_vec_lo + b_vec_hi * round_challenge_inv
-            parallel_for_heuristic(
-                round_size,
-                [&](size_t j) {
-                    a_vec.at(j) += round_challenge * a_vec[round_size + j];
-                    b_vec[j] += round_challenge_inv * b_vec[round_size + j];
-                }, thread_heuristics::FF_ADDITION_COST * 2 + thread_heuristics::FF_MULTIPLICATION_COST * 2);
+            std::tie(inner_prod_L, inner_prod_R) = fold_round(G_vec_local,
+                                                              G_hi_by_inverse_challenge,
+                                                              G_table,
+                                                              a_vec,
+                                                              b_vec,
+                                                              round_size,
+                                                              round_challenge,
+                                                              round_challenge_inv);
         }
 
         // For dummy rounds, send commitments of zero()
@@ -296,6 +296,79 @@ TYPED_TEST(CommitmentKeyTest, CommitSparseMediumNonZeroStartIndex)
     EXPECT_EQ(sparse_commit_result, commit_result);
 }
 
+/**
+ * @brief Check that commit gives the same result with and without a fixed base table, including for polynomials that
+ * extend beyond the table
+ */
+TYPED_TEST(CommitmentKeyTest, CommitFixedBase)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using G1 = Curve::AffineElement;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 1 << 12;
+    const size_t table_size = 1 << 11;
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+
+    std::vector<Polynomial> polynomials;
+    polynomials.emplace_back(Polynomial::random(table_size));
+    polynomials.emplace_back(Polynomial::random(table_size - 100, num_points, /*start_index=*/50));
+    polynomials.emplace_back(Polynomial::random(num_points));
+
+    std::vector<G1> expected;
+    for (auto& poly : polynomials) {
+        expected.emplace_back(key->commit(poly));
+    }
+    key->enable_fixed_base_msm(table_size, /*window_bits=*/10);
+    for (auto [poly, expected_commitment] : zip_view(polynomials, expected)) {
+        EXPECT_EQ(key->commit(poly), expected_commitment);
+    }
+}
+
+/**
+ * @brief Check that commit, which uses commit_small_scalars for polynomials with small coefficients, agrees with
+ * pippenger (via commit_sparse) for random small, boolean and maximal small coefficients, with and without an offset.
+ */
+TYPED_TEST(CommitmentKeyTest, CommitSmallScalars)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using G1 = Curve::AffineElement;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 1 << 12;
+    const size_t offset = 1 << 10;
+    auto& engine = numeric::get_debug_randomness();
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+
+    for (const uint64_t max_value : { uint64_t(1), uint64_t(1000), CK::MAX_SMALL_SCALAR }) {
+        for (const size_t start_index : { size_t(0), offset }) {
+            // Construct a polynomial with coefficients in [0, max_value] (roughly half of them zero)
+            const size_t size = num_points - offset - 3;
+            Polynomial poly(size, num_points, start_index);
+            for (size_t i = start_index; i < start_index + size; ++i) {
+                if ((engine.get_random_uint32() & 1) != 0) {
+                    poly.at(i) = engine.get_random_uint64() % max_value + 1;
+                }
+            }
+            poly.at(start_index + 1) = max_value;
+            ASSERT_TRUE(CK::get_small_scalars(poly).has_value());
+
+            G1 commit_result = key->commit(poly);
+            G1 sparse_commit_result = key->commit_sparse(poly);
+            EXPECT_EQ(commit_result, sparse_commit_result);
+        }
+    }
+
+    // A single coefficient that is too large disables the small scalar path
+    Polynomial poly(num_points);
+    poly.at(num_points - 1) = CK::MAX_SMALL_SCALAR + 1;
+    EXPECT_FALSE(CK::get_small_scalars(poly).has_value());
+}
+
 /**
  * @brief Test commit_structured on polynomial with blocks of non-zero values (like wires when using structured trace)
  *
@@ -0,0 +1,61 @@
+#pragma once
+
+#if defined(__x86_64__) && !defined(__wasm__)
+#include <cpuid.h>
+#define BB_X86_64_INTRINSICS
+#endif
+
+namespace bb {
+
+/**
+ * @brief Instruction set extensions available at runtime
+ *
+ * @details Hardware accelerated code paths are compiled with function level target attributes (the default build
+ * targets skylake, which lacks e.g. the SHA extensions) and selected at runtime on the features reported here. All
+ * flags are false on non x86-64 targets, where the portable implementations are used.
+ */
+struct CpuFeatures {
+    bool ssse3 = false;
+    bool sse41 = false;
+    bool aes = false;
+    bool avx2 = false;
+    bool sha = false;
+};
+
+inline CpuFeatures detect_cpu_features()
+{
+    CpuFeatures features;
+#ifdef BB_X86_64_INTRINSICS
+    unsigned int eax = 0;
+    unsigned int ebx = 0;
+    unsigned int ecx = 0;
+    unsigned int edx = 0;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0) {
+        return features;
+    }
+    features.ssse3 = (ecx & (1U << 9)) != 0;
+    features.sse41 = (ecx & (1U << 19)) != 0;
+    features.aes = (ecx & (1U << 25)) != 0;
+    // AVX registers are only usable if the OS saves them on context switches (OSXSAVE and XCR0 bits 1 and 2)
+    bool os_saves_ymm = false;
+    if ((ecx & (1U << 27)) != 0) {
+        unsigned int xcr0_low = 0;
+        unsigned int xcr0_high = 0;
+        __asm__("xgetbv" : "=a"(xcr0_low), "=d"(xcr0_high) : "c"(0));
+        os_saves_ymm = (xcr0_low & 6U) == 6U;
+    }
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) != 0) {
+        features.avx2 = os_saves_ymm && (ebx & (1U << 5)) != 0;
+        features.sha = (ebx & (1U << 29)) != 0;
+    }
+#endif
+    return features;
+}
+
+inline const CpuFeatures& get_cpu_features()
+{
+    static const CpuFeatures features = detect_cpu_features();
+    return features;
+}
+
+} // namespace bb
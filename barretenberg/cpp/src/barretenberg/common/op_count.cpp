@@ -2,6 +2,7 @@
 #include <cstddef>
 #ifdef BB_USE_OP_COUNT
 #include "op_count.hpp"
+#include "barretenberg/common/peak_memory.hpp"
 #include <iostream>
 #include <sstream>
 #include <thread>
@@ -38,6 +39,10 @@ void GlobalOpCountContainer::print() const
             std::cout << entry.key << "(c)\t" << entry.count->cycles << "\t[thread=" << entry.thread_id << "]"
                       << std::endl;
         }
+        if (entry.count->memory > 0) {
+            std::cout << entry.key << "(m)\t" << static_cast<double>(entry.count->memory) / (1024.0 * 1024.0)
+                      << "MiB\t[thread=" << entry.thread_id << "]" << std::endl;
+        }
     }
     std::cout << "print_op_counts() END" << std::endl;
 }
@@ -55,6 +60,11 @@ std::map<std::string, std::size_t> GlobalOpCountContainer::get_aggregate_counts(
         if (entry.count->cycles > 0) {
             aggregate_counts[entry.key + "(c)"] += entry.count->cycles;
         }
+        if (entry.count->memory > 0) {
+            // Peaks do not add up
+            auto& memory = aggregate_counts[entry.key + "(m)"];
+            memory = std::max(memory, entry.count->memory);
+        }
     }
     return aggregate_counts;
 }
@@ -100,5 +110,17 @@ OpCountTimeReporter::~OpCountTimeReporter()
     stats->count += 1;
     stats->time += static_cast<std::size_t>(now_ns.time_since_epoch().count()) - time;
 }
+OpCountMemoryReporter::OpCountMemoryReporter(OpStats* stats)
+    : stats(stats)
+{
+    memory = get_current_rss_bytes();
+    push_peak_rss_scope();
+}
+OpCountMemoryReporter::~OpCountMemoryReporter()
+{
+    const std::size_t peak = pop_peak_rss_scope();
+    stats->count += 1;
+    stats->memory = std::max(stats->memory, peak > memory ? peak - memory : 0);
+}
 } // namespace bb::detail
 #endif
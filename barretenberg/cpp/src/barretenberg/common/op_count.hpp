@@ -29,6 +29,8 @@
 #define BB_OP_COUNT_CYCLES() (void)0
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define BB_OP_COUNT_TIME() (void)0
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define BB_OP_COUNT_MEMORY_NAME(name) (void)0
 #else
 /**
  * Provides an abstraction that counts operations based on function names.
@@ -63,6 +65,8 @@ struct OpStats {
     std::size_t count = 0;
     std::size_t time = 0;
     std::size_t cycles = 0;
+    // Largest peak resident set size above the one at the start of the operation, in bytes
+    std::size_t memory = 0;
 };
 
 // Contains all statically known op counts
@@ -154,6 +158,14 @@ struct OpCountTimeReporter {
     OpCountTimeReporter(OpStats* stats);
     ~OpCountTimeReporter();
 };
+// Measures the peak memory of a stage of a proof (e.g. a prover round). Stages may be nested, on any number of threads.
+// NOLINTNEXTLINE(cppcoreguidelines-special-member-functions)
+struct OpCountMemoryReporter {
+    OpStats* stats;
+    std::size_t memory;
+    OpCountMemoryReporter(OpStats* stats);
+    ~OpCountMemoryReporter();
+};
 } // namespace bb::detail
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
@@ -170,4 +182,7 @@ struct OpCountTimeReporter {
     bb::detail::OpCountTimeReporter __bb_op_count_time(bb::detail::GlobalOpCount<name>::ensure_stats())
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define BB_OP_COUNT_TIME() BB_OP_COUNT_TIME_NAME(__func__)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define BB_OP_COUNT_MEMORY_NAME(name)                                                                                  \
+    bb::detail::OpCountMemoryReporter __bb_op_count_memory(bb::detail::GlobalOpCount<name>::ensure_stats())
 #endif
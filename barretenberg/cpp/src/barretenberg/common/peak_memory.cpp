@@ -0,0 +1,121 @@
+#include "peak_memory.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace bb {
+namespace {
+
+// Reads a "<field>:    <value> kB" line from /proc/self/status.
+size_t read_proc_status_kb(const std::string& field)
+{
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind(field + ":", 0) == 0) {
+            return static_cast<size_t>(std::stoull(line.substr(field.size() + 1)));
+        }
+    }
+#else
+    static_cast<void>(field);
+#endif
+    return 0;
+}
+
+void reset_kernel_peak_rss()
+{
+#ifdef __linux__
+    // Writing 5 to clear_refs resets VmHWM to VmRSS, see proc(5).
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5";
+#endif
+}
+
+// Peaks seen before the kernel's peak was reset by a scope, for get_peak_rss_bytes() and for each open scope. The
+// scopes of all threads are kept in one list, since the kernel's peak is that of the whole process, but each thread
+// only ever closes the innermost of its own scopes.
+struct PeakRssScopes {
+#ifndef NO_MULTITHREADING
+    std::mutex mutex;
+#endif
+    size_t peak_before_reset = 0;
+    std::vector<std::pair<std::thread::id, size_t>> scope_peaks;
+
+    // Folds the kernel's peak into every measurement in progress and resets it. Requires the lock.
+    void fold_and_reset()
+    {
+        const size_t peak = read_proc_status_kb("VmHWM") * 1024;
+        peak_before_reset = std::max(peak_before_reset, peak);
+        for (auto& [thread_id, scope_peak] : scope_peaks) {
+            scope_peak = std::max(scope_peak, peak);
+        }
+        reset_kernel_peak_rss();
+    }
+};
+
+PeakRssScopes& get_peak_rss_scopes()
+{
+    static PeakRssScopes scopes;
+    return scopes;
+}
+
+} // namespace
+
+size_t get_peak_rss_bytes()
+{
+    auto& scopes = get_peak_rss_scopes();
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(scopes.mutex);
+#endif
+    return std::max(scopes.peak_before_reset, read_proc_status_kb("VmHWM") * 1024);
+}
+
+size_t get_current_rss_bytes()
+{
+    return read_proc_status_kb("VmRSS") * 1024;
+}
+
+void reset_peak_rss()
+{
+    auto& scopes = get_peak_rss_scopes();
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(scopes.mutex);
+#endif
+    scopes.peak_before_reset = 0;
+    reset_kernel_peak_rss();
+}
+
+void push_peak_rss_scope()
+{
+    auto& scopes = get_peak_rss_scopes();
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(scopes.mutex);
+#endif
+    scopes.fold_and_reset();
+    scopes.scope_peaks.emplace_back(std::this_thread::get_id(), 0);
+}
+
+size_t pop_peak_rss_scope()
+{
+    auto& scopes = get_peak_rss_scopes();
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(scopes.mutex);
+#endif
+    const auto scope = std::find_if(scopes.scope_peaks.rbegin(), scopes.scope_peaks.rend(), [](const auto& scope) {
+        return scope.first == std::this_thread::get_id();
+    });
+    if (scope == scopes.scope_peaks.rend()) {
+        return 0;
+    }
+    const size_t peak = std::max(scope->second, read_proc_status_kb("VmHWM") * 1024);
+    scopes.scope_peaks.erase(std::next(scope).base());
+    return peak;
+}
+
+} // namespace bb
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+
+namespace bb {
+
+/**
+ * @brief Returns the peak resident set size (VmHWM) of the process in bytes, or 0 if it cannot be determined.
+ */
+size_t get_peak_rss_bytes();
+
+/**
+ * @brief Returns the current resident set size (VmRSS) of the process in bytes, or 0 if it cannot be determined.
+ */
+size_t get_current_rss_bytes();
+
+/**
+ * @brief Resets the peak resident set size to the current one so that the next get_peak_rss_bytes() only reflects
+ * what happened since. This is a no-op where the kernel does not support it.
+ */
+void reset_peak_rss();
+
+/**
+ * @brief Opens a nested measurement of the peak resident set size, to be closed by pop_peak_rss_scope().
+ * @details Scopes reset the kernel's peak internally, but fold what it had seen into get_peak_rss_bytes() and into the
+ * enclosing scopes, so measurements of a stage can be taken inside of a measurement of the whole.
+ */
+void push_peak_rss_scope();
+
+/**
+ * @brief Closes the innermost scope opened by push_peak_rss_scope() on the calling thread and returns the peak resident
+ * set size in bytes since it was opened.
+ * @details Scopes nest per thread, so several threads may measure their stages at once. The peak is that of the whole
+ * process, i.e. it includes the memory used by other threads meanwhile.
+ */
+size_t pop_peak_rss_scope();
+
+} // namespace bb
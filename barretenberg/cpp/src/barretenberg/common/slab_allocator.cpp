@@ -20,6 +20,10 @@ namespace {
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 bool allocator_destroyed = false;
 
+// Slabs back point tables of affine elements, which are declared alignas(64), so a smaller alignment lets aligned
+// vector loads of 512-bit registers fault.
+constexpr size_t SLAB_ALIGNMENT = 64;
+
 // Slabs that are being manually managed by the user.
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 std::unordered_map<void*, std::shared_ptr<void>> manual_slabs;
@@ -131,7 +135,7 @@ void SlabAllocator::init(size_t circuit_size_hint)
     for (auto& e : prealloc_num) {
         for (size_t i = 0; i < e.second; ++i) {
             auto size = e.first;
-            memory_store[size].push_back(aligned_alloc(32, size));
+            memory_store[size].push_back(aligned_alloc(SLAB_ALIGNMENT, size));
             dbg_info("Allocated memory slab of size: ", size, " total: ", get_total_size());
         }
     }
@@ -179,7 +183,7 @@ std::shared_ptr<void> SlabAllocator::get(size_t req_size)
         dbg_info("WARNING: Allocating unmanaged memory slab of size: ", req_size);
     }
     if (req_size % 32 == 0) {
-        return { aligned_alloc(32, req_size), aligned_free };
+        return { aligned_alloc(SLAB_ALIGNMENT, req_size), aligned_free };
     }
     // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
     return { tracy_malloc(req_size), tracy_free };
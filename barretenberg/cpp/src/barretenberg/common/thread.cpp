@@ -1,5 +1,6 @@
 #include "thread.hpp"
 #include "log.hpp"
+#include <utility>
 
 /**
  * There's a lot to talk about here. To bring threading to WASM, parallel_for was written to replace the OpenMP loops
@@ -69,6 +70,27 @@ void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(si
 
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
 
+namespace {
+// Whether the current thread is executing an iteration of a parallel_for
+thread_local bool in_parallel_for_iteration = false;
+// Whether the current thread is in a SerialParallelForScope, in which case its parallel_for calls run serially
+thread_local bool in_serial_parallel_for_scope = false;
+} // namespace
+
+bool is_in_parallel_for()
+{
+    return in_parallel_for_iteration;
+}
+
+SerialParallelForScope::SerialParallelForScope()
+    : was_serial(std::exchange(in_serial_parallel_for_scope, true))
+{}
+
+SerialParallelForScope::~SerialParallelForScope()
+{
+    in_serial_parallel_for_scope = was_serial;
+}
+
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
 {
 #ifdef NO_MULTITHREADING
@@ -76,14 +98,26 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
         func(i);
     }
 #else
+    const std::function<void(size_t)> iteration = [&func](size_t i) {
+        const bool was_in_parallel_for = std::exchange(in_parallel_for_iteration, true);
+        func(i);
+        in_parallel_for_iteration = was_in_parallel_for;
+    };
+    // Nested calls made outside of a SerialParallelForScope still reach the thread pool, which rejects them
+    if (in_serial_parallel_for_scope) {
+        for (size_t i = 0; i < num_iterations; ++i) {
+            iteration(i);
+        }
+        return;
+    }
 #ifndef NO_OMP_MULTITHREADING
-    parallel_for_omp(num_iterations, func);
+    parallel_for_omp(num_iterations, iteration);
 #else
-    // parallel_for_spawning(num_iterations, func);
-    // parallel_for_moody(num_iterations, func);
-    // parallel_for_atomic_pool(num_iterations, func);
-    parallel_for_mutex_pool(num_iterations, func);
-    // parallel_for_queued(num_iterations, func);
+    // parallel_for_spawning(num_iterations, iteration);
+    // parallel_for_moody(num_iterations, iteration);
+    // parallel_for_atomic_pool(num_iterations, iteration);
+    parallel_for_mutex_pool(num_iterations, iteration);
+    // parallel_for_queued(num_iterations, iteration);
 #endif
 #endif
 }
@@ -28,6 +28,33 @@ inline size_t get_num_cpus_pow2()
  * The size will be chosen based on the hardware concurrency (i.e., env or cpus).
  */
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func);
+
+/**
+ * @brief Whether the calling thread is executing an iteration of a parallel_for.
+ * @details Nested parallel_for calls are not supported, so code that parallelises internally (e.g. batch inversion)
+ * uses this to fall back to serial processing when it is itself called from within a parallel loop.
+ */
+bool is_in_parallel_for();
+
+/**
+ * @brief While an instance is alive, parallel_for calls made by the current thread run serially on that thread
+ * @details For a thread of its own that runs alongside multithreaded work (e.g. the construction of the next circuit
+ * while the previous one is being proven), which must not enter the shared thread pool concurrently with it. Nested
+ * parallel_for calls made anywhere else remain an error.
+ */
+class SerialParallelForScope {
+  public:
+    SerialParallelForScope();
+    SerialParallelForScope(const SerialParallelForScope&) = delete;
+    SerialParallelForScope(SerialParallelForScope&&) = delete;
+    SerialParallelForScope& operator=(const SerialParallelForScope&) = delete;
+    SerialParallelForScope& operator=(SerialParallelForScope&&) = delete;
+    ~SerialParallelForScope();
+
+  private:
+    bool was_serial;
+};
+
 void parallel_for_range(size_t num_points,
                         const std::function<void(size_t, size_t)>& func,
                         size_t no_multhreading_if_less_or_equal = 0);
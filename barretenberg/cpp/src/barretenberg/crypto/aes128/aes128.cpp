@@ -1,10 +1,16 @@
 #include "aes128.hpp"
 
+#include "barretenberg/common/cpu_features.hpp"
 #include "memory.h"
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
 
+#ifdef BB_X86_64_INTRINSICS
+#include <immintrin.h>
+#endif
+
 #include <iostream>
 
 namespace {
@@ -224,7 +230,8 @@ void aes128_cipher(uint8_t* state, const uint8_t* round_key)
     add_round_key(state, round_key, 10);
 }
 
-void aes128_encrypt_buffer_cbc(uint8_t* buffer, uint8_t* iv, const uint8_t* key, const size_t length)
+namespace detail {
+void aes128_encrypt_buffer_cbc_portable(uint8_t* buffer, uint8_t* iv, const uint8_t* key, const size_t length)
 {
     uint8_t round_key[176];
     aes128_expand_key(key, round_key);
@@ -244,7 +251,7 @@ void aes128_encrypt_buffer_cbc(uint8_t* buffer, uint8_t* iv, const uint8_t* key,
     }
 }
 
-void aes128_decrypt_buffer_cbc(uint8_t* buffer, uint8_t* iv, const uint8_t* key, const size_t length)
+void aes128_decrypt_buffer_cbc_portable(uint8_t* buffer, uint8_t* iv, const uint8_t* key, const size_t length)
 {
     uint8_t round_key[176];
     aes128_expand_key(key, round_key);
@@ -262,4 +269,166 @@ void aes128_decrypt_buffer_cbc(uint8_t* buffer, uint8_t* iv, const uint8_t* key,
     }
 }
 
-} // namespace bb::crypto
\ No newline at end of file
+} // namespace detail
+#ifdef BB_X86_64_INTRINSICS
+namespace {
+/**
+ * @brief CBC encrypt num_blocks blocks of each of the lane buffers with AES-NI
+ *
+ * @details Each block depends on the previous one, so the blocks of one buffer are encrypted one after another. The
+ * lanes are independent, so interleaving them hides the latency of the aesenc instructions.
+ */
+template <size_t LANES>
+__attribute__((target("aes"))) void encrypt_buffers_cbc_ni(const std::array<uint8_t*, LANES>& buffers,
+                                                           const std::array<uint8_t*, LANES>& ivs,
+                                                           const std::array<const uint8_t*, LANES>& round_keys,
+                                                           const size_t num_blocks)
+{
+    __m128i keys[LANES][11];
+    __m128i chain[LANES];
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        for (size_t round = 0; round < 11; ++round) {
+            keys[lane][round] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(round_keys[lane] + round * 16));
+        }
+        chain[lane] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ivs[lane]));
+    }
+
+    for (size_t i = 0; i < num_blocks; ++i) {
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buffers[lane] + i * 16));
+            chain[lane] = _mm_xor_si128(_mm_xor_si128(block, chain[lane]), keys[lane][0]);
+        }
+        for (size_t round = 1; round < 10; ++round) {
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                chain[lane] = _mm_aesenc_si128(chain[lane], keys[lane][round]);
+            }
+        }
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            chain[lane] = _mm_aesenclast_si128(chain[lane], keys[lane][10]);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(buffers[lane] + i * 16), chain[lane]);
+        }
+    }
+
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(ivs[lane]), chain[lane]);
+    }
+}
+
+/**
+ * @brief CBC decrypt a buffer with AES-NI
+ *
+ * @details Unlike encryption, the block decryptions are independent (each plaintext block is the decrypted block xored
+ * with the previous ciphertext block), so DECRYPT_LANES consecutive blocks are decrypted together.
+ */
+__attribute__((target("aes"))) void decrypt_buffer_cbc_ni(uint8_t* buffer,
+                                                          uint8_t* iv,
+                                                          const uint8_t* round_key,
+                                                          const size_t num_blocks)
+{
+    constexpr size_t DECRYPT_LANES = 4;
+
+    // The equivalent inverse cipher uses the round keys in reverse order, passed through InvMixColumns
+    __m128i keys[11];
+    keys[0] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(round_key + 160));
+    for (size_t round = 1; round < 10; ++round) {
+        const auto* encryption_key = reinterpret_cast<const __m128i*>(round_key + (10 - round) * 16);
+        keys[round] = _mm_aesimc_si128(_mm_loadu_si128(encryption_key));
+    }
+    keys[10] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(round_key));
+
+    __m128i previous = _mm_loadu_si128(reinterpret_cast<const __m128i*>(iv));
+    size_t i = 0;
+    for (; i < num_blocks; i += DECRYPT_LANES) {
+        const size_t lanes = std::min(DECRYPT_LANES, num_blocks - i);
+        __m128i ciphertext[DECRYPT_LANES];
+        __m128i state[DECRYPT_LANES];
+        for (size_t lane = 0; lane < lanes; ++lane) {
+            ciphertext[lane] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer + (i + lane) * 16));
+            state[lane] = _mm_xor_si128(ciphertext[lane], keys[0]);
+        }
+        for (size_t round = 1; round < 10; ++round) {
+            for (size_t lane = 0; lane < lanes; ++lane) {
+                state[lane] = _mm_aesdec_si128(state[lane], keys[round]);
+            }
+        }
+        for (size_t lane = 0; lane < lanes; ++lane) {
+            state[lane] = _mm_xor_si128(_mm_aesdeclast_si128(state[lane], keys[10]), previous);
+            previous = ciphertext[lane];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(buffer + (i + lane) * 16), state[lane]);
+        }
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(iv), previous);
+}
+} // namespace
+#endif
+
+void aes128_encrypt_buffer_cbc(uint8_t* buffer, uint8_t* iv, const uint8_t* key, const size_t length)
+{
+#ifdef BB_X86_64_INTRINSICS
+    if (get_cpu_features().aes) {
+        uint8_t round_key[176];
+        aes128_expand_key(key, round_key);
+        encrypt_buffers_cbc_ni<1>({ buffer }, { iv }, { round_key }, length / 16);
+        return;
+    }
+#endif
+    detail::aes128_encrypt_buffer_cbc_portable(buffer, iv, key, length);
+}
+
+void aes128_decrypt_buffer_cbc(uint8_t* buffer, uint8_t* iv, const uint8_t* key, const size_t length)
+{
+#ifdef BB_X86_64_INTRINSICS
+    if (get_cpu_features().aes) {
+        uint8_t round_key[176];
+        aes128_expand_key(key, round_key);
+        decrypt_buffer_cbc_ni(buffer, iv, round_key, length / 16);
+        return;
+    }
+#endif
+    detail::aes128_decrypt_buffer_cbc_portable(buffer, iv, key, length);
+}
+
+void aes128_encrypt_buffers_cbc(uint8_t* const* buffers,
+                                uint8_t* const* ivs,
+                                const uint8_t* const* keys,
+                                const size_t* lengths,
+                                const size_t num_buffers)
+{
+#ifdef BB_X86_64_INTRINSICS
+    if (get_cpu_features().aes) {
+        constexpr size_t LANES = 4;
+        size_t i = 0;
+        for (; i + LANES <= num_buffers; i += LANES) {
+            uint8_t round_keys[LANES][176];
+            std::array<uint8_t*, LANES> lane_buffers;
+            std::array<uint8_t*, LANES> lane_ivs;
+            std::array<const uint8_t*, LANES> lane_round_keys;
+            size_t common_blocks = lengths[i] / 16;
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                aes128_expand_key(keys[i + lane], round_keys[lane]);
+                lane_buffers[lane] = buffers[i + lane];
+                lane_ivs[lane] = ivs[i + lane];
+                lane_round_keys[lane] = round_keys[lane];
+                common_blocks = std::min(common_blocks, lengths[i + lane] / 16);
+            }
+            // Encrypt the blocks that all buffers of the group have together, and the remaining blocks one at a time
+            encrypt_buffers_cbc_ni<LANES>(lane_buffers, lane_ivs, lane_round_keys, common_blocks);
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                encrypt_buffers_cbc_ni<1>({ lane_buffers[lane] + common_blocks * 16 },
+                                          { lane_ivs[lane] },
+                                          { lane_round_keys[lane] },
+                                          lengths[i + lane] / 16 - common_blocks);
+            }
+        }
+        for (; i < num_buffers; ++i) {
+            aes128_encrypt_buffer_cbc(buffers[i], ivs[i], keys[i], lengths[i]);
+        }
+        return;
+    }
+#endif
+    for (size_t i = 0; i < num_buffers; ++i) {
+        aes128_encrypt_buffer_cbc(buffers[i], ivs[i], keys[i], lengths[i]);
+    }
+}
+
+} // namespace bb::crypto
@@ -21,9 +21,24 @@ void aes128_inverse_cipher(uint8_t* state, const uint8_t* round_key);
 void aes128_cipher(uint8_t* state, const uint8_t* round_key);
 
 // n.b. these methods will update the initialization vector
+// AES-NI is used when the CPU supports it
 void aes128_encrypt_buffer_cbc(uint8_t* buffer, uint8_t* iv, const uint8_t* key, const size_t length);
 void aes128_decrypt_buffer_cbc(uint8_t* buf, uint8_t* iv, const uint8_t* key, const size_t length);
 
+// Encrypt num_buffers independent buffers, each with its own iv and key. Faster than separate calls to
+// aes128_encrypt_buffer_cbc as the sequential block chains of different buffers are interleaved
+void aes128_encrypt_buffers_cbc(uint8_t* const* buffers,
+                                uint8_t* const* ivs,
+                                const uint8_t* const* keys,
+                                const size_t* lengths,
+                                const size_t num_buffers);
+
+namespace detail {
+// The portable implementations, exposed for testing against the hardware accelerated ones
+void aes128_encrypt_buffer_cbc_portable(uint8_t* buffer, uint8_t* iv, const uint8_t* key, const size_t length);
+void aes128_decrypt_buffer_cbc_portable(uint8_t* buffer, uint8_t* iv, const uint8_t* key, const size_t length);
+} // namespace detail
+
 constexpr uint64_t aes128_sparse_base = 9;
 static constexpr uint8_t aes128_sbox[256] = {
     // 0     1    2      3     4    5     6     7      8    9     A      B    C     D     E     F
@@ -1,6 +1,8 @@
 #include "aes128.hpp"
 
 #include <gtest/gtest.h>
+#include <random>
+#include <vector>
 
 using namespace bb;
 
@@ -60,4 +62,82 @@ TEST(aes128, decrypt_buffer_cbc)
     for (size_t i = 0; i < 64; ++i) {
         EXPECT_EQ(in[i], out[i]);
     }
-}
\ No newline at end of file
+}
+// The hardware accelerated paths (where supported) must agree with the portable implementation, including on buffers
+// whose length is not a multiple of the block size
+TEST(aes128, buffer_cbc_matches_portable)
+{
+    std::mt19937 engine(42);
+    for (const size_t length : { 16UL, 64UL, 80UL, 170UL }) {
+        std::vector<uint8_t> buffer(length);
+        uint8_t key[16];
+        uint8_t iv[16];
+        for (auto& byte : buffer) {
+            byte = static_cast<uint8_t>(engine());
+        }
+        for (size_t i = 0; i < 16; ++i) {
+            key[i] = static_cast<uint8_t>(engine());
+            iv[i] = static_cast<uint8_t>(engine());
+        }
+
+        auto expected = buffer;
+        uint8_t expected_iv[16];
+        memcpy(expected_iv, iv, 16);
+        crypto::detail::aes128_encrypt_buffer_cbc_portable(expected.data(), expected_iv, key, length);
+        auto result = buffer;
+        uint8_t result_iv[16];
+        memcpy(result_iv, iv, 16);
+        crypto::aes128_encrypt_buffer_cbc(result.data(), result_iv, key, length);
+        EXPECT_EQ(result, expected);
+        EXPECT_EQ(memcmp(result_iv, expected_iv, 16), 0);
+
+        memcpy(expected_iv, iv, 16);
+        crypto::detail::aes128_decrypt_buffer_cbc_portable(expected.data(), expected_iv, key, length);
+        memcpy(result_iv, iv, 16);
+        crypto::aes128_decrypt_buffer_cbc(result.data(), result_iv, key, length);
+        EXPECT_EQ(result, expected);
+        EXPECT_EQ(memcmp(result_iv, expected_iv, 16), 0);
+        EXPECT_EQ(result, buffer);
+    }
+}
+
+TEST(aes128, encrypt_buffers_cbc)
+{
+    std::mt19937 engine(42);
+    // Buffers of different lengths, and more than a multiple of the number of buffers encrypted together
+    const std::vector<size_t> lengths{ 32, 64, 16, 160, 48, 0, 96 };
+    const size_t num_buffers = lengths.size();
+    std::vector<std::vector<uint8_t>> buffers(num_buffers);
+    std::vector<std::array<uint8_t, 16>> keys(num_buffers);
+    std::vector<std::array<uint8_t, 16>> ivs(num_buffers);
+    for (size_t i = 0; i < num_buffers; ++i) {
+        buffers[i].resize(lengths[i]);
+        for (auto& byte : buffers[i]) {
+            byte = static_cast<uint8_t>(engine());
+        }
+        for (size_t j = 0; j < 16; ++j) {
+            keys[i][j] = static_cast<uint8_t>(engine());
+            ivs[i][j] = static_cast<uint8_t>(engine());
+        }
+    }
+
+    auto expected = buffers;
+    auto expected_ivs = ivs;
+    for (size_t i = 0; i < num_buffers; ++i) {
+        crypto::aes128_encrypt_buffer_cbc(expected[i].data(), expected_ivs[i].data(), keys[i].data(), lengths[i]);
+    }
+
+    std::vector<uint8_t*> buffer_ptrs;
+    std::vector<uint8_t*> iv_ptrs;
+    std::vector<const uint8_t*> key_ptrs;
+    for (size_t i = 0; i < num_buffers; ++i) {
+        buffer_ptrs.push_back(buffers[i].data());
+        iv_ptrs.push_back(ivs[i].data());
+        key_ptrs.push_back(keys[i].data());
+    }
+    crypto::aes128_encrypt_buffers_cbc(
+        buffer_ptrs.data(), iv_ptrs.data(), key_ptrs.data(), lengths.data(), num_buffers);
+
+    EXPECT_EQ(buffers, expected);
+    EXPECT_EQ(ivs, expected_ivs);
+}
@@ -0,0 +1,68 @@
+#include "ecdsa.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace bb;
+using namespace bb::crypto;
+
+namespace {
+
+template <typename Fq, typename Fr, typename G1> struct SignatureBatch {
+    std::vector<std::string> messages;
+    std::vector<typename G1::affine_element> public_keys;
+    std::vector<ecdsa_signature> signatures;
+
+    explicit SignatureBatch(size_t num_signatures)
+    {
+        for (size_t i = 0; i < num_signatures; ++i) {
+            ecdsa_key_pair<Fr, G1> account;
+            account.private_key = Fr::random_element();
+            account.public_key = G1::one * account.private_key;
+            messages.push_back("message " + std::to_string(i));
+            public_keys.push_back(account.public_key);
+            signatures.push_back(ecdsa_construct_signature<Sha256Hasher, Fq, Fr, G1>(messages.back(), account));
+        }
+    }
+};
+
+void set_verification_rate(State& state, size_t num_signatures)
+{
+    state.counters["verifications/s"] =
+        Counter(static_cast<double>(state.iterations()) * static_cast<double>(num_signatures), Counter::kIsRate);
+}
+
+template <typename Fq, typename Fr, typename G1> void verify_individually(State& state) noexcept
+{
+    const auto num_signatures = static_cast<size_t>(state.range(0));
+    const SignatureBatch<Fq, Fr, G1> batch(num_signatures);
+    for (auto _ : state) {
+        for (size_t i = 0; i < num_signatures; ++i) {
+            DoNotOptimize(ecdsa_verify_signature<Sha256Hasher, Fq, Fr, G1>(
+                batch.messages[i], batch.public_keys[i], batch.signatures[i]));
+        }
+    }
+    set_verification_rate(state, num_signatures);
+}
+
+template <typename Fq, typename Fr, typename G1> void verify_batch(State& state) noexcept
+{
+    const auto num_signatures = static_cast<size_t>(state.range(0));
+    const SignatureBatch<Fq, Fr, G1> batch(num_signatures);
+    for (auto _ : state) {
+        DoNotOptimize(ecdsa_verify_signatures_batch<Sha256Hasher, Fq, Fr, G1>(
+            batch.messages, batch.public_keys, batch.signatures));
+    }
+    set_verification_rate(state, num_signatures);
+}
+
+} // namespace
+
+BENCHMARK(verify_individually<secp256k1::fq, secp256k1::fr, secp256k1::g1>)->RangeMultiplier(4)->Range(16, 1024);
+BENCHMARK(verify_batch<secp256k1::fq, secp256k1::fr, secp256k1::g1>)->RangeMultiplier(4)->Range(16, 1024);
+BENCHMARK(verify_individually<secp256r1::fq, secp256r1::fr, secp256r1::g1>)->RangeMultiplier(4)->Range(16, 1024);
+BENCHMARK(verify_batch<secp256r1::fq, secp256r1::fr, secp256r1::g1>)->RangeMultiplier(4)->Range(16, 1024);
+BENCHMARK(verify_individually<grumpkin::fq, grumpkin::fr, grumpkin::g1>)->RangeMultiplier(4)->Range(16, 1024);
+BENCHMARK(verify_batch<grumpkin::fq, grumpkin::fr, grumpkin::g1>)->RangeMultiplier(4)->Range(16, 1024);
+
+BENCHMARK_MAIN();
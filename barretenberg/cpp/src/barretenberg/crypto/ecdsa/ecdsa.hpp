@@ -7,6 +7,7 @@
 #include "barretenberg/serialize/msgpack.hpp"
 #include <array>
 #include <string>
+#include <vector>
 
 namespace bb::crypto {
 template <typename Fr, typename G1> struct ecdsa_key_pair {
@@ -36,6 +37,19 @@ bool ecdsa_verify_signature(const std::string& message,
                             const typename G1::affine_element& public_key,
                             const ecdsa_signature& signature);
 
+/**
+ * @brief Verify a batch of signatures, returning for each signature the result of ecdsa_verify_signature
+ *
+ * @details The R points are recovered from (r, v) and all signatures that pass the individual range checks are verified
+ * at once by checking a random linear combination of their verification equations with a single MSM. If that check
+ * fails, the signatures are verified one at a time to identify the failures, so the result is always that of
+ * ecdsa_verify_signature. Like ecdsa_verify_signature, this throws on a signature with a high s value.
+ */
+template <typename Hash, typename Fq, typename Fr, typename G1>
+std::vector<bool> ecdsa_verify_signatures_batch(const std::vector<std::string>& messages,
+                                                const std::vector<typename G1::affine_element>& public_keys,
+                                                const std::vector<ecdsa_signature>& signatures);
+
 inline bool operator==(ecdsa_signature const& lhs, ecdsa_signature const& rhs)
 {
     return lhs.r == rhs.r && lhs.s == rhs.s && lhs.v == rhs.v;
@@ -179,3 +179,55 @@ TEST(ecdsa, verify_signature_secp256r1_sha256_NIST_1)
         ecdsa_verify_signature<Sha256Hasher, secp256r1::fq, secp256r1::fr, secp256r1::g1>(message, public_key, sig);
     EXPECT_EQ(result, true);
 }
+
+namespace {
+template <typename Fq, typename Fr, typename G1> void test_verify_signatures_batch()
+{
+    const size_t num_signatures = 10;
+    std::vector<std::string> messages;
+    std::vector<typename G1::affine_element> public_keys;
+    std::vector<ecdsa_signature> signatures;
+    for (size_t i = 0; i < num_signatures; ++i) {
+        ecdsa_key_pair<Fr, G1> account;
+        account.private_key = Fr::random_element();
+        account.public_key = G1::one * account.private_key;
+        messages.push_back("message " + std::to_string(i));
+        public_keys.push_back(account.public_key);
+        signatures.push_back(ecdsa_construct_signature<Sha256Hasher, Fq, Fr, G1>(messages.back(), account));
+    }
+
+    auto results = ecdsa_verify_signatures_batch<Sha256Hasher, Fq, Fr, G1>(messages, public_keys, signatures);
+    EXPECT_EQ(results, std::vector<bool>(num_signatures, true));
+
+    // wrong message, wrong public key, inconsistent recovery id (still a valid signature), invalid recovery id (still a
+    // valid signature) and r out of range
+    messages[1] = "another message";
+    std::swap(public_keys[2], public_keys[3]);
+    signatures[5].v ^= 1;
+    signatures[6].v = 0;
+    std::fill(signatures[8].r.begin(), signatures[8].r.end(), 0xff);
+
+    results = ecdsa_verify_signatures_batch<Sha256Hasher, Fq, Fr, G1>(messages, public_keys, signatures);
+    for (size_t i = 0; i < num_signatures; ++i) {
+        EXPECT_EQ(results[i],
+                  (ecdsa_verify_signature<Sha256Hasher, Fq, Fr, G1>(messages[i], public_keys[i], signatures[i])));
+    }
+    const std::vector<bool> expected{ true, false, false, false, true, true, true, true, false, true };
+    EXPECT_EQ(results, expected);
+}
+} // namespace
+
+TEST(ecdsa, verify_signatures_batch_secp256k1)
+{
+    test_verify_signatures_batch<secp256k1::fq, secp256k1::fr, secp256k1::g1>();
+}
+
+TEST(ecdsa, verify_signatures_batch_secp256r1)
+{
+    test_verify_signatures_batch<secp256r1::fq, secp256r1::fr, secp256r1::g1>();
+}
+
+TEST(ecdsa, verify_signatures_batch_grumpkin)
+{
+    test_verify_signatures_batch<grumpkin::fq, grumpkin::fr, grumpkin::g1>();
+}
@@ -170,4 +170,116 @@ bool ecdsa_verify_signature(const std::string& message,
     Fr result(Rx);
     return result == r;
 }
+
+/**
+ * @details For a valid signature with R = u1⋅G + u2⋅P, the point R is determined by r and the recovery id v up to the
+ * (overwhelmingly unlikely) case of a wrong parity or x-coordinate, so the batch checks
+ *
+ *      (∑ᵢ aᵢ⋅u1ᵢ)⋅G + ∑ᵢ aᵢ⋅u2ᵢ⋅Pᵢ - ∑ᵢ aᵢ⋅Rᵢ = O
+ *
+ * for random aᵢ. If every equation holds then so does the combination, and otherwise the combination holds with
+ * probability 1/|Fr|. A passing batch implies each Rᵢ = u1ᵢ⋅G + u2ᵢ⋅Pᵢ, i.e. every signature verifies individually; a
+ * failing batch (which includes valid signatures with an inconsistent v) falls back to ecdsa_verify_signature.
+ * Signatures whose R cannot be recovered from (r, v) are always verified individually.
+ */
+template <typename Hash, typename Fq, typename Fr, typename G1>
+std::vector<bool> ecdsa_verify_signatures_batch(const std::vector<std::string>& messages,
+                                                const std::vector<typename G1::affine_element>& public_keys,
+                                                const std::vector<ecdsa_signature>& signatures)
+{
+    using serialize::read;
+    using affine_element = typename G1::affine_element;
+    const size_t num_signatures = signatures.size();
+    ASSERT(messages.size() == num_signatures && public_keys.size() == num_signatures);
+    const uint256_t mod = uint256_t(Fr::modulus);
+
+    std::vector<bool> results(num_signatures, false);
+    std::vector<size_t> batched_indices;
+    std::vector<size_t> individual_indices;
+    std::vector<Fr> r_values;
+    std::vector<Fr> s_values;
+    std::vector<affine_element> R_points;
+    for (size_t i = 0; i < num_signatures; ++i) {
+        const auto& sig = signatures[i];
+        uint256_t r_uint;
+        uint256_t s_uint;
+        const auto* r_buf = &sig.r[0];
+        const auto* s_buf = &sig.s[0];
+        read(r_buf, r_uint);
+        read(s_buf, s_uint);
+        // Same checks, with the same outcomes, as ecdsa_verify_signature
+        if (!public_keys[i].on_curve() || (r_uint >= mod) || (s_uint >= mod) || (r_uint == 0) || (s_uint == 0)) {
+            continue;
+        }
+        if (s_uint * 2 > mod) {
+            throw_or_abort("s value is not less than curve order by 2");
+        }
+        if (public_keys[i].is_point_at_infinity() || sig.v < 27 || sig.v > 30) {
+            individual_indices.push_back(i);
+            continue;
+        }
+
+        // Recover R from its x-coordinate r (or r + |Fr| for v in {29, 30}) and the parity of its y-coordinate
+        const uint256_t x_uint = (sig.v >= 29) ? r_uint + mod : r_uint;
+        if (x_uint >= uint256_t(Fq::modulus) || x_uint < r_uint) {
+            individual_indices.push_back(i);
+            continue;
+        }
+        const Fq x(x_uint);
+        Fq y2 = x.sqr() * x + G1::curve_b;
+        if constexpr (G1::has_a) {
+            y2 += x * G1::curve_a;
+        }
+        auto [is_quadratic_residue, y] = y2.sqrt();
+        if (!is_quadratic_residue) {
+            individual_indices.push_back(i);
+            continue;
+        }
+        if (uint256_t(y).get_bit(0) != static_cast<bool>(sig.v & 1)) {
+            y = -y;
+        }
+        batched_indices.push_back(i);
+        r_values.emplace_back(r_uint);
+        s_values.emplace_back(s_uint);
+        R_points.emplace_back(x, y);
+    }
+
+    if (!batched_indices.empty()) {
+        Fr::batch_invert(s_values);
+        std::vector<affine_element> points;
+        std::vector<Fr> scalars;
+        points.reserve(2 * batched_indices.size() + 1);
+        scalars.reserve(2 * batched_indices.size() + 1);
+        Fr generator_scalar = Fr::zero();
+        for (size_t j = 0; j < batched_indices.size(); ++j) {
+            const size_t i = batched_indices[j];
+            std::vector<uint8_t> message_buffer(messages[i].begin(), messages[i].end());
+            auto ev = Hash::hash(message_buffer);
+            const Fr z = Fr::serialize_from_buffer(&ev[0]);
+
+            const Fr a = Fr::random_element();
+            const Fr a_s_inv = a * s_values[j];
+            generator_scalar += z * a_s_inv;
+            points.emplace_back(public_keys[i]);
+            scalars.emplace_back(r_values[j] * a_s_inv);
+            points.emplace_back(R_points[j]);
+            scalars.emplace_back(-a);
+        }
+        points.emplace_back(G1::affine_one);
+        scalars.emplace_back(generator_scalar);
+
+        if (G1::element::multi_scalar_mul(points, scalars).is_point_at_infinity()) {
+            for (const size_t i : batched_indices) {
+                results[i] = true;
+            }
+        } else {
+            individual_indices.insert(individual_indices.end(), batched_indices.begin(), batched_indices.end());
+        }
+    }
+
+    for (const size_t i : individual_indices) {
+        results[i] = ecdsa_verify_signature<Hash, Fq, Fr, G1>(messages[i], public_keys[i], signatures[i]);
+    }
+    return results;
+}
 } // namespace bb::crypto
@@ -4,8 +4,12 @@
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include <array>
+#include <deque>
 #include <map>
+#include <mutex>
 #include <optional>
+#include <span>
+#include <vector>
 
 namespace bb::crypto {
 /**
@@ -29,11 +33,9 @@ namespace bb::crypto {
  *          All Pedersen methods that require a `*generator_data` parameter (from now on referred to as "generator
  *          context") should default to using `default_data`.
  *
- *          Q: Why make the generator context an input parameter when it defaults to `default_data`?
- *          A: This is not thread-safe. Each process that uses a `generator_data` object may extend `generator_data` if
- *             more generators are required.
- *             i.e. either each process must use an independent `generator_data` object or the author must KNOW that
- *             `generator_data` will not be extended by any process
+ *          `get` is guarded by a mutex, since `default_data` is extended by any thread that needs more generators.
+ *          Extending a list of generators appends a new list rather than growing it in place, so that the views
+ *          returned earlier stay valid.
  *
  * @tparam Curve
  */
@@ -43,7 +45,10 @@ template <typename Curve> class generator_data {
     using AffineElement = typename Curve::AffineElement;
     using GeneratorList = std::vector<AffineElement>;
     using GeneratorView = std::span<AffineElement const>;
+    using FixedBaseTable = typename Group::fixed_base_table;
     static inline constexpr size_t DEFAULT_NUM_GENERATORS = 8;
+    // Number of default generators, from the first one, that have precomputed window tables (see get_default_tables)
+    static inline constexpr size_t NUM_DEFAULT_TABLES = DEFAULT_NUM_GENERATORS;
     static inline constexpr std::string_view DEFAULT_DOMAIN_SEPARATOR = "DEFAULT_DOMAIN_SEPARATOR";
     inline constexpr generator_data() = default;
 
@@ -71,41 +76,64 @@ template <typename Curve> class generator_data {
             return GeneratorView{ precomputed_generators.data() + generator_offset, num_generators };
         }
 
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(generator_mutex);
+#endif
         if (!generator_map.has_value()) {
-            generator_map = std::map<std::string, GeneratorList>();
+            generator_map = std::map<std::string, std::deque<GeneratorList>>();
         }
-        std::map<std::string, GeneratorList>& map = generator_map.value();
+        std::map<std::string, std::deque<GeneratorList>>& map = generator_map.value();
 
         // Case 2: we want default generators, but more than we precomputed at compile time. If we have not yet copied
         // the default generators into the map, do so.
         if (is_default_domain && !initialized_precomputed_generators) {
-            map.insert({ std::string(DEFAULT_DOMAIN_SEPARATOR),
-                         GeneratorList(precomputed_generators.begin(), precomputed_generators.end()) });
+            map[std::string(DEFAULT_DOMAIN_SEPARATOR)].emplace_back(precomputed_generators.begin(),
+                                                                    precomputed_generators.end());
             initialized_precomputed_generators = true;
         }
 
         // if the generator map does not contain our desired generators, add entry into map
-        if (!map.contains(std::string(domain_separator))) {
-            map.insert({
-                std::string(domain_separator),
-                Group::derive_generators(domain_separator, num_generators + generator_offset, 0),
-            });
+        std::deque<GeneratorList>& generator_lists = map[std::string(domain_separator)];
+        if (generator_lists.empty()) {
+            generator_lists.emplace_back(
+                Group::derive_generators(domain_separator, num_generators + generator_offset, 0));
         }
 
-        GeneratorList& generators = map.at(std::string(domain_separator));
-
-        // If the current GeneratorList does not contain enough generators, extend it
-        if (num_generators + generator_offset > generators.size()) {
-            const size_t num_extra_generators = num_generators + generator_offset - generators.size();
-            GeneratorList extended_generators =
-                Group::derive_generators(domain_separator, num_extra_generators, generators.size());
-            generators.reserve(num_generators + generator_offset);
-            std::copy(extended_generators.begin(), extended_generators.end(), std::back_inserter(generators));
+        // If the current GeneratorList does not contain enough generators, extend it into a new list. The previous
+        // lists are kept, as views into them may still be in use
+        if (num_generators + generator_offset > generator_lists.back().size()) {
+            const GeneratorList& previous_generators = generator_lists.back();
+            const size_t num_extra_generators = num_generators + generator_offset - previous_generators.size();
+            GeneratorList extended_generators;
+            extended_generators.reserve(num_generators + generator_offset);
+            extended_generators.insert(
+                extended_generators.end(), previous_generators.begin(), previous_generators.end());
+            GeneratorList extra_generators =
+                Group::derive_generators(domain_separator, num_extra_generators, previous_generators.size());
+            std::copy(extra_generators.begin(), extra_generators.end(), std::back_inserter(extended_generators));
+            generator_lists.emplace_back(std::move(extended_generators));
         }
 
+        const GeneratorList& generators = generator_lists.back();
         return GeneratorView{ generators.data() + generator_offset, num_generators };
     }
 
+    /**
+     * @brief Window tables of the first NUM_DEFAULT_TABLES generators of the default domain separator, for fixed-base
+     * multiplications of the generators
+     *
+     * @details The generators are the same for every `generator_data` object, so the tables are built once per process
+     * on first use (about 2 MiB in total) and only read after that, which is safe from multiple threads without
+     * locking. Other generators have no tables: a table takes about as long to build as 30 variable-base
+     * multiplications of its generator and 270 KiB to keep, which one-off commitments to many generators do not repay.
+     */
+    [[nodiscard]] static std::span<const FixedBaseTable> get_default_tables()
+    {
+        static const std::vector<FixedBaseTable> default_tables(precomputed_generators.begin(),
+                                                                precomputed_generators.begin() + NUM_DEFAULT_TABLES);
+        return default_tables;
+    }
+
     // getter method for `default_data`. Object exists as a singleton so we don't need a smart pointer.
     // Don't call `delete` on this pointer.
     static inline generator_data* get_default_generators() { return &default_data; }
@@ -126,8 +154,12 @@ template <typename Curve> class generator_data {
     mutable bool initialized_precomputed_generators = false;
 
     // We wrap the std::map in a `std::optional` so that we can construct `generator_data` at compile time.
-    // This allows us to mark `default_data` as `constinit`, which prevents static initialization ordering fiasco
-    mutable std::optional<std::map<std::string, GeneratorList>> generator_map = {};
+    // This allows us to mark `default_data` as `constinit`, which prevents static initialization ordering fiasco.
+    // The last list of a domain separator holds all of its generators, the previous ones are kept for their views
+    mutable std::optional<std::map<std::string, std::deque<GeneratorList>>> generator_map = {};
+#ifndef NO_MULTITHREADING
+    mutable std::mutex generator_mutex;
+#endif
 };
 
 template <typename Curve> struct GeneratorContext {
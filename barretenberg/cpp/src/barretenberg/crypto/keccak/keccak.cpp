@@ -7,6 +7,8 @@
 
 #include "./hash_types.hpp"
 
+#include <vector>
+
 #if _MSC_VER
 #include <string.h>
 #define __builtin_memcpy memcpy
@@ -105,6 +107,61 @@ struct keccak256 ethash_keccak256(const uint8_t* data, size_t size) NOEXCEPT
     return hash;
 }
 
+void ethash_keccak256_batch(const uint8_t* const* data,
+                            const size_t* sizes,
+                            size_t num_messages,
+                            struct keccak256* out) NOEXCEPT
+{
+    /* The number of states permuted together by ethash_keccakf1600_batch. */
+    static const size_t batch_size = 4;
+    static const size_t word_size = sizeof(uint64_t);
+    static const size_t block_size = (1600 - 256 * 2) / 8;
+    static const size_t block_words = block_size / word_size;
+
+    for (size_t batch_start = 0; batch_start < num_messages; batch_start += batch_size) {
+        const size_t num_lanes = (num_messages - batch_start < batch_size) ? num_messages - batch_start : batch_size;
+
+        /* Pad each message to a whole number of blocks, so that all lanes can be absorbed block by block. */
+        std::vector<uint8_t> padded[batch_size];
+        size_t num_blocks[batch_size] = { 0 };
+        size_t max_blocks = 0;
+        for (size_t lane = 0; lane < num_lanes; ++lane) {
+            const size_t size = sizes[batch_start + lane];
+            num_blocks[lane] = size / block_size + 1;
+            max_blocks = (num_blocks[lane] > max_blocks) ? num_blocks[lane] : max_blocks;
+            padded[lane].assign(num_blocks[lane] * block_size, 0);
+            if (size > 0) {
+                __builtin_memcpy(padded[lane].data(), data[batch_start + lane], size);
+            }
+            padded[lane][size] ^= 0x01;
+            padded[lane].back() ^= 0x80;
+        }
+
+        uint64_t states[batch_size][25] = {};
+        for (size_t block = 0; block < max_blocks; ++block) {
+            for (size_t lane = 0; lane < num_lanes; ++lane) {
+                if (block < num_blocks[lane]) {
+                    for (size_t i = 0; i < block_words; ++i) {
+                        states[lane][i] ^= load_le(padded[lane].data() + block * block_size + i * word_size);
+                    }
+                }
+            }
+
+            /* Lanes that have absorbed all their blocks are permuted along with the others, but their output has
+               already been taken. */
+            ethash_keccakf1600_batch(states, num_lanes);
+
+            for (size_t lane = 0; lane < num_lanes; ++lane) {
+                if (block + 1 == num_blocks[lane]) {
+                    for (size_t i = 0; i < 4; ++i) {
+                        out[batch_start + lane].word64s[i] = to_le64(states[lane][i]);
+                    }
+                }
+            }
+        }
+    }
+}
+
 struct keccak256 hash_field_elements(const uint64_t* limbs, size_t num_elements)
 {
     uint8_t input_buffer[num_elements * 32];
@@ -29,8 +29,31 @@ extern "C" {
  */
 void ethash_keccakf1600(uint64_t state[25]) NOEXCEPT;
 
+/**
+ * The Keccak-f[1600] function applied to a number of independent states.
+ *
+ * Where the CPU supports AVX2, four states are permuted at once in the four 64-bit lanes of the vector registers.
+ *
+ * @param states      The states to be permuted in place.
+ * @param num_states  The number of states.
+ */
+void ethash_keccakf1600_batch(uint64_t (*states)[25], size_t num_states) NOEXCEPT;
+
 struct keccak256 ethash_keccak256(const uint8_t* data, size_t size) NOEXCEPT;
 
+/**
+ * Keccak-256 of a number of independent messages, permuting the states of different messages together.
+ *
+ * @param data          The messages.
+ * @param sizes         The sizes of the messages in bytes.
+ * @param num_messages  The number of messages.
+ * @param out           The hashes of the messages.
+ */
+void ethash_keccak256_batch(const uint8_t* const* data,
+                            const size_t* sizes,
+                            size_t num_messages,
+                            struct keccak256* out) NOEXCEPT;
+
 struct keccak256 hash_field_elements(const uint64_t* limbs, size_t num_elements);
 
 struct keccak256 hash_field_element(const uint64_t* limb);
@@ -0,0 +1,70 @@
+#include "keccak.hpp"
+#include <array>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+TEST(misc_keccak, empty_message)
+{
+    const struct keccak256 result = ethash_keccak256(nullptr, 0);
+
+    // keccak256("") = c5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470, as little-endian words
+    const std::array<uint64_t, 4> expected{ 0x3c23f7860146d2c5, 0xc003c7dcb27d7e92, 0x3b2782ca53b600e5,
+                                            0x70a4855d04d8fa7b };
+    for (size_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(result.word64s[i], expected[i]);
+    }
+}
+
+// The batched permutation (vectorised where supported) must agree with the scalar one
+TEST(misc_keccak, keccakf1600_batch)
+{
+    std::mt19937_64 engine(42);
+    // Not a multiple of the vector width, so that some states are permuted by the scalar code
+    const size_t num_states = 11;
+    std::vector<std::array<uint64_t, 25>> states(num_states);
+    for (auto& state : states) {
+        for (auto& word : state) {
+            word = engine();
+        }
+    }
+    auto expected = states;
+    for (auto& state : expected) {
+        ethash_keccakf1600(state.data());
+    }
+
+    static_assert(sizeof(std::array<uint64_t, 25>) == sizeof(uint64_t[25]));
+    ethash_keccakf1600_batch(reinterpret_cast<uint64_t(*)[25]>(states.data()), num_states);
+    EXPECT_EQ(states, expected);
+}
+
+TEST(misc_keccak, keccak256_batch)
+{
+    std::mt19937_64 engine(42);
+    // Messages of different lengths around the block size of 136 bytes, so that batched messages have different numbers
+    // of blocks
+    std::vector<std::vector<uint8_t>> messages;
+    for (const size_t length : { 0UL, 1UL, 64UL, 135UL, 136UL, 137UL, 300UL, 32UL, 1000UL }) {
+        std::vector<uint8_t> message(length);
+        for (auto& byte : message) {
+            byte = static_cast<uint8_t>(engine());
+        }
+        messages.push_back(message);
+    }
+
+    std::vector<const uint8_t*> data;
+    std::vector<size_t> sizes;
+    for (const auto& message : messages) {
+        data.push_back(message.data());
+        sizes.push_back(message.size());
+    }
+    std::vector<struct keccak256> results(messages.size());
+    ethash_keccak256_batch(data.data(), sizes.data(), messages.size(), results.data());
+
+    for (size_t i = 0; i < messages.size(); ++i) {
+        const struct keccak256 expected = ethash_keccak256(messages[i].data(), messages[i].size());
+        for (size_t j = 0; j < 4; ++j) {
+            EXPECT_EQ(results[i].word64s[j], expected.word64s[j]);
+        }
+    }
+}
@@ -4,8 +4,13 @@
  */
 
 #include "keccak.hpp"
+#include "barretenberg/common/cpu_features.hpp"
 #include <stdint.h>
 
+#ifdef BB_X86_64_INTRINSICS
+#include <immintrin.h>
+#endif
+
 static uint64_t rol(uint64_t x, unsigned s)
 {
     return (x << s) | (x >> (64 - s));
@@ -233,3 +238,132 @@ void ethash_keccakf1600(uint64_t state[25]) NOEXCEPT
     state[23] = Aso;
     state[24] = Asu;
 }
+
+#ifdef BB_X86_64_INTRINSICS
+
+__attribute__((target("avx2"))) static inline __m256i rol_x4(__m256i x, int s)
+{
+    return _mm256_or_si256(_mm256_slli_epi64(x, s), _mm256_srli_epi64(x, 64 - s));
+}
+
+__attribute__((target("avx2"))) static inline __m256i xor5_x4(__m256i a, __m256i b, __m256i c, __m256i d, __m256i e)
+{
+    return _mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(c, d)), e);
+}
+
+/**
+ * Keccak-f[1600] applied to four states at once, one per 64-bit lane of the AVX2 registers.
+ */
+__attribute__((target("avx2"))) static void keccakf1600_x4(uint64_t (*states)[25])
+{
+    __m256i A[25];
+    __m256i B[25];
+    __m256i C[5];
+    __m256i D[5];
+    int i;
+    int round;
+
+    for (i = 0; i < 25; ++i) {
+        A[i] = _mm256_set_epi64x((long long)states[3][i],
+                                 (long long)states[2][i],
+                                 (long long)states[1][i],
+                                 (long long)states[0][i]);
+    }
+
+    for (round = 0; round < 24; ++round) {
+        /* theta */
+        C[0] = xor5_x4(A[0], A[5], A[10], A[15], A[20]);
+        C[1] = xor5_x4(A[1], A[6], A[11], A[16], A[21]);
+        C[2] = xor5_x4(A[2], A[7], A[12], A[17], A[22]);
+        C[3] = xor5_x4(A[3], A[8], A[13], A[18], A[23]);
+        C[4] = xor5_x4(A[4], A[9], A[14], A[19], A[24]);
+        D[0] = _mm256_xor_si256(C[4], rol_x4(C[1], 1));
+        D[1] = _mm256_xor_si256(C[0], rol_x4(C[2], 1));
+        D[2] = _mm256_xor_si256(C[1], rol_x4(C[3], 1));
+        D[3] = _mm256_xor_si256(C[2], rol_x4(C[4], 1));
+        D[4] = _mm256_xor_si256(C[3], rol_x4(C[0], 1));
+
+        /* rho and pi: B[y, 2x + 3y] = rol(A[x, y] ^ D[x], r[x, y]) */
+        B[0] = _mm256_xor_si256(A[0], D[0]);
+        B[10] = rol_x4(_mm256_xor_si256(A[1], D[1]), 1);
+        B[20] = rol_x4(_mm256_xor_si256(A[2], D[2]), 62);
+        B[5] = rol_x4(_mm256_xor_si256(A[3], D[3]), 28);
+        B[15] = rol_x4(_mm256_xor_si256(A[4], D[4]), 27);
+        B[16] = rol_x4(_mm256_xor_si256(A[5], D[0]), 36);
+        B[1] = rol_x4(_mm256_xor_si256(A[6], D[1]), 44);
+        B[11] = rol_x4(_mm256_xor_si256(A[7], D[2]), 6);
+        B[21] = rol_x4(_mm256_xor_si256(A[8], D[3]), 55);
+        B[6] = rol_x4(_mm256_xor_si256(A[9], D[4]), 20);
+        B[7] = rol_x4(_mm256_xor_si256(A[10], D[0]), 3);
+        B[17] = rol_x4(_mm256_xor_si256(A[11], D[1]), 10);
+        B[2] = rol_x4(_mm256_xor_si256(A[12], D[2]), 43);
+        B[12] = rol_x4(_mm256_xor_si256(A[13], D[3]), 25);
+        B[22] = rol_x4(_mm256_xor_si256(A[14], D[4]), 39);
+        B[23] = rol_x4(_mm256_xor_si256(A[15], D[0]), 41);
+        B[8] = rol_x4(_mm256_xor_si256(A[16], D[1]), 45);
+        B[18] = rol_x4(_mm256_xor_si256(A[17], D[2]), 15);
+        B[3] = rol_x4(_mm256_xor_si256(A[18], D[3]), 21);
+        B[13] = rol_x4(_mm256_xor_si256(A[19], D[4]), 8);
+        B[14] = rol_x4(_mm256_xor_si256(A[20], D[0]), 18);
+        B[24] = rol_x4(_mm256_xor_si256(A[21], D[1]), 2);
+        B[9] = rol_x4(_mm256_xor_si256(A[22], D[2]), 61);
+        B[19] = rol_x4(_mm256_xor_si256(A[23], D[3]), 56);
+        B[4] = rol_x4(_mm256_xor_si256(A[24], D[4]), 14);
+
+        /* chi */
+        A[0] = _mm256_xor_si256(B[0], _mm256_andnot_si256(B[1], B[2]));
+        A[1] = _mm256_xor_si256(B[1], _mm256_andnot_si256(B[2], B[3]));
+        A[2] = _mm256_xor_si256(B[2], _mm256_andnot_si256(B[3], B[4]));
+        A[3] = _mm256_xor_si256(B[3], _mm256_andnot_si256(B[4], B[0]));
+        A[4] = _mm256_xor_si256(B[4], _mm256_andnot_si256(B[0], B[1]));
+        A[5] = _mm256_xor_si256(B[5], _mm256_andnot_si256(B[6], B[7]));
+        A[6] = _mm256_xor_si256(B[6], _mm256_andnot_si256(B[7], B[8]));
+        A[7] = _mm256_xor_si256(B[7], _mm256_andnot_si256(B[8], B[9]));
+        A[8] = _mm256_xor_si256(B[8], _mm256_andnot_si256(B[9], B[5]));
+        A[9] = _mm256_xor_si256(B[9], _mm256_andnot_si256(B[5], B[6]));
+        A[10] = _mm256_xor_si256(B[10], _mm256_andnot_si256(B[11], B[12]));
+        A[11] = _mm256_xor_si256(B[11], _mm256_andnot_si256(B[12], B[13]));
+        A[12] = _mm256_xor_si256(B[12], _mm256_andnot_si256(B[13], B[14]));
+        A[13] = _mm256_xor_si256(B[13], _mm256_andnot_si256(B[14], B[10]));
+        A[14] = _mm256_xor_si256(B[14], _mm256_andnot_si256(B[10], B[11]));
+        A[15] = _mm256_xor_si256(B[15], _mm256_andnot_si256(B[16], B[17]));
+        A[16] = _mm256_xor_si256(B[16], _mm256_andnot_si256(B[17], B[18]));
+        A[17] = _mm256_xor_si256(B[17], _mm256_andnot_si256(B[18], B[19]));
+        A[18] = _mm256_xor_si256(B[18], _mm256_andnot_si256(B[19], B[15]));
+        A[19] = _mm256_xor_si256(B[19], _mm256_andnot_si256(B[15], B[16]));
+        A[20] = _mm256_xor_si256(B[20], _mm256_andnot_si256(B[21], B[22]));
+        A[21] = _mm256_xor_si256(B[21], _mm256_andnot_si256(B[22], B[23]));
+        A[22] = _mm256_xor_si256(B[22], _mm256_andnot_si256(B[23], B[24]));
+        A[23] = _mm256_xor_si256(B[23], _mm256_andnot_si256(B[24], B[20]));
+        A[24] = _mm256_xor_si256(B[24], _mm256_andnot_si256(B[20], B[21]));
+
+        /* iota */
+        A[0] = _mm256_xor_si256(A[0], _mm256_set1_epi64x((long long)round_constants[round]));
+    }
+
+    for (i = 0; i < 25; ++i) {
+        uint64_t lanes[4];
+        _mm256_storeu_si256((__m256i*)lanes, A[i]);
+        states[0][i] = lanes[0];
+        states[1][i] = lanes[1];
+        states[2][i] = lanes[2];
+        states[3][i] = lanes[3];
+    }
+}
+
+#endif
+
+void ethash_keccakf1600_batch(uint64_t (*states)[25], size_t num_states) NOEXCEPT
+{
+    size_t i = 0;
+#ifdef BB_X86_64_INTRINSICS
+    if (bb::get_cpu_features().avx2) {
+        for (; i + 4 <= num_states; i += 4) {
+            keccakf1600_x4(states + i);
+        }
+    }
+#endif
+    for (; i < num_states; ++i) {
+        ethash_keccakf1600(states[i]);
+    }
+}
@@ -41,6 +41,18 @@ inline bb::fr hash_native(std::vector<bb::fr> const& inputs)
     return crypto::pedersen_hash::hash(inputs); // uses lookup tables
 }
 
+/**
+ * Hashes adjacent pairs of a layer of the tree to compute the next layer, as a single batch
+ */
+inline std::vector<bb::fr> hash_layer_native(std::vector<bb::fr> const& layer)
+{
+    std::vector<std::vector<bb::fr>> pairs(layer.size() / 2);
+    for (size_t i = 0; i < pairs.size(); ++i) {
+        pairs[i] = { layer[i * 2], layer[i * 2 + 1] };
+    }
+    return crypto::pedersen_hash::hash_batch(pairs);
+}
+
 /**
  * Computes the root of a tree with leaves given as the vector `input`.
  *
@@ -54,11 +66,7 @@ inline bb::fr compute_tree_root_native(std::vector<bb::fr> const& input)
     ASSERT(numeric::is_power_of_two(input.size()));
     auto layer = input;
     while (layer.size() > 1) {
-        std::vector<bb::fr> next_layer(layer.size() / 2);
-        for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::hash({ layer[i * 2], layer[i * 2 + 1] });
-        }
-        layer = std::move(next_layer);
+        layer = hash_layer_native(layer);
     }
 
     return layer[0];
@@ -73,12 +81,8 @@ inline std::vector<bb::fr> compute_tree_native(std::vector<bb::fr> const& input)
     auto layer = input;
     std::vector<bb::fr> tree(input);
     while (layer.size() > 1) {
-        std::vector<bb::fr> next_layer(layer.size() / 2);
-        for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::hash({ layer[i * 2], layer[i * 2 + 1] });
-            tree.push_back(next_layer[i]);
-        }
-        layer = std::move(next_layer);
+        layer = hash_layer_native(layer);
+        tree.insert(tree.end(), layer.begin(), layer.end());
     }
 
     return tree;
@@ -1,6 +1,8 @@
 #include "./pedersen.hpp"
 #include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
+#include <algorithm>
 #include <iostream>
 #ifndef NO_OMP_MULTITHREADING
 #include <omp.h>
@@ -21,13 +23,64 @@ template <typename Curve>
 typename Curve::AffineElement pedersen_commitment_base<Curve>::commit_native(const std::vector<Fq>& inputs,
                                                                              const GeneratorContext context)
 {
-    const auto generators = context.generators->get(inputs.size(), context.offset, context.domain_separator);
+    return AffineElement(commit_native_unnormalized(inputs, context));
+}
+
+/**
+ * @brief Compute the commitment without normalizing it
+ * @details Commitments to the first few default generators, the common case of hashing a pair of fields, use the
+ * window tables of `generator_data::get_default_tables`. Other commitments do a variable-base multiplication per input.
+ */
+template <typename Curve>
+typename Curve::Element pedersen_commitment_base<Curve>::commit_native_unnormalized(const std::vector<Fq>& inputs,
+                                                                                   const GeneratorContext& context)
+{
+    using GeneratorData = generator_data<Curve>;
     Element result = Group::point_at_infinity;
 
+    if (context.domain_separator == GeneratorData::DEFAULT_DOMAIN_SEPARATOR &&
+        context.offset + inputs.size() <= GeneratorData::NUM_DEFAULT_TABLES) {
+        const auto tables = GeneratorData::get_default_tables().subspan(context.offset, inputs.size());
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            result += tables[i].mul(Fr(static_cast<uint256_t>(inputs[i])));
+        }
+        return result;
+    }
+
+    const auto generators = context.generators->get(inputs.size(), context.offset, context.domain_separator);
     for (size_t i = 0; i < inputs.size(); ++i) {
         result += Element(generators[i]) * static_cast<uint256_t>(inputs[i]);
     }
-    return result.normalize();
+    return result;
+}
+
+/**
+ * @brief Commit to each of a batch of input vectors, in parallel and with a single inversion to normalize the results
+ */
+template <typename Curve>
+std::vector<typename Curve::AffineElement> pedersen_commitment_base<Curve>::commit_native_batch(
+    const std::vector<std::vector<Fq>>& inputs, const GeneratorContext context)
+{
+    // Derive the generators up front, so that the threads below only read `context.generators`
+    size_t max_num_inputs = 0;
+    for (const auto& input : inputs) {
+        max_num_inputs = std::max(max_num_inputs, input.size());
+    }
+    static_cast<void>(context.generators->get(max_num_inputs, context.offset, context.domain_separator));
+
+    std::vector<Element> commitments(inputs.size());
+    parallel_for_heuristic(
+        inputs.size(),
+        [&](size_t i) { commitments[i] = commit_native_unnormalized(inputs[i], context); },
+        thread_heuristics::GE_ADDITION_COST * 64);
+    Element::batch_normalize(commitments.data(), commitments.size());
+
+    std::vector<AffineElement> result(inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        result[i] = commitments[i].is_point_at_infinity() ? AffineElement(commitments[i])
+                                                          : AffineElement(commitments[i].x, commitments[i].y);
+    }
+    return result;
 }
 template class pedersen_commitment_base<curve::Grumpkin>;
 } // namespace bb::crypto
@@ -28,6 +28,10 @@ template <typename Curve> class pedersen_commitment_base {
     using GeneratorContext = typename crypto::GeneratorContext<Curve>;
 
     static AffineElement commit_native(const std::vector<Fq>& inputs, GeneratorContext context = {});
+    static std::vector<AffineElement> commit_native_batch(const std::vector<std::vector<Fq>>& inputs,
+                                                          GeneratorContext context = {});
+    // The commitment in Jacobian coordinates, for callers that add further terms before normalizing
+    static Element commit_native_unnormalized(const std::vector<Fq>& inputs, const GeneratorContext& context);
 };
 
 using pedersen_commitment = pedersen_commitment_base<curve::Grumpkin>;
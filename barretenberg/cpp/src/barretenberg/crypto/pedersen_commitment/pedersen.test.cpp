@@ -28,6 +28,17 @@ TEST(Pedersen, CommitmentWithZero)
     EXPECT_EQ(r, expected);
 }
 
+TEST(Pedersen, CommitmentBatch)
+{
+    std::vector<std::vector<pedersen_commitment::Fq>> inputs{ { fr::one(), fr::one() }, { fr::zero(), fr::one() },
+                                                              { fr::zero() } };
+    const auto results = pedersen_commitment::commit_native_batch(inputs);
+    ASSERT_EQ(results.size(), inputs.size());
+    EXPECT_EQ(results[0], pedersen_commitment::commit_native(inputs[0]));
+    EXPECT_EQ(results[1], pedersen_commitment::commit_native(inputs[1]));
+    EXPECT_TRUE(results[2].is_point_at_infinity());
+}
+
 TEST(Pedersen, CommitmentProf)
 {
     GTEST_SKIP() << "Skipping mini profiler.";
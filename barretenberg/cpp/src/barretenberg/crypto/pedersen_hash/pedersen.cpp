@@ -1,5 +1,7 @@
 #include "./pedersen.hpp"
 #include "../pedersen_commitment/pedersen.hpp"
+#include "barretenberg/common/thread.hpp"
+#include <algorithm>
 
 namespace bb::crypto {
 
@@ -56,8 +58,44 @@ std::vector<typename Curve::BaseField> pedersen_hash_base<Curve>::convert_buffer
 template <typename Curve>
 typename Curve::BaseField pedersen_hash_base<Curve>::hash(const std::vector<Fq>& inputs, const GeneratorContext context)
 {
-    Element result = length_generator * Fr(inputs.size());
-    return (result + pedersen_commitment_base<Curve>::commit_native(inputs, context)).normalize().x;
+    return hash_unnormalized(inputs, context).normalize().x;
+}
+
+/**
+ * @brief Hash each of a batch of input vectors, in parallel and with a single inversion to normalize the results
+ */
+template <typename Curve>
+std::vector<typename Curve::BaseField> pedersen_hash_base<Curve>::hash_batch(const std::vector<std::vector<Fq>>& inputs,
+                                                                             const GeneratorContext context)
+{
+    // Derive the generators up front, so that the threads below only read `context.generators`
+    size_t max_num_inputs = 0;
+    for (const auto& input : inputs) {
+        max_num_inputs = std::max(max_num_inputs, input.size());
+    }
+    static_cast<void>(context.generators->get(max_num_inputs, context.offset, context.domain_separator));
+
+    std::vector<Element> hashes(inputs.size());
+    parallel_for_heuristic(
+        inputs.size(),
+        [&](size_t i) { hashes[i] = hash_unnormalized(inputs[i], context); },
+        thread_heuristics::GE_ADDITION_COST * 64);
+    Element::batch_normalize(hashes.data(), hashes.size());
+
+    std::vector<Fq> result(inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        result[i] = hashes[i].x;
+    }
+    return result;
+}
+
+template <typename Curve>
+typename Curve::Element pedersen_hash_base<Curve>::hash_unnormalized(const std::vector<Fq>& inputs,
+                                                                     const GeneratorContext& context)
+{
+    static const typename Group::fixed_base_table length_generator_table(length_generator);
+    Element result = length_generator_table.mul(Fr(inputs.size()));
+    return result + pedersen_commitment_base<Curve>::commit_native_unnormalized(inputs, context);
 }
 
 /**
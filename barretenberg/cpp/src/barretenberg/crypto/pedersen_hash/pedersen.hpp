@@ -30,10 +30,12 @@ template <typename Curve> class pedersen_hash_base {
     using GeneratorContext = typename crypto::GeneratorContext<Curve>;
     inline static constexpr AffineElement length_generator = Group::derive_generators("pedersen_hash_length", 1)[0];
     static Fq hash(const std::vector<Fq>& inputs, GeneratorContext context = {});
+    static std::vector<Fq> hash_batch(const std::vector<std::vector<Fq>>& inputs, GeneratorContext context = {});
     static Fq hash_buffer(const std::vector<uint8_t>& input, GeneratorContext context = {});
 
   private:
     static std::vector<Fq> convert_buffer(const std::vector<uint8_t>& input);
+    static Element hash_unnormalized(const std::vector<Fq>& inputs, const GeneratorContext& context);
 };
 
 using pedersen_hash = pedersen_hash_base<curve::Grumpkin>;
@@ -32,4 +32,33 @@ TEST(Pedersen, HashWithIndex)
     EXPECT_EQ(r, fr(uint256_t("1c446df60816b897cda124524e6b03f36df0cec333fad87617aab70d7861daa6")));
 }
 
+TEST(Pedersen, HashBatch)
+{
+    // Inputs of different lengths, using generators with and without window tables, of the default and a custom domain
+    std::vector<std::vector<pedersen_hash::Fq>> inputs;
+    for (size_t length = 0; length < 12; ++length) {
+        std::vector<pedersen_hash::Fq> input(length);
+        for (auto& element : input) {
+            element = pedersen_hash::Fq::random_element();
+        }
+        inputs.push_back(input);
+    }
+    for (const auto& context : { GeneratorContext<curve::Grumpkin>(),
+                                 GeneratorContext<curve::Grumpkin>(5),
+                                 GeneratorContext<curve::Grumpkin>(3, "batch_test") }) {
+        const auto results = pedersen_hash::hash_batch(inputs, context);
+        ASSERT_EQ(results.size(), inputs.size());
+        for (size_t i = 1; i < inputs.size(); ++i) {
+            // reference: the variable base multiplication of the generators
+            const auto generators = context.generators->get(inputs[i].size(), context.offset, context.domain_separator);
+            grumpkin::g1::element expected = grumpkin::g1::element(pedersen_hash::length_generator) * grumpkin::fr(i);
+            for (size_t j = 0; j < inputs[i].size(); ++j) {
+                expected += grumpkin::g1::element(generators[j]) * grumpkin::fr(uint256_t(inputs[i][j]));
+            }
+            EXPECT_EQ(results[i], expected.normalize().x);
+            EXPECT_EQ(results[i], pedersen_hash::hash(inputs[i], context));
+        }
+    }
+}
+
 } // namespace bb::crypto
\ No newline at end of file
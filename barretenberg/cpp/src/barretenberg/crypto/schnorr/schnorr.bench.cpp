@@ -0,0 +1,63 @@
+#include "schnorr.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace bb;
+using namespace bb::crypto;
+
+namespace {
+
+struct SignatureBatch {
+    std::vector<std::string> messages;
+    std::vector<grumpkin::g1::affine_element> public_keys;
+    std::vector<schnorr_signature> signatures;
+
+    explicit SignatureBatch(size_t num_signatures)
+    {
+        for (size_t i = 0; i < num_signatures; ++i) {
+            schnorr_key_pair<grumpkin::fr, grumpkin::g1> account;
+            account.private_key = grumpkin::fr::random_element();
+            account.public_key = grumpkin::g1::one * account.private_key;
+            messages.push_back("message " + std::to_string(i));
+            public_keys.push_back(account.public_key);
+            signatures.push_back(schnorr_construct_signature<Blake2sHasher, grumpkin::fq, grumpkin::fr, grumpkin::g1>(
+                messages.back(), account));
+        }
+    }
+};
+
+void set_verification_rate(State& state, size_t num_signatures)
+{
+    state.counters["verifications/s"] =
+        Counter(static_cast<double>(state.iterations()) * static_cast<double>(num_signatures), Counter::kIsRate);
+}
+
+void verify_individually(State& state) noexcept
+{
+    const auto num_signatures = static_cast<size_t>(state.range(0));
+    const SignatureBatch batch(num_signatures);
+    for (auto _ : state) {
+        for (size_t i = 0; i < num_signatures; ++i) {
+            DoNotOptimize(schnorr_verify_signature<Blake2sHasher, grumpkin::fq, grumpkin::fr, grumpkin::g1>(
+                batch.messages[i], batch.public_keys[i], batch.signatures[i]));
+        }
+    }
+    set_verification_rate(state, num_signatures);
+}
+BENCHMARK(verify_individually)->RangeMultiplier(4)->Range(16, 1024);
+
+void verify_batch(State& state) noexcept
+{
+    const auto num_signatures = static_cast<size_t>(state.range(0));
+    const SignatureBatch batch(num_signatures);
+    for (auto _ : state) {
+        DoNotOptimize(schnorr_verify_signatures_batch<Blake2sHasher, grumpkin::fq, grumpkin::fr, grumpkin::g1>(
+            batch.messages, batch.public_keys, batch.signatures));
+    }
+    set_verification_rate(state, num_signatures);
+}
+BENCHMARK(verify_batch)->RangeMultiplier(4)->Range(16, 1024);
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -153,4 +153,54 @@ bool schnorr_verify_signature(const std::string& message,
     auto target_e = schnorr_generate_challenge<Hash, G1>(message, public_key, R);
     return std::equal(sig.e.begin(), sig.e.end(), target_e.begin(), target_e.end());
 }
+
+/**
+ * @brief Verify a batch of Schnorr signatures, returning for each signature the result of schnorr_verify_signature.
+ *
+ * @details In the short (e, s) variant the nonce R is not part of the signature, so the verification equations cannot
+ * be combined into a single random linear combination: every R = s⋅G + e⋅P must be recomputed to evaluate its hash.
+ * The batch instead amortises what it can across signatures: the s⋅G terms use a window table of the generator that is
+ * computed once (no doublings), and all R are normalized with a single field inversion.
+ */
+template <typename Hash, typename Fq, typename Fr, typename G1>
+std::vector<bool> schnorr_verify_signatures_batch(const std::vector<std::string>& messages,
+                                                  const std::vector<typename G1::affine_element>& public_keys,
+                                                  const std::vector<schnorr_signature>& signatures)
+{
+    using affine_element = typename G1::affine_element;
+    using element = typename G1::element;
+    const size_t num_signatures = signatures.size();
+    ASSERT(messages.size() == num_signatures && public_keys.size() == num_signatures);
+
+    static const typename G1::fixed_base_table generator_table(G1::affine_one);
+
+    std::vector<bool> is_well_formed(num_signatures, false);
+    std::vector<element> R_points(num_signatures, G1::point_at_infinity);
+    for (size_t i = 0; i < num_signatures; ++i) {
+        const auto& public_key = public_keys[i];
+        if (!public_key.on_curve() || public_key.is_point_at_infinity()) {
+            continue;
+        }
+        Fr e = Fr::serialize_from_buffer(&signatures[i].e[0]);
+        Fr s = Fr::serialize_from_buffer(&signatures[i].s[0]);
+        if (s == 0 || e == 0) {
+            continue;
+        }
+        is_well_formed[i] = true;
+        R_points[i] = element(public_key) * e + generator_table.mul(s);
+    }
+    element::batch_normalize(R_points.data(), num_signatures);
+
+    std::vector<bool> results(num_signatures, false);
+    for (size_t i = 0; i < num_signatures; ++i) {
+        if (!is_well_formed[i] || R_points[i].is_point_at_infinity()) {
+            continue;
+        }
+        const affine_element R(R_points[i].x, R_points[i].y);
+        const auto& e_raw = signatures[i].e;
+        auto target_e = schnorr_generate_challenge<Hash, G1>(messages[i], public_keys[i], R);
+        results[i] = std::equal(e_raw.begin(), e_raw.end(), target_e.begin(), target_e.end());
+    }
+    return results;
+}
 } // namespace bb::crypto
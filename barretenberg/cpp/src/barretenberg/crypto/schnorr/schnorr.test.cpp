@@ -137,3 +137,39 @@ TEST(schnorr, hmac_signature_consistency)
         message_b, account_b.public_key, signature_h);
     EXPECT_EQ(res, true);
 }
+
+TEST(schnorr, verify_signatures_batch)
+{
+    const size_t num_signatures = 8;
+    std::vector<std::string> messages;
+    std::vector<grumpkin::g1::affine_element> public_keys;
+    std::vector<crypto::schnorr_signature> signatures;
+    for (size_t i = 0; i < num_signatures; ++i) {
+        auto account = generate_signature();
+        messages.push_back("message " + std::to_string(i));
+        public_keys.push_back(account.public_key);
+        signatures.push_back(
+            crypto::schnorr_construct_signature<Blake2sHasher, grumpkin::fq, grumpkin::fr, grumpkin::g1>(
+                messages.back(), account));
+    }
+
+    auto results = crypto::schnorr_verify_signatures_batch<Blake2sHasher, grumpkin::fq, grumpkin::fr, grumpkin::g1>(
+        messages, public_keys, signatures);
+    EXPECT_EQ(results, std::vector<bool>(num_signatures, true));
+
+    // wrong message, wrong public key, public key not on the curve and a zero s
+    messages[1] = "another message";
+    std::swap(public_keys[2], public_keys[3]);
+    public_keys[5].y += 1;
+    std::fill(signatures[6].s.begin(), signatures[6].s.end(), 0);
+
+    results = crypto::schnorr_verify_signatures_batch<Blake2sHasher, grumpkin::fq, grumpkin::fr, grumpkin::g1>(
+        messages, public_keys, signatures);
+    const std::vector<bool> expected{ true, false, false, false, true, false, false, true };
+    EXPECT_EQ(results, expected);
+    for (size_t i = 0; i < num_signatures; ++i) {
+        EXPECT_EQ(results[i],
+                  (crypto::schnorr_verify_signature<Blake2sHasher, grumpkin::fq, grumpkin::fr, grumpkin::g1>(
+                      messages[i], public_keys[i], signatures[i])));
+    }
+}
@@ -1,14 +1,21 @@
 #include "./sha256.hpp"
 #include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/cpu_features.hpp"
 #include "barretenberg/common/net.hpp"
+#include <algorithm>
 #include <array>
+#include <cstdint>
 #include <memory.h>
 
+#ifdef BB_X86_64_INTRINSICS
+#include <immintrin.h>
+#endif
+
 namespace {
 constexpr uint32_t init_constants[8]{ 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
                                       0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
 
-constexpr uint32_t round_constants[64]{
+alignas(16) constexpr uint32_t round_constants[64]{
     0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
     0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
     0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
@@ -39,7 +46,9 @@ void prepare_constants(std::array<uint32_t, 8>& input)
     input[7] = init_constants[7];
 }
 
-std::array<uint32_t, 8> sha256_block(const std::array<uint32_t, 8>& h_init, const std::array<uint32_t, 16>& input)
+namespace detail {
+std::array<uint32_t, 8> sha256_block_portable(const std::array<uint32_t, 8>& h_init,
+                                              const std::array<uint32_t, 16>& input)
 {
     std::array<uint32_t, 64> w;
 
@@ -106,79 +115,234 @@ std::array<uint32_t, 8> sha256_block(const std::array<uint32_t, 8>& h_init, cons
     output[7] = h + h_init[7];
     return output;
 }
+} // namespace detail
 
-Sha256Hash sha256_block(const std::vector<uint8_t>& input)
+namespace {
+using State = std::array<uint32_t, 8>;
+using Block = std::array<uint32_t, 16>;
+
+// The number of independent messages compressed together by the batch functions. The SHA-256 rounds are a long
+// dependency chain, so interleaving independent messages keeps more of the SHA instructions in flight
+constexpr size_t NUM_LANES = 2;
+
+bool has_sha_extensions()
 {
-    ASSERT(input.size() == 64);
-    std::array<uint32_t, 8> result;
-    prepare_constants(result);
-    std::array<uint32_t, 16> hash_input;
-    memcpy((void*)&hash_input[0], (void*)&input[0], 64);
-    if (is_little_endian()) {
-        for (size_t j = 0; j < hash_input.size(); ++j) {
-            hash_input[j] = __builtin_bswap32(hash_input[j]);
-        }
+    const auto& features = get_cpu_features();
+    return features.sha && features.sse41 && features.ssse3;
+}
+
+#ifdef BB_X86_64_INTRINSICS
+/**
+ * @brief Compress num_blocks consecutive blocks into each of the lane states with the SHA extensions
+ *
+ * @details The SHA extensions keep the working variables in two registers as (a, b, e, f) and (c, d, g, h), and
+ * sha256rnds2 performs two rounds at a time. The message schedule is extended four words at a time with sha256msg1
+ * (W[t-16] + σ₀(W[t-15])) and sha256msg2 (adding σ₁(W[t-2])), with the W[t-7] term added in between.
+ */
+template <size_t LANES>
+__attribute__((target("sha,sse4.1,ssse3"))) void compress_blocks_shani(const std::array<State*, LANES>& states,
+                                                                        const std::array<const Block*, LANES>& blocks,
+                                                                        size_t num_blocks)
+{
+    __m128i state0[LANES];
+    __m128i state1[LANES];
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        // Load (a, b, c, d), (e, f, g, h) and rearrange into (a, b, e, f), (c, d, g, h), highest lane first
+        const auto* state = reinterpret_cast<const __m128i*>(states[lane]->data());
+        const __m128i cdab = _mm_shuffle_epi32(_mm_loadu_si128(state), 0xB1);
+        const __m128i efgh = _mm_shuffle_epi32(_mm_loadu_si128(state + 1), 0x1B);
+        state0[lane] = _mm_alignr_epi8(cdab, efgh, 8);
+        state1[lane] = _mm_blend_epi16(efgh, cdab, 0xF0);
     }
-    result = sha256_block(result, hash_input);
 
-    Sha256Hash output;
-    memcpy((void*)&output[0], (void*)&result[0], 32);
-    if (is_little_endian()) {
-        uint32_t* output_uint32 = (uint32_t*)&output[0];
-        for (size_t j = 0; j < 8; ++j) {
-            output_uint32[j] = __builtin_bswap32(output_uint32[j]);
+    for (size_t block_idx = 0; block_idx < num_blocks; ++block_idx) {
+        __m128i abef_save[LANES];
+        __m128i cdgh_save[LANES];
+        __m128i schedule[LANES][16];
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            abef_save[lane] = state0[lane];
+            cdgh_save[lane] = state1[lane];
+        }
+        for (size_t i = 0; i < 16; ++i) {
+            const __m128i round_constant = _mm_load_si128(reinterpret_cast<const __m128i*>(&round_constants[4 * i]));
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                __m128i* w = schedule[lane];
+                if (i < 4) {
+                    w[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&blocks[lane][block_idx][4 * i]));
+                } else {
+                    const __m128i w_minus_7 = _mm_alignr_epi8(w[i - 1], w[i - 2], 4);
+                    w[i] = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(w[i - 4], w[i - 3]), w_minus_7),
+                                                w[i - 1]);
+                }
+                __m128i message = _mm_add_epi32(w[i], round_constant);
+                state1[lane] = _mm_sha256rnds2_epu32(state1[lane], state0[lane], message);
+                message = _mm_shuffle_epi32(message, 0x0E);
+                state0[lane] = _mm_sha256rnds2_epu32(state0[lane], state1[lane], message);
+            }
+        }
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            state0[lane] = _mm_add_epi32(state0[lane], abef_save[lane]);
+            state1[lane] = _mm_add_epi32(state1[lane], cdgh_save[lane]);
         }
     }
 
-    return output;
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        // Rearrange back into (a, b, c, d), (e, f, g, h)
+        const __m128i feba = _mm_shuffle_epi32(state0[lane], 0x1B);
+        const __m128i dchg = _mm_shuffle_epi32(state1[lane], 0xB1);
+        auto* state = reinterpret_cast<__m128i*>(states[lane]->data());
+        _mm_storeu_si128(state, _mm_blend_epi16(feba, dchg, 0xF0));
+        _mm_storeu_si128(state + 1, _mm_alignr_epi8(dchg, feba, 8));
+    }
 }
+#endif
 
-template <typename ByteContainer> Sha256Hash sha256(const ByteContainer& input)
+/**
+ * @brief Compress num_blocks consecutive blocks into each of the lane states, using the SHA extensions if available
+ */
+template <size_t LANES>
+void compress_blocks(const std::array<State*, LANES>& states,
+                     const std::array<const Block*, LANES>& blocks,
+                     size_t num_blocks)
 {
-    std::vector<uint8_t> message_schedule;
-
-    std::copy(input.begin(), input.end(), std::back_inserter(message_schedule));
-    uint64_t l = message_schedule.size() * 8;
-    message_schedule.push_back(0x80);
-
-    uint32_t num_zero_bytes = ((448U - (message_schedule.size() << 3U)) & 511U) >> 3U;
-
-    for (size_t i = 0; i < num_zero_bytes; ++i) {
-        message_schedule.push_back(0x00);
+#ifdef BB_X86_64_INTRINSICS
+    if (has_sha_extensions()) {
+        compress_blocks_shani<LANES>(states, blocks, num_blocks);
+        return;
     }
+#endif
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        for (size_t i = 0; i < num_blocks; ++i) {
+            *states[lane] = detail::sha256_block_portable(*states[lane], blocks[lane][i]);
+        }
+    }
+}
+
+/**
+ * @brief Pad a message and split it into blocks of big-endian words
+ */
+template <typename ByteContainer> std::vector<Block> pad_message(const ByteContainer& input)
+{
+    // The message is followed by a 1 bit, zeros and the 64-bit message length, padding it to a multiple of 64 bytes
+    const size_t num_bytes = input.size();
+    const size_t num_blocks = (num_bytes + 9 + 63) / 64;
+    std::vector<Block> blocks(num_blocks);
+    auto* bytes = reinterpret_cast<uint8_t*>(blocks.data());
+    std::copy(input.begin(), input.end(), bytes);
+    bytes[num_bytes] = 0x80;
+    const uint64_t l = num_bytes * 8;
     for (size_t i = 0; i < 8; ++i) {
-        uint8_t byte = static_cast<uint8_t>(l >> (uint64_t)(56 - (i * 8)));
-        message_schedule.push_back(byte);
+        bytes[num_blocks * 64 - 8 + i] = static_cast<uint8_t>(l >> (uint64_t)(56 - (i * 8)));
     }
-    std::array<uint32_t, 8> rolling_hash;
-    prepare_constants(rolling_hash);
-    const size_t num_blocks = message_schedule.size() / 64;
-    for (size_t i = 0; i < num_blocks; ++i) {
-        std::array<uint32_t, 16> hash_input;
-        memcpy((void*)&hash_input[0], (void*)&message_schedule[i * 64], 64);
-        if (is_little_endian()) {
-            for (size_t j = 0; j < hash_input.size(); ++j) {
-                hash_input[j] = __builtin_bswap32(hash_input[j]);
+    if (is_little_endian()) {
+        for (auto& block : blocks) {
+            for (auto& word : block) {
+                word = __builtin_bswap32(word);
             }
         }
-        rolling_hash = sha256_block(rolling_hash, hash_input);
     }
+    return blocks;
+}
 
+Sha256Hash state_to_hash(const State& state)
+{
     Sha256Hash output;
-    memcpy((void*)&output[0], (void*)&rolling_hash[0], 32);
+    memcpy((void*)&output[0], (void*)&state[0], 32);
     if (is_little_endian()) {
         uint32_t* output_uint32 = (uint32_t*)&output[0];
         for (size_t j = 0; j < 8; ++j) {
             output_uint32[j] = __builtin_bswap32(output_uint32[j]);
         }
     }
-
     return output;
 }
+} // namespace
+
+std::array<uint32_t, 8> sha256_block(const std::array<uint32_t, 8>& h_init, const std::array<uint32_t, 16>& input)
+{
+    State state = h_init;
+    compress_blocks<1>({ &state }, { &input }, 1);
+    return state;
+}
+
+void sha256_block_batch(std::span<std::array<uint32_t, 8>> states, std::span<const std::array<uint32_t, 16>> inputs)
+{
+    ASSERT(states.size() == inputs.size());
+    size_t i = 0;
+    for (; i + NUM_LANES <= states.size(); i += NUM_LANES) {
+        std::array<State*, NUM_LANES> lane_states;
+        std::array<const Block*, NUM_LANES> lane_blocks;
+        for (size_t lane = 0; lane < NUM_LANES; ++lane) {
+            lane_states[lane] = &states[i + lane];
+            lane_blocks[lane] = &inputs[i + lane];
+        }
+        compress_blocks<NUM_LANES>(lane_states, lane_blocks, 1);
+    }
+    for (; i < states.size(); ++i) {
+        compress_blocks<1>({ &states[i] }, { &inputs[i] }, 1);
+    }
+}
+
+Sha256Hash sha256_block(const std::vector<uint8_t>& input)
+{
+    ASSERT(input.size() == 64);
+    std::array<uint32_t, 8> result;
+    prepare_constants(result);
+    std::array<uint32_t, 16> hash_input;
+    memcpy((void*)&hash_input[0], (void*)&input[0], 64);
+    if (is_little_endian()) {
+        for (size_t j = 0; j < hash_input.size(); ++j) {
+            hash_input[j] = __builtin_bswap32(hash_input[j]);
+        }
+    }
+    result = sha256_block(result, hash_input);
+    return state_to_hash(result);
+}
+
+template <typename ByteContainer> Sha256Hash sha256(const ByteContainer& input)
+{
+    const std::vector<Block> blocks = pad_message(input);
+    State rolling_hash;
+    prepare_constants(rolling_hash);
+    compress_blocks<1>({ &rolling_hash }, { blocks.data() }, blocks.size());
+    return state_to_hash(rolling_hash);
+}
+
+template <typename ByteContainer> std::vector<Sha256Hash> sha256_batch(const std::vector<ByteContainer>& inputs)
+{
+    std::vector<Sha256Hash> outputs(inputs.size());
+    size_t i = 0;
+    for (; i + NUM_LANES <= inputs.size(); i += NUM_LANES) {
+        std::array<std::vector<Block>, NUM_LANES> messages;
+        std::array<State, NUM_LANES> states;
+        std::array<State*, NUM_LANES> lane_states;
+        std::array<const Block*, NUM_LANES> lane_blocks;
+        size_t common_blocks = SIZE_MAX;
+        for (size_t lane = 0; lane < NUM_LANES; ++lane) {
+            messages[lane] = pad_message(inputs[i + lane]);
+            prepare_constants(states[lane]);
+            common_blocks = std::min(common_blocks, messages[lane].size());
+            lane_states[lane] = &states[lane];
+            lane_blocks[lane] = messages[lane].data();
+        }
+        // Compress the blocks that all messages of the group have together, and the remaining blocks one at a time
+        compress_blocks<NUM_LANES>(lane_states, lane_blocks, common_blocks);
+        for (size_t lane = 0; lane < NUM_LANES; ++lane) {
+            const auto& blocks = messages[lane];
+            compress_blocks<1>({ &states[lane] }, { blocks.data() + common_blocks }, blocks.size() - common_blocks);
+            outputs[i + lane] = state_to_hash(states[lane]);
+        }
+    }
+    for (; i < inputs.size(); ++i) {
+        outputs[i] = sha256(inputs[i]);
+    }
+    return outputs;
+}
 
 template Sha256Hash sha256<std::vector<uint8_t>>(const std::vector<uint8_t>& input);
 template Sha256Hash sha256<std::array<uint8_t, 32>>(const std::array<uint8_t, 32>& input);
 template Sha256Hash sha256<std::string>(const std::string& input);
 template Sha256Hash sha256<std::span<uint8_t>>(const std::span<uint8_t>& input);
+template std::vector<Sha256Hash> sha256_batch<std::vector<uint8_t>>(const std::vector<std::vector<uint8_t>>& inputs);
 
 } // namespace bb::crypto
@@ -5,6 +5,7 @@
 #include <array>
 #include <iomanip>
 #include <ostream>
+#include <span>
 #include <vector>
 
 namespace bb::crypto {
@@ -13,8 +14,33 @@ using Sha256Hash = std::array<uint8_t, 32>;
 
 Sha256Hash sha256_block(const std::vector<uint8_t>& input);
 
+/**
+ * @brief The SHA-256 compression function applied to one block of 16 words (big-endian words of the message)
+ *
+ * @details Uses the SHA extensions when the CPU supports them, the portable implementation otherwise.
+ */
+std::array<uint32_t, 8> sha256_block(const std::array<uint32_t, 8>& h_init, const std::array<uint32_t, 16>& input);
+
+/**
+ * @brief Apply the compression function to many independent (state, block) pairs, updating the states in place
+ *
+ * @details Faster than separate calls to sha256_block as independent compressions are interleaved.
+ */
+void sha256_block_batch(std::span<std::array<uint32_t, 8>> states, std::span<const std::array<uint32_t, 16>> inputs);
+
 template <typename T> Sha256Hash sha256(const T& input);
 
+/**
+ * @brief Hash many independent messages, interleaving the compressions of different messages
+ */
+template <typename T> std::vector<Sha256Hash> sha256_batch(const std::vector<T>& inputs);
+
+namespace detail {
+// The portable compression function, exposed for testing against the hardware accelerated one
+std::array<uint32_t, 8> sha256_block_portable(const std::array<uint32_t, 8>& h_init,
+                                              const std::array<uint32_t, 16>& input);
+} // namespace detail
+
 inline bb::fr sha256_to_field(std::vector<uint8_t> const& input)
 {
     auto result = sha256(input);
@@ -2,6 +2,7 @@
 #include <gtest/gtest.h>
 #include <iostream>
 #include <memory>
+#include <random>
 
 using namespace bb;
 using namespace bb::crypto;
@@ -101,3 +102,62 @@ TEST(misc_sha256, test_NIST_vector_five)
         EXPECT_EQ(result[i], expected[i]);
     }
 }
+
+// The compression function (hardware accelerated where supported) must agree with the portable implementation
+TEST(misc_sha256, block_matches_portable)
+{
+    std::mt19937 engine(42);
+    std::array<uint32_t, 8> state{ 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                   0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+    for (size_t i = 0; i < 100; ++i) {
+        std::array<uint32_t, 16> input;
+        for (auto& word : input) {
+            word = static_cast<uint32_t>(engine());
+        }
+        const auto expected = detail::sha256_block_portable(state, input);
+        state = sha256_block(state, input);
+        EXPECT_EQ(state, expected);
+    }
+}
+
+TEST(misc_sha256, block_batch)
+{
+    std::mt19937 engine(42);
+    // An odd number so that the batch does not split evenly into interleaved groups
+    const size_t num_blocks = 7;
+    std::vector<std::array<uint32_t, 8>> states(num_blocks);
+    std::vector<std::array<uint32_t, 16>> inputs(num_blocks);
+    for (size_t i = 0; i < num_blocks; ++i) {
+        for (auto& word : states[i]) {
+            word = static_cast<uint32_t>(engine());
+        }
+        for (auto& word : inputs[i]) {
+            word = static_cast<uint32_t>(engine());
+        }
+    }
+    auto expected = states;
+    for (size_t i = 0; i < num_blocks; ++i) {
+        expected[i] = detail::sha256_block_portable(expected[i], inputs[i]);
+    }
+    sha256_block_batch(states, inputs);
+    EXPECT_EQ(states, expected);
+}
+
+TEST(misc_sha256, batch)
+{
+    std::mt19937 engine(42);
+    // Messages of different lengths, so that interleaved messages have different numbers of blocks
+    std::vector<std::vector<uint8_t>> inputs;
+    for (const size_t length : { 0UL, 1UL, 55UL, 56UL, 64UL, 200UL, 3UL, 119UL, 1000UL }) {
+        std::vector<uint8_t> input(length);
+        for (auto& byte : input) {
+            byte = static_cast<uint8_t>(engine());
+        }
+        inputs.push_back(input);
+    }
+    const auto results = sha256_batch(inputs);
+    ASSERT_EQ(results.size(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        EXPECT_EQ(results[i], sha256(inputs[i]));
+    }
+}
@@ -127,7 +127,8 @@ void build_constraints(Builder& builder,
     // Add ECDSA r1 constraints
     for (size_t i = 0; i < constraint_system.ecdsa_r1_constraints.size(); ++i) {
         const auto& constraint = constraint_system.ecdsa_r1_constraints.at(i);
-        create_ecdsa_r1_verify_constraints(builder, constraint, has_valid_witness_assignments);
+        create_ecdsa_r1_verify_constraints(
+            builder, constraint, has_valid_witness_assignments, constraint_system.ecdsa_r1_windowed_batch_mul);
         gate_counter.track_diff(constraint_system.gates_per_opcode,
                                 constraint_system.original_opcode_indices.ecdsa_r1_constraints.at(i));
     }
@@ -166,7 +167,8 @@ void build_constraints(Builder& builder,
     // Add multi scalar mul constraints
     for (size_t i = 0; i < constraint_system.multi_scalar_mul_constraints.size(); ++i) {
         const auto& constraint = constraint_system.multi_scalar_mul_constraints.at(i);
-        create_multi_scalar_mul_constraint(builder, constraint, has_valid_witness_assignments);
+        create_multi_scalar_mul_constraint(
+            builder, constraint, has_valid_witness_assignments, constraint_system.msm_table_bits);
         gate_counter.track_diff(constraint_system.gates_per_opcode,
                                 constraint_system.original_opcode_indices.multi_scalar_mul_constraints.at(i));
     }
@@ -411,9 +413,13 @@ UltraCircuitBuilder create_circuit(AcirFormat& constraint_system,
                                    const WitnessVector& witness,
                                    bool honk_recursion,
                                    [[maybe_unused]] std::shared_ptr<ECCOpQueue>,
-                                   bool collect_gates_per_opcode)
+                                   bool collect_gates_per_opcode,
+                                   bool count_only)
 {
     Builder builder{ size_hint, witness, constraint_system.public_inputs, constraint_system.varnum, recursive };
+    if (count_only) {
+        builder.set_count_only();
+    }
 
     bool has_valid_witness_assignments = !witness.empty();
     build_constraints(
@@ -440,10 +446,14 @@ MegaCircuitBuilder create_circuit(AcirFormat& constraint_system,
                                   const WitnessVector& witness,
                                   bool honk_recursion,
                                   std::shared_ptr<ECCOpQueue> op_queue,
-                                  bool collect_gates_per_opcode)
+                                  bool collect_gates_per_opcode,
+                                  bool count_only)
 {
     // Construct a builder using the witness and public input data from acir and with the goblin-owned op_queue
     auto builder = MegaCircuitBuilder{ op_queue, witness, constraint_system.public_inputs, constraint_system.varnum };
+    if (count_only) {
+        builder.set_count_only();
+    }
 
     // Populate constraints in the builder via the data in constraint_system
     bool has_valid_witness_assignments = !witness.empty();
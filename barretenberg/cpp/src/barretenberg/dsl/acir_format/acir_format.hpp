@@ -127,6 +127,14 @@ struct AcirFormat {
     // Indices of the original opcode that originated each constraint in AcirFormat.
     AcirFormatOriginalOpcodeIndices original_opcode_indices;
 
+    // Strategies of the in-circuit scalar multiplications. They change the circuit, and are not part of the bytecode,
+    // so that existing programs keep their circuits by default; bb sets them from --msm_table_bits and
+    // --ecdsa_r1_windowed_batch_mul:
+    // the window size of the Straus tables of the multi_scalar_mul constraints (0 for the cycle_group default), and
+    // whether secp256r1 ECDSA verification uses windowed ROM tables (see stdlib::ecdsa_mul)
+    size_t msm_table_bits = 0;
+    bool ecdsa_r1_windowed_batch_mul = false;
+
     // For serialization, update with any new fields
     MSGPACK_FIELDS(varnum,
                    public_inputs,
@@ -209,7 +217,9 @@ Builder create_circuit(AcirFormat& constraint_system,
                        const WitnessVector& witness = {},
                        bool honk_recursion = false,
                        std::shared_ptr<bb::ECCOpQueue> op_queue = std::make_shared<bb::ECCOpQueue>(),
-                       bool collect_gates_per_opcode = false);
+                       bool collect_gates_per_opcode = false,
+                       // Only generate the witness and count gates, see UltraCircuitBuilder_::set_count_only()
+                       bool count_only = false);
 
 MegaCircuitBuilder create_kernel_circuit(AcirFormat& constraint_system,
                                          ClientIVC& ivc,
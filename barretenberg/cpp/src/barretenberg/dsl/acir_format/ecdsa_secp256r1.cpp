@@ -31,7 +31,8 @@ secp256r1_ct::g1_ct ecdsa_convert_inputs(Builder* ctx, const secp256r1::g1::affi
 template <typename Builder>
 void create_ecdsa_r1_verify_constraints(Builder& builder,
                                         const EcdsaSecp256r1Constraint& input,
-                                        bool has_valid_witness_assignments)
+                                        bool has_valid_witness_assignments,
+                                        bool use_windowed_batch_mul)
 {
     using secp256r1_ct = bb::stdlib::secp256r1<Builder>;
     using bool_ct = bb::stdlib::bool_t<Builder>;
@@ -78,7 +79,7 @@ void create_ecdsa_r1_verify_constraints(Builder& builder,
                                                                   typename secp256r1_ct::fq_ct,
                                                                   typename secp256r1_ct::bigfr_ct,
                                                                   typename secp256r1_ct::g1_bigfr_ct>(
-            message, public_key, sig);
+            message, public_key, sig, use_windowed_batch_mul);
     bool_ct signature_result_normalized = signature_result.normalize();
     builder.assert_equal(signature_result_normalized.witness_index, input.result);
 }
@@ -148,10 +149,12 @@ template <typename Builder> void dummy_ecdsa_constraint(Builder& builder, EcdsaS
 
 template void create_ecdsa_r1_verify_constraints<UltraCircuitBuilder>(UltraCircuitBuilder& builder,
                                                                       const EcdsaSecp256r1Constraint& input,
-                                                                      bool has_valid_witness_assignments);
+                                                                      bool has_valid_witness_assignments,
+                                                                      bool use_windowed_batch_mul);
 template void create_ecdsa_r1_verify_constraints<MegaCircuitBuilder>(MegaCircuitBuilder& builder,
                                                                      const EcdsaSecp256r1Constraint& input,
-                                                                     bool has_valid_witness_assignments);
+                                                                     bool has_valid_witness_assignments,
+                                                                     bool use_windowed_batch_mul);
 template void dummy_ecdsa_constraint<UltraCircuitBuilder>(UltraCircuitBuilder& builder,
                                                           EcdsaSecp256r1Constraint const& input);
 
@@ -31,7 +31,8 @@ struct EcdsaSecp256r1Constraint {
 template <typename Builder>
 void create_ecdsa_r1_verify_constraints(Builder& builder,
                                         const EcdsaSecp256r1Constraint& input,
-                                        bool has_valid_witness_assignments = true);
+                                        bool has_valid_witness_assignments = true,
+                                        bool use_windowed_batch_mul = false);
 
 template <typename Builder> void dummy_ecdsa_constraint(Builder& builder, EcdsaSecp256r1Constraint const& input);
 
@@ -13,7 +13,8 @@ using namespace bb;
 template <typename Builder>
 void create_multi_scalar_mul_constraint(Builder& builder,
                                         const MultiScalarMul& input,
-                                        bool has_valid_witness_assignments)
+                                        bool has_valid_witness_assignments,
+                                        size_t table_bits)
 {
     using cycle_group_ct = stdlib::cycle_group<Builder>;
     using cycle_scalar_ct = typename stdlib::cycle_group<Builder>::cycle_scalar;
@@ -37,7 +38,10 @@ void create_multi_scalar_mul_constraint(Builder& builder,
         scalars.push_back(scalar);
     }
     // Call batch_mul to multiply the points and scalars and sum the results
-    auto output_point = cycle_group_ct::batch_mul(points, scalars).get_standard_form();
+    if (table_bits == 0) {
+        table_bits = cycle_group_ct::TABLE_BITS;
+    }
+    auto output_point = cycle_group_ct::batch_mul(points, scalars, {}, table_bits).get_standard_form();
 
     // Add the constraints and handle constant values
     if (output_point.is_point_at_infinity().is_constant()) {
@@ -59,9 +63,11 @@ void create_multi_scalar_mul_constraint(Builder& builder,
 
 template void create_multi_scalar_mul_constraint<UltraCircuitBuilder>(UltraCircuitBuilder& builder,
                                                                       const MultiScalarMul& input,
-                                                                      bool has_valid_witness_assignments);
+                                                                      bool has_valid_witness_assignments,
+                                                                      size_t table_bits);
 template void create_multi_scalar_mul_constraint<MegaCircuitBuilder>(MegaCircuitBuilder& builder,
                                                                      const MultiScalarMul& input,
-                                                                     bool has_valid_witness_assignments);
+                                                                     bool has_valid_witness_assignments,
+                                                                     size_t table_bits);
 
 } // namespace acir_format
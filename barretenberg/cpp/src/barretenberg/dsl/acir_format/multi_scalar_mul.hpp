@@ -21,9 +21,11 @@ struct MultiScalarMul {
     friend bool operator==(MultiScalarMul const& lhs, MultiScalarMul const& rhs) = default;
 };
 
+// table_bits is the window size of the Straus tables of cycle_group::batch_mul, 0 for its default
 template <typename Builder>
 void create_multi_scalar_mul_constraint(Builder& builder,
                                         const MultiScalarMul& input,
-                                        bool has_valid_witness_assignments);
+                                        bool has_valid_witness_assignments,
+                                        size_t table_bits = 0);
 
 } // namespace acir_format
@@ -19,7 +19,14 @@ WASM_EXPORT void acir_get_circuit_sizes(
 {
     auto constraint_system =
         acir_format::circuit_buf_to_acir_format(from_buffer<std::vector<uint8_t>>(acir_vec), *honk_recursion);
-    auto builder = acir_format::create_circuit(constraint_system, recursive, 1 << 19, {}, *honk_recursion);
+    auto builder = acir_format::create_circuit(constraint_system,
+                                               recursive,
+                                               1 << 19,
+                                               {},
+                                               *honk_recursion,
+                                               std::make_shared<bb::ECCOpQueue>(),
+                                               /*collect_gates_per_opcode=*/false,
+                                               /*count_only=*/true);
     builder.finalize_circuit(/*ensure_nonzero=*/true);
     *total = htonl((uint32_t)builder.get_finalized_total_circuit_size());
     *subgroup = htonl((uint32_t)builder.get_circuit_subgroup_size(builder.get_finalized_total_circuit_size()));
@@ -219,9 +226,10 @@ WASM_EXPORT void acir_serialize_verification_key_into_fields(in_ptr acir_compose
     write(out_key_hash, vk_hash);
 }
 
-WASM_EXPORT void acir_prove_and_verify_aztec_client(uint8_t const* acir_stack,
-                                                    uint8_t const* witness_stack,
-                                                    bool* verified)
+namespace {
+bool prove_and_verify_aztec_client(uint8_t const* acir_stack,
+                                   uint8_t const* witness_stack,
+                                   const TraceSettings& trace_structure)
 {
     using Program = acir_format::AcirProgram;
 
@@ -239,7 +247,7 @@ WASM_EXPORT void acir_prove_and_verify_aztec_client(uint8_t const* acir_stack,
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/1101): remove use of auto_verify_mode
     ClientIVC ivc;
     ivc.auto_verify_mode = true;
-    ivc.trace_structure = TraceStructure::E2E_FULL_TEST;
+    ivc.trace_structure = trace_structure;
 
     // Accumulate the entire program stack into the IVC
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/1116): remove manual setting of is_kernel once databus
@@ -270,7 +278,26 @@ WASM_EXPORT void acir_prove_and_verify_aztec_client(uint8_t const* acir_stack,
     bool result = ivc.prove_and_verify();
     info("verified?: ", result);
 
-    *verified = result;
+    return result;
+}
+} // namespace
+
+WASM_EXPORT void acir_prove_and_verify_aztec_client(uint8_t const* acir_stack,
+                                                    uint8_t const* witness_stack,
+                                                    bool* verified)
+{
+    *verified = prove_and_verify_aztec_client(acir_stack, witness_stack, TraceStructure::E2E_FULL_TEST);
+}
+
+WASM_EXPORT void acir_prove_and_verify_aztec_client_with_trace_structure(uint8_t const* acir_stack,
+                                                                         uint8_t const* witness_stack,
+                                                                         uint8_t const* trace_structure_buf,
+                                                                         bool* verified)
+{
+    const auto serialized = from_buffer<std::vector<uint8_t>>(trace_structure_buf);
+    const TraceSettings trace_structure = ExecutionTraceUsageTracker::to_trace_settings(
+        ExecutionTraceUsageTracker::deserialize_block_sizes(std::string(serialized.begin(), serialized.end())));
+    *verified = prove_and_verify_aztec_client(acir_stack, witness_stack, trace_structure);
 }
 
 WASM_EXPORT void acir_prove_ultra_honk(uint8_t const* acir_vec,
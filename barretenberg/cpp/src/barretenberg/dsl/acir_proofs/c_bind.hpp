@@ -53,6 +53,15 @@ WASM_EXPORT void acir_prove_and_verify_aztec_client(uint8_t const* constraint_sy
                                                     uint8_t const* witness_buf,
                                                     bool* result);
 
+/**
+ * @brief Same as acir_prove_and_verify_aztec_client, with a structured trace given by its block sizes, in the format of
+ * ExecutionTraceUsageTracker::serialize_block_sizes, instead of E2E_FULL_TEST
+ */
+WASM_EXPORT void acir_prove_and_verify_aztec_client_with_trace_structure(uint8_t const* constraint_system_buf,
+                                                                         uint8_t const* witness_buf,
+                                                                         uint8_t const* trace_structure_buf,
+                                                                         bool* result);
+
 /**
  * @brief Fold and verify a set of circuits using ClientIvc
  *
@@ -1,4 +1,5 @@
 #include "fr.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/serialize/test_helper.hpp"
 #include <gtest/gtest.h>
 
@@ -361,6 +362,36 @@ TEST(fr, BatchInvert)
     }
 }
 
+/**
+ * @brief Check batch inversion of inputs large enough to be split across threads, including zeros (which are left
+ * unchanged) and a call from within a parallel_for (which must fall back to serial processing)
+ */
+TEST(fr, BatchInvertLarge)
+{
+    const size_t n = 4 * fr::BATCH_INVERT_MIN_CHUNK_SIZE + 3;
+    std::vector<fr> coeffs(n);
+    for (size_t i = 0; i < n; ++i) {
+        coeffs[i] = (i % 1000 == 0) ? fr::zero() : fr::random_element();
+    }
+    const auto check_inverses = [&](std::span<const fr> inverses) {
+        for (size_t i = 0; i < n; ++i) {
+            if (coeffs[i].is_zero()) {
+                EXPECT_TRUE(inverses[i].is_zero());
+            } else {
+                EXPECT_EQ(coeffs[i] * inverses[i], fr::one());
+            }
+        }
+    };
+
+    std::vector<fr> inverses = coeffs;
+    fr::batch_invert(inverses);
+    check_inverses(inverses);
+
+    std::vector<fr> nested_inverses = coeffs;
+    parallel_for(1, [&](size_t) { fr::batch_invert(nested_inverses); });
+    check_inverses(nested_inverses);
+}
+
 TEST(fr, MultiplicativeGenerator)
 {
     EXPECT_EQ(fr::multiplicative_generator(), fr(5));
@@ -312,6 +312,32 @@ TEST(grumpkin, BatchMul)
         EXPECT_EQ(result[i].y, expected[i].y);
     }
 }
+// The result must not depend on how the points are split into chunks
+TEST(grumpkin, BatchMulChunkSizes)
+{
+    constexpr size_t num_points = 300;
+
+    std::vector<grumpkin::g1::affine_element> affine_points;
+    for (size_t i = 0; i < num_points; ++i) {
+        affine_points.emplace_back(grumpkin::g1::element::random_element());
+    }
+    affine_points[17].self_set_infinity();
+    const grumpkin::fr exponent = grumpkin::fr::random_element();
+
+    std::vector<grumpkin::g1::affine_element> expected;
+    for (const auto& point : affine_points) {
+        expected.emplace_back(point * exponent);
+    }
+    for (const size_t max_chunk_size : { 1UL, 7UL, 128UL, 4096UL }) {
+        const auto result = grumpkin::g1::element::batch_mul_with_endomorphism(affine_points, exponent, max_chunk_size);
+        EXPECT_EQ(result, expected);
+    }
+    // Fewer points than BATCH_MUL_MIN_BATCHED_SIZE are multiplied individually
+    const auto small_result =
+        grumpkin::g1::element::batch_mul_with_endomorphism(std::span(affine_points).subspan(10, 10), exponent);
+    EXPECT_EQ(small_result, std::vector(expected.begin() + 10, expected.begin() + 20));
+}
+
 // Checks for "bad points" in terms of sharing a y-coordinate as explained here:
 // https://github.com/AztecProtocol/aztec2-internal/issues/437
 TEST(grumpkin, BadPoints)
@@ -521,3 +521,41 @@ TEST(secp256k1, MontgomeryMulBigBug)
     secp256k1::fq expected(uint256_t{ 0x60381e557e100000, 0x0, 0x0, 0x0 });
     EXPECT_EQ((a_sqr == expected), true);
 }
+
+TEST(secp256k1, MultiScalarMul)
+{
+    // Includes a zero scalar, a point at infinity and a repeated point
+    const size_t num_points = 13;
+    std::vector<secp256k1::g1::affine_element> points(num_points);
+    std::vector<secp256k1::fr> scalars(num_points);
+    secp256k1::g1::element expected = secp256k1::g1::point_at_infinity;
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = secp256k1::g1::element::random_element(&engine);
+        scalars[i] = secp256k1::fr::random_element(&engine);
+    }
+    points[3] = points[2];
+    scalars[5] = 0;
+    points[7].self_set_infinity();
+    for (size_t i = 0; i < num_points; ++i) {
+        if (!points[i].is_point_at_infinity()) {
+            expected += secp256k1::g1::element(points[i]) * scalars[i];
+        }
+    }
+
+    secp256k1::g1::element result = secp256k1::g1::element::multi_scalar_mul(points, scalars);
+    EXPECT_EQ(secp256k1::g1::affine_element(result), secp256k1::g1::affine_element(expected));
+}
+
+TEST(secp256k1, FixedBaseTableMul)
+{
+    const secp256k1::g1::fixed_base_table table(secp256k1::g1::affine_one);
+    // Scalars with all-ones windows exercise the signed digit carries
+    std::vector<secp256k1::fr> scalars{ 0, 1, -secp256k1::fr(1), secp256k1::fr(uint256_t(0xffffffffffffffffULL)) };
+    for (size_t i = 0; i < 8; ++i) {
+        scalars.push_back(secp256k1::fr::random_element(&engine));
+    }
+    const auto results = table.batch_mul(scalars);
+    for (size_t i = 0; i < scalars.size(); ++i) {
+        EXPECT_EQ(results[i], secp256k1::g1::affine_element(secp256k1::g1::one * scalars[i]));
+    }
+}
@@ -323,6 +323,8 @@ template <class Params_> struct alignas(32) field {
     static constexpr uint256_t modulus_minus_two =
         uint256_t(Params::modulus_0 - 2ULL, Params::modulus_1, Params::modulus_2, Params::modulus_3);
     constexpr field invert() const noexcept;
+    // Minimum number of elements per chunk when batch_invert splits its input across threads
+    static constexpr size_t BATCH_INVERT_MIN_CHUNK_SIZE = 1 << 14;
     static void batch_invert(std::span<field> coeffs) noexcept;
     static void batch_invert(field* coeffs, size_t n) noexcept;
     /**
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "./field_declarations.hpp"
+#include "./field_parallel.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
 
 namespace bb {
@@ -404,11 +405,24 @@ template <class T> void field<T>::batch_invert(field* coeffs, const size_t n) no
     batch_invert(std::span{ coeffs, n });
 }
 
+/**
+ * @brief Invert each non-zero element of coeffs in place using Montgomery's trick; zero elements are left unchanged.
+ * @details Large inputs are split into chunks which are batch inverted independently in parallel, at the cost of one
+ * field inversion per chunk. Inputs smaller than 2 * BATCH_INVERT_MIN_CHUNK_SIZE, and calls made from within a
+ * parallel_for (which is typically already parallelised over such calls and cannot be nested), are processed serially.
+ */
 template <class T> void field<T>::batch_invert(std::span<field> coeffs) noexcept
 {
     BB_OP_COUNT_TRACK_NAME("fr::batch_invert");
     const size_t n = coeffs.size();
 
+    // Chunks are processed serially by the nested calls, which run within parallel_for
+    if (parallel_for_field_chunks(n, BATCH_INVERT_MIN_CHUNK_SIZE, [&](size_t start, size_t end) {
+            batch_invert(coeffs.subspan(start, end - start));
+        })) {
+        return;
+    }
+
     auto temporaries_ptr = std::static_pointer_cast<field[]>(get_mem_slab(n * sizeof(field)));
     auto skipped_ptr = std::static_pointer_cast<bool[]>(get_mem_slab(n));
     auto temporaries = temporaries_ptr.get();
@@ -0,0 +1,24 @@
+#include "barretenberg/ecc/fields/field_parallel.hpp"
+#include "barretenberg/common/thread.hpp"
+#include <algorithm>
+
+namespace bb {
+
+bool parallel_for_field_chunks(size_t n, size_t min_chunk_size, const std::function<void(size_t, size_t)>& func)
+{
+    const size_t num_chunks = is_in_parallel_for() ? 1 : calculate_num_threads(n, min_chunk_size);
+    if (num_chunks <= 1) {
+        return false;
+    }
+    const size_t chunk_size = (n + num_chunks - 1) / num_chunks;
+    parallel_for(num_chunks, [&](size_t chunk_idx) {
+        const size_t start = chunk_idx * chunk_size;
+        const size_t end = std::min(start + chunk_size, n);
+        if (start < end) {
+            func(start, end);
+        }
+    });
+    return true;
+}
+
+} // namespace bb
@@ -0,0 +1,19 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+
+namespace bb {
+
+/**
+ * @brief Split the range [0, n) into one chunk per thread, of at least min_chunk_size elements each, and call
+ * func(start, end) on every chunk in parallel
+ * @details Used by field routines that parallelise large inputs internally. It is declared apart from
+ * common/thread.hpp, and defined in a translation unit, so that the field headers do not depend on the thread pool.
+ * Nothing is called if the range is too small to be split, or if the calling thread is itself running an iteration of
+ * a parallel_for, which cannot be nested.
+ *
+ * @return Whether the range was processed, i.e. false if the caller should process it serially
+ */
+bool parallel_for_field_chunks(size_t n, size_t min_chunk_size, const std::function<void(size_t, size_t)>& func);
+
+} // namespace bb
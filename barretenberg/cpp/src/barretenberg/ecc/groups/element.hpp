@@ -94,8 +94,17 @@ template <class Fq, class Fr, class Params> class alignas(32) element {
     static void batch_affine_add(const std::span<affine_element<Fq, Fr, Params>>& first_group,
                                  const std::span<affine_element<Fq, Fr, Params>>& second_group,
                                  const std::span<affine_element<Fq, Fr, Params>>& results) noexcept;
+    // Bounds on the number of points per chunk when batch_mul_with_endomorphism splits its input across threads
+    static constexpr size_t BATCH_MUL_MIN_CHUNK_SIZE = 1 << 7;
+    static constexpr size_t BATCH_MUL_MAX_CHUNK_SIZE = 1 << 12;
+    // Below this many points the ~330 inversions of the batched ladder cost more than individual multiplications
+    static constexpr size_t BATCH_MUL_MIN_BATCHED_SIZE = 32;
     static std::vector<affine_element<Fq, Fr, Params>> batch_mul_with_endomorphism(
-        const std::span<const affine_element<Fq, Fr, Params>>& points, const Fr& scalar) noexcept;
+        const std::span<const affine_element<Fq, Fr, Params>>& points,
+        const Fr& scalar,
+        size_t max_chunk_size = BATCH_MUL_MAX_CHUNK_SIZE) noexcept;
+    static element multi_scalar_mul(const std::span<const affine_element<Fq, Fr, Params>>& points,
+                                    const std::span<const Fr>& scalars) noexcept;
 
     Fq x;
     Fq y;
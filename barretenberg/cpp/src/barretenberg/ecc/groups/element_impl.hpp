@@ -784,21 +784,26 @@ void element<Fq, Fr, T>::batch_affine_add(const std::span<affine_element<Fq, Fr,
  * @details We use the fact that all points are being multiplied by the same scalar to batch the operations (perform
  * batch affine additions and doublings with batch inversion trick)
  *
+ * The points are split into chunks that are processed independently and in parallel: each chunk runs the whole wnaf
+ * ladder over its own points with its own batch inversions. This needs a single parallel_for per call, rather than one
+ * per batched doubling or addition (~330 of them), and keeps the lookup table of a chunk in cache. Chunks are at most
+ * max_chunk_size points; smaller chunks pay for more field inversions. Inputs of fewer than BATCH_MUL_MIN_BATCHED_SIZE
+ * points are multiplied individually instead.
+ *
  * @param points The span of individual points that need to be scaled
  * @param scalar The scalar we multiply all the points by
+ * @param max_chunk_size The maximum number of points processed together
  * @return std::vector<affine_element<Fq, Fr, T>> Vector of new points where each point is exponent⋅points[i]
  */
 template <class Fq, class Fr, class T>
 std::vector<affine_element<Fq, Fr, T>> element<Fq, Fr, T>::batch_mul_with_endomorphism(
-    const std::span<const affine_element<Fq, Fr, T>>& points, const Fr& scalar) noexcept
+    const std::span<const affine_element<Fq, Fr, T>>& points, const Fr& scalar, const size_t max_chunk_size) noexcept
 {
     PROFILE_THIS();
+    ASSERT(max_chunk_size > 0);
     typedef affine_element<Fq, Fr, T> affine_element;
     const size_t num_points = points.size();
 
-    // Space for temporary values
-    std::vector<Fq> scratch_space(num_points);
-
     // TODO(#826): Same code as in batch add
     //  we can mutate rhs but NOT lhs!
     //  output is stored in rhs
@@ -831,20 +836,6 @@ std::vector<affine_element<Fq, Fr, T>> element<Fq, Fr, T>::batch_mul_with_endomo
             }
         };
 
-    /**
-     * @brief Perform batch affine addition in parallel
-     *
-     */
-    const auto batch_affine_add_internal =
-        [num_points, &scratch_space, &batch_affine_add_chunked](const affine_element* lhs, affine_element* rhs) {
-            parallel_for_heuristic(
-                num_points,
-                [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
-                    batch_affine_add_chunked(lhs + start, rhs + start, end - start, &scratch_space[0] + start);
-                },
-                thread_heuristics::FF_ADDITION_COST * 6 + thread_heuristics::FF_MULTIPLICATION_COST * 6);
-        };
-
     /**
      * @brief Perform point doubling lhs[i]=lhs[i]+lhs[i] with batch inversion
      *
@@ -876,19 +867,6 @@ std::vector<affine_element<Fq, Fr, T>> element<Fq, Fr, T>::batch_mul_with_endomo
                 lhs[i].y = personal_scratch_space[i] * (temp - lhs[i].x) - lhs[i].y;
             }
         };
-    /**
-     * @brief Perform point doubling in parallel
-     *
-     */
-    const auto batch_affine_double = [num_points, &scratch_space, &batch_affine_double_chunked](affine_element* lhs) {
-        parallel_for_heuristic(
-            num_points,
-            [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
-                batch_affine_double_chunked(lhs + start, end - start, &scratch_space[0] + start);
-            },
-            thread_heuristics::FF_ADDITION_COST * 7 + thread_heuristics::FF_MULTIPLICATION_COST * 6);
-    };
-
     // We compute the resulting point through WNAF by evaluating (the (\sum_i (16ⁱ⋅
     // (a_i ∈ {-15,-13,-11,-9,-7,-5,-3,-1,1,3,5,7,9,11,13,15}))) - skew), where skew is 0 or 1. The result of the sum is
     // always odd and skew is used to reconstruct an even scalar. This means that to construct scalar p-1, where p is
@@ -914,124 +892,202 @@ std::vector<affine_element<Fq, Fr, T>> element<Fq, Fr, T>::batch_mul_with_endomo
         return results;
     }
 
-    constexpr size_t LOOKUP_SIZE = 8;
-    constexpr size_t NUM_ROUNDS = 32;
-    std::array<std::vector<affine_element>, LOOKUP_SIZE> lookup_table;
-    for (auto& table : lookup_table) {
-        table.resize(num_points);
-    }
-    // Initialize first etnries in lookup table
-    std::vector<affine_element> temp_point_vector(num_points);
-    parallel_for_heuristic(
-        num_points,
-        [&](size_t i) {
-            // If the point is at infinity we fix-up the result later
-            // To avoid 'trying to invert zero in the field' we set the point to 'one' here
-            temp_point_vector[i] = points[i].is_point_at_infinity() ? affine_element::one() : points[i];
-            lookup_table[0][i] = points[i].is_point_at_infinity() ? affine_element::one() : points[i];
-        },
-        thread_heuristics::FF_COPY_COST * 2);
-
-    // Construct lookup table
-    batch_affine_double(&temp_point_vector[0]);
-    for (size_t j = 1; j < LOOKUP_SIZE; ++j) {
-        parallel_for_heuristic(
-            num_points,
-            [&](size_t i) { lookup_table[j][i] = lookup_table[j - 1][i]; },
-            thread_heuristics::FF_COPY_COST);
-        batch_affine_add_internal(&temp_point_vector[0], &lookup_table[j][0]);
+    // Too few points to amortise the inversions of the batched ladder (e.g. the last rounds of IPA)
+    if (num_points < BATCH_MUL_MIN_BATCHED_SIZE) {
+        std::vector<element> products(num_points);
+        for (size_t i = 0; i < num_points; ++i) {
+            products[i] = element(points[i]) * scalar;
+        }
+        batch_normalize(products.data(), num_points);
+        std::vector<affine_element> results(num_points);
+        for (size_t i = 0; i < num_points; ++i) {
+            // z = 1 after batch_normalize, so avoid the inversion in the conversion operator
+            results[i] = products[i].is_point_at_infinity() ? affine_element(products[i])
+                                                            : affine_element(products[i].x, products[i].y);
+        }
+        return results;
     }
 
+    constexpr size_t LOOKUP_SIZE = 8;
+    constexpr size_t NUM_ROUNDS = 32;
     detail::EndoScalars endo_scalars = Fr::split_into_endomorphism_scalars(converted_scalar);
     detail::EndomorphismWnaf<element, NUM_ROUNDS> wnaf{ endo_scalars };
+    constexpr Fq beta = Fq::cube_root_of_unity();
 
     std::vector<affine_element> work_elements(num_points);
 
-    constexpr Fq beta = Fq::cube_root_of_unity();
-    uint64_t wnaf_entry = 0;
-    uint64_t index = 0;
-    bool sign = 0;
-    // Prepare elements for the first batch addition
-    for (size_t j = 0; j < 2; ++j) {
-        wnaf_entry = wnaf.table[j];
-        index = wnaf_entry & 0x0fffffffU;
-        sign = static_cast<bool>((wnaf_entry >> 31) & 1);
-        const bool is_odd = ((j & 1) == 1);
-        parallel_for_heuristic(
-            num_points,
-            [&](size_t i) {
-                auto to_add = lookup_table[static_cast<size_t>(index)][i];
-                to_add.y.self_conditional_negate(sign ^ is_odd);
+    /**
+     * @brief Compute the results for the points in [start, start + chunk_points)
+     *
+     */
+    const auto mul_chunk = [&](const size_t start, const size_t chunk_points) {
+        const affine_element* chunk_points_in = &points[start];
+        affine_element* chunk_results = &work_elements[start];
+        std::vector<Fq> scratch_space(chunk_points);
+        std::vector<affine_element> temp_point_vector(chunk_points);
+        const auto batch_affine_add_internal = [&](affine_element* rhs) {
+            batch_affine_add_chunked(&temp_point_vector[0], rhs, chunk_points, &scratch_space[0]);
+        };
+        const auto batch_affine_double = [&](affine_element* lhs) {
+            batch_affine_double_chunked(lhs, chunk_points, &scratch_space[0]);
+        };
+
+        // Initialize first entries in lookup table
+        for (size_t i = 0; i < chunk_points; ++i) {
+            // If the point is at infinity we fix-up the result later
+            // To avoid 'trying to invert zero in the field' we set the point to 'one' here
+            const bool is_infinity = chunk_points_in[i].is_point_at_infinity();
+            temp_point_vector[i] = is_infinity ? affine_element::one() : chunk_points_in[i];
+        }
+        std::array<std::vector<affine_element>, LOOKUP_SIZE> lookup_table;
+        lookup_table[0] = temp_point_vector;
+
+        // Construct lookup table
+        batch_affine_double(&temp_point_vector[0]);
+        for (size_t j = 1; j < LOOKUP_SIZE; ++j) {
+            lookup_table[j] = lookup_table[j - 1];
+            batch_affine_add_internal(&lookup_table[j][0]);
+        }
+
+        // Write the (signed, possibly endomorphism-mapped) lookup table entries for wnaf digit j into output
+        const auto select_wnaf_points = [&](const size_t j, affine_element* output) {
+            const uint64_t wnaf_entry = wnaf.table[j];
+            const auto index = static_cast<size_t>(wnaf_entry & 0x0fffffffU);
+            const bool sign = static_cast<bool>((wnaf_entry >> 31) & 1);
+            const bool is_odd = ((j & 1) == 1);
+            for (size_t i = 0; i < chunk_points; ++i) {
+                output[i] = lookup_table[index][i];
+                output[i].y.self_conditional_negate(sign ^ is_odd);
                 if (is_odd) {
-                    to_add.x *= beta;
+                    output[i].x *= beta;
                 }
-                if (j == 0) {
-                    work_elements[i] = to_add;
-                } else {
-                    temp_point_vector[i] = to_add;
+            }
+        };
+
+        // Prepare elements for the first batch addition
+        select_wnaf_points(0, chunk_results);
+        select_wnaf_points(1, &temp_point_vector[0]);
+        // First cycle of addition
+        batch_affine_add_internal(chunk_results);
+        // Run through SM logic in wnaf form (excluding the skew)
+        for (size_t j = 2; j < NUM_ROUNDS * 2; ++j) {
+            if ((j & 1) == 0) {
+                for (size_t k = 0; k < 4; ++k) {
+                    batch_affine_double(chunk_results);
                 }
-            },
-            (is_odd ? thread_heuristics::FF_MULTIPLICATION_COST : 0) + thread_heuristics::FF_COPY_COST +
-                thread_heuristics::FF_ADDITION_COST);
-    }
-    // First cycle of addition
-    batch_affine_add_internal(&temp_point_vector[0], &work_elements[0]);
-    // Run through SM logic in wnaf form (excluding the skew)
-    for (size_t j = 2; j < NUM_ROUNDS * 2; ++j) {
-        wnaf_entry = wnaf.table[j];
-        index = wnaf_entry & 0x0fffffffU;
-        sign = static_cast<bool>((wnaf_entry >> 31) & 1);
-        const bool is_odd = ((j & 1) == 1);
-        if (!is_odd) {
-            for (size_t k = 0; k < 4; ++k) {
-                batch_affine_double(&work_elements[0]);
             }
+            select_wnaf_points(j, &temp_point_vector[0]);
+            batch_affine_add_internal(chunk_results);
         }
-        parallel_for_heuristic(
-            num_points,
-            [&](size_t i) {
-                auto to_add = lookup_table[static_cast<size_t>(index)][i];
-                to_add.y.self_conditional_negate(sign ^ is_odd);
-                if (is_odd) {
-                    to_add.x *= beta;
-                }
-                temp_point_vector[i] = to_add;
-            },
-            (is_odd ? thread_heuristics::FF_MULTIPLICATION_COST : 0) + thread_heuristics::FF_COPY_COST +
-                thread_heuristics::FF_ADDITION_COST);
-        batch_affine_add_internal(&temp_point_vector[0], &work_elements[0]);
-    }
 
-    // Apply skew for the first endo scalar
-    if (wnaf.skew) {
-        parallel_for_heuristic(
-            num_points,
-            [&](size_t i) { temp_point_vector[i] = -lookup_table[0][i]; },
-            thread_heuristics::FF_ADDITION_COST + thread_heuristics::FF_COPY_COST);
-        batch_affine_add_internal(&temp_point_vector[0], &work_elements[0]);
-    }
-    // Apply skew for the second endo scalar
-    if (wnaf.endo_skew) {
-        parallel_for_heuristic(
-            num_points,
-            [&](size_t i) {
+        // Apply skew for the first endo scalar
+        if (wnaf.skew) {
+            for (size_t i = 0; i < chunk_points; ++i) {
+                temp_point_vector[i] = -lookup_table[0][i];
+            }
+            batch_affine_add_internal(chunk_results);
+        }
+        // Apply skew for the second endo scalar
+        if (wnaf.endo_skew) {
+            for (size_t i = 0; i < chunk_points; ++i) {
                 temp_point_vector[i] = lookup_table[0][i];
                 temp_point_vector[i].x *= beta;
-            },
-            thread_heuristics::FF_MULTIPLICATION_COST + thread_heuristics::FF_COPY_COST);
-        batch_affine_add_internal(&temp_point_vector[0], &work_elements[0]);
-    }
-    // handle points at infinity explicitly
-    parallel_for_heuristic(
-        num_points,
-        [&](size_t i) {
-            work_elements[i] = points[i].is_point_at_infinity() ? work_elements[i].set_infinity() : work_elements[i];
-        },
-        thread_heuristics::FF_COPY_COST);
+            }
+            batch_affine_add_internal(chunk_results);
+        }
+        // handle points at infinity explicitly
+        for (size_t i = 0; i < chunk_points; ++i) {
+            if (chunk_points_in[i].is_point_at_infinity()) {
+                chunk_results[i].self_set_infinity();
+            }
+        }
+    };
+
+    const size_t num_chunks = std::max(calculate_num_threads(num_points, BATCH_MUL_MIN_CHUNK_SIZE),
+                                       (num_points + max_chunk_size - 1) / max_chunk_size);
+    const size_t chunk_size = (num_points + num_chunks - 1) / num_chunks;
+    parallel_for(num_chunks, [&](size_t chunk_idx) {
+        const size_t start = chunk_idx * chunk_size;
+        const size_t end = std::min(start + chunk_size, num_points);
+        if (start < end) {
+            mul_chunk(start, end - start);
+        }
+    });
 
     return work_elements;
 }
 
+/**
+ * @brief Compute ∑ᵢ scalars[i]⋅points[i] with the bucket method
+ *
+ * @details A generic single-threaded Pippenger for curves that the (BN254/Grumpkin only) scalar_multiplication module
+ * does not cover, e.g. for batch verification of secp256k1/secp256r1 signatures. Scalars are processed in windows of
+ * c bits from the most significant end; in each window every point is added to the bucket of its c-bit digit (mixed
+ * additions), and the buckets are combined with a running sum as ∑ⱼ j⋅Bⱼ = ∑ⱼ (Bⱼ + Bⱼ₊₁ + ...). The window size is
+ * chosen to minimise the ⌈b/c⌉⋅(n + 2ᶜ⁺¹) group additions.
+ *
+ * @param points The base points, points at infinity are skipped
+ * @param scalars One scalar per point
+ * @return element The (non-normalized) sum
+ */
+template <class Fq, class Fr, class T>
+element<Fq, Fr, T> element<Fq, Fr, T>::multi_scalar_mul(const std::span<const affine_element<Fq, Fr, T>>& points,
+                                                        const std::span<const Fr>& scalars) noexcept
+{
+    PROFILE_THIS();
+    ASSERT(points.size() == scalars.size());
+    const size_t num_points = points.size();
+
+    std::vector<uint256_t> standard_scalars(num_points);
+    size_t num_bits = 0;
+    for (size_t i = 0; i < num_points; ++i) {
+        standard_scalars[i] = uint256_t(scalars[i]);
+        if (standard_scalars[i] != 0) {
+            num_bits = std::max(num_bits, static_cast<size_t>(standard_scalars[i].get_msb()) + 1);
+        }
+    }
+    element result = element::infinity();
+    if (num_bits == 0) {
+        return result;
+    }
+
+    size_t window_bits = 1;
+    size_t min_cost = SIZE_MAX;
+    for (size_t c = 1; c <= 16; ++c) {
+        const size_t cost = ((num_bits + c - 1) / c) * (num_points + (2UL << c));
+        if (cost < min_cost) {
+            min_cost = cost;
+            window_bits = c;
+        }
+    }
+    const size_t num_windows = (num_bits + window_bits - 1) / window_bits;
+
+    std::vector<element> buckets((1UL << window_bits) - 1);
+    for (size_t window = num_windows - 1; window < num_windows; --window) {
+        for (size_t i = 0; i < window_bits; ++i) {
+            result.self_dbl();
+        }
+        for (auto& bucket : buckets) {
+            bucket.self_set_infinity();
+        }
+        const uint64_t start = window * window_bits;
+        for (size_t i = 0; i < num_points; ++i) {
+            const auto digit = static_cast<size_t>(standard_scalars[i].slice(start, start + window_bits).data[0]);
+            if (digit != 0 && !points[i].is_point_at_infinity()) {
+                buckets[digit - 1] += points[i];
+            }
+        }
+        element running_sum = element::infinity();
+        element window_sum = element::infinity();
+        for (size_t j = buckets.size() - 1; j < buckets.size(); --j) {
+            running_sum += buckets[j];
+            window_sum += running_sum;
+        }
+        result += window_sum;
+    }
+    return result;
+}
+
 template <typename Fq, typename Fr, typename T>
 void element<Fq, Fr, T>::conditional_negate_affine(const affine_element<Fq, Fr, T>& in,
                                                    affine_element<Fq, Fr, T>& out,
@@ -1043,6 +1099,21 @@ void element<Fq, Fr, T>::conditional_negate_affine(const affine_element<Fq, Fr,
 template <typename Fq, typename Fr, typename T>
 void element<Fq, Fr, T>::batch_normalize(element* elements, const size_t num_elements) noexcept
 {
+    // Split large inputs into chunks normalized in parallel, each at the cost of one extra field inversion
+    const size_t num_chunks =
+        is_in_parallel_for() ? 1 : calculate_num_threads(num_elements, Fq::BATCH_INVERT_MIN_CHUNK_SIZE);
+    if (num_chunks > 1) {
+        const size_t chunk_size = (num_elements + num_chunks - 1) / num_chunks;
+        parallel_for(num_chunks, [&](size_t chunk_idx) {
+            const size_t start = chunk_idx * chunk_size;
+            const size_t end = std::min(start + chunk_size, num_elements);
+            if (start < end) {
+                batch_normalize(elements + start, end - start); // serial, since called from within parallel_for
+            }
+        });
+        return;
+    }
+
     std::vector<Fq> temporaries;
     temporaries.reserve(num_elements * 2);
     Fq accumulator = Fq::one();
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include "element.hpp"
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace bb::group_elements {
+
+/**
+ * @brief Precomputed window table of a single fixed base point, for repeated multiplications of the same point (e.g.
+ * the generator in signature verification, or Pedersen generators)
+ *
+ * @details A scalar k < 2ᵇ is written in signed base-2ʷ digits k = ∑ⱼ dⱼ⋅2ʲʷ with -2ʷ⁻¹ < dⱼ ≤ 2ʷ⁻¹. The table holds
+ * the multiples d⋅2ʲʷ⋅G for every window j and every 1 ≤ d ≤ 2ʷ⁻¹, so that k⋅G is the sum of ⌈(b + 1)/w⌉ table
+ * entries (conditionally negated) with no doublings. For w = 8 and a 256-bit scalar field this is 33 mixed additions
+ * against the ~128 doublings and ~40 additions of element::operator* with the endomorphism, at the cost of a 4224 point
+ * table.
+ *
+ * @tparam Fq, Fr, Params as for element
+ */
+template <class Fq, class Fr, class Params> class FixedBaseWindowTable {
+  public:
+    using Element = element<Fq, Fr, Params>;
+    using AffineElement = affine_element<Fq, Fr, Params>;
+
+    static constexpr size_t NUM_SCALAR_BITS = Fr::modulus.get_msb() + 1;
+    static constexpr size_t DEFAULT_WINDOW_BITS = 8;
+
+    explicit FixedBaseWindowTable(const AffineElement& base_point, size_t window_bits = DEFAULT_WINDOW_BITS)
+        : window_bits(window_bits)
+        , num_windows((NUM_SCALAR_BITS + window_bits) / window_bits)
+        , num_entries_per_window(1UL << (window_bits - 1))
+    {
+        ASSERT(window_bits > 1 && window_bits < 24);
+        std::vector<Element> multiples(num_windows * num_entries_per_window);
+        Element window_base(base_point); // 2^{j * window_bits} * G
+        for (size_t window = 0; window < num_windows; ++window) {
+            Element* window_multiples = &multiples[window * num_entries_per_window];
+            window_multiples[0] = window_base;
+            for (size_t i = 1; i < num_entries_per_window; ++i) {
+                window_multiples[i] = window_multiples[i - 1] + window_base;
+            }
+            // the last entry is 2^{w-1} * 2^{jw} * G, so one doubling gives the base of the next window
+            window_base = window_multiples[num_entries_per_window - 1].dbl();
+        }
+        Element::batch_normalize(multiples.data(), multiples.size());
+        table.reserve(multiples.size());
+        for (const auto& multiple : multiples) {
+            table.emplace_back(multiple.x, multiple.y);
+        }
+    }
+
+    /**
+     * @brief Compute scalar⋅G, not normalized so that callers multiplying many scalars can batch_normalize the results
+     */
+    Element mul(const Fr& scalar) const noexcept
+    {
+        const uint256_t k(scalar);
+        const uint64_t half_window = num_entries_per_window;
+        Element result = Element::infinity();
+        uint64_t carry = 0;
+        for (size_t window = 0; window < num_windows; ++window) {
+            const uint64_t start = window * window_bits;
+            // NUM_SCALAR_BITS + 1 bits are covered, so the final carry is always absorbed by the top window
+            uint64_t digit = k.slice(start, start + window_bits).data[0] + carry;
+            carry = digit > half_window ? 1 : 0;
+            if (digit == 0 || digit == (half_window << 1)) {
+                continue;
+            }
+            const bool is_negative = carry == 1;
+            if (is_negative) {
+                digit = (half_window << 1) - digit;
+            }
+            AffineElement entry = table[window * num_entries_per_window + digit - 1];
+            if (is_negative) {
+                entry.y = -entry.y;
+            }
+            result += entry;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Compute scalars[i]⋅G for every scalar, sharing a single inversion to normalize the results
+     */
+    std::vector<AffineElement> batch_mul(std::span<const Fr> scalars) const noexcept
+    {
+        std::vector<Element> products(scalars.size());
+        for (size_t i = 0; i < scalars.size(); ++i) {
+            products[i] = mul(scalars[i]);
+        }
+        Element::batch_normalize(products.data(), products.size());
+        std::vector<AffineElement> result(products.size());
+        for (size_t i = 0; i < products.size(); ++i) {
+            // z = 1 after batch_normalize, so avoid the inversion in the conversion operator
+            result[i] = products[i].is_point_at_infinity() ? AffineElement(products[i])
+                                                           : AffineElement(products[i].x, products[i].y);
+        }
+        return result;
+    }
+
+    size_t get_window_bits() const { return window_bits; }
+
+    size_t get_memory_usage() const { return table.size() * sizeof(AffineElement); }
+
+  private:
+    size_t window_bits;
+    size_t num_windows;
+    size_t num_entries_per_window;
+    std::vector<AffineElement> table;
+};
+
+} // namespace bb::group_elements
@@ -3,6 +3,7 @@
 #include "../../common/assert.hpp"
 #include "./affine_element.hpp"
 #include "./element.hpp"
+#include "./fixed_base_window_table.hpp"
 #include "./wnaf.hpp"
 #include "barretenberg/common/constexpr_utils.hpp"
 #include "barretenberg/crypto/blake3s/blake3s.hpp"
@@ -33,6 +34,7 @@ template <typename _coordinate_field, typename _subgroup_field, typename GroupPa
     using subgroup_field = _subgroup_field;
     using element = group_elements::element<coordinate_field, subgroup_field, GroupParams>;
     using affine_element = group_elements::affine_element<coordinate_field, subgroup_field, GroupParams>;
+    using fixed_base_table = group_elements::FixedBaseWindowTable<coordinate_field, subgroup_field, GroupParams>;
     using Fq = coordinate_field;
     using Fr = subgroup_field;
     static constexpr bool USE_ENDOMORPHISM = GroupParams::USE_ENDOMORPHISM;
@@ -0,0 +1,376 @@
+#include "./fixed_base_msm.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/batched_affine_addition/batched_affine_addition.hpp"
+
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace bb::scalar_multiplication {
+
+namespace {
+
+/**
+ * @brief Header of a fixed base table file, padded so that the points that follow it are cache line aligned
+ */
+struct FileHeader {
+    static constexpr uint64_t MAGIC = 0x6c62745f65736162; // "base_tbl"
+    uint64_t magic = MAGIC;
+    uint64_t num_points = 0;
+    uint64_t window_bits = 0;
+    uint64_t point_size = 0;
+    std::array<uint64_t, 4> padding{};
+};
+static_assert(sizeof(FileHeader) == 64);
+
+// Bit flagging a negative digit in the signed digit encoding used by msm()
+constexpr uint32_t NEGATIVE_DIGIT = 1U << 31;
+
+/**
+ * @brief Write a 128-bit scalar in signed base-2^window_bits digits dⱼ with |dⱼ| ≤ 2^(window_bits - 1)
+ * @details Each digit is encoded as its magnitude, with NEGATIVE_DIGIT set if the digit is negative.
+ */
+void compute_signed_digits(const std::array<uint64_t, 2>& scalar,
+                           size_t window_bits,
+                           size_t num_windows,
+                           uint32_t* digits,
+                           size_t digit_stride)
+{
+    const uint64_t window_mask = (1ULL << window_bits) - 1;
+    const uint64_t half_window = 1ULL << (window_bits - 1);
+    uint64_t carry = 0;
+    for (size_t j = 0; j < num_windows; ++j) {
+        const size_t bit_idx = j * window_bits;
+        uint64_t window = 0;
+        if (bit_idx < 128) {
+            const size_t limb_idx = bit_idx / 64;
+            const size_t shift = bit_idx % 64;
+            window = scalar[limb_idx] >> shift;
+            if (shift + window_bits > 64 && limb_idx == 0) {
+                window |= scalar[1] << (64 - shift);
+            }
+            window &= window_mask;
+        }
+        window += carry;
+        if (window > half_window) {
+            digits[j * digit_stride] = static_cast<uint32_t>((1ULL << window_bits) - window) | NEGATIVE_DIGIT;
+            carry = 1;
+        } else {
+            digits[j * digit_stride] = static_cast<uint32_t>(window);
+            carry = 0;
+        }
+    }
+}
+
+} // namespace
+
+template <typename Curve>
+FixedBaseTable<Curve>::FixedBaseTable(size_t num_points, size_t window_bits)
+    : num_points(num_points)
+    , window_bits(window_bits)
+    , num_windows(get_num_windows(window_bits))
+{
+    if (window_bits < MIN_WINDOW_BITS || window_bits > MAX_WINDOW_BITS) {
+        throw_or_abort(format("FixedBaseTable: window width ",
+                              window_bits,
+                              " is outside of the supported range [",
+                              MIN_WINDOW_BITS,
+                              ", ",
+                              MAX_WINDOW_BITS,
+                              "]"));
+    }
+}
+
+/**
+ * @details Window 0 is a copy of the point table. For the later windows, each raw point is repeatedly doubled by
+ * window_bits and the endomorphism points are derived from the (normalized) raw points, since the endomorphism commutes
+ * with doubling.
+ */
+template <typename Curve>
+FixedBaseTable<Curve>::FixedBaseTable(std::span<const AffineElement> point_table, size_t num_points, size_t window_bits)
+    : FixedBaseTable(num_points, window_bits)
+{
+    PROFILE_THIS_NAME("FixedBaseTable constructor");
+    using Fq = typename Curve::BaseField;
+
+    if (point_table.size() < 2 * num_points) {
+        throw_or_abort("FixedBaseTable: not enough points in the point table.");
+    }
+    points = std::static_pointer_cast<AffineElement[]>(get_mem_slab(get_memory_usage()));
+    AffineElement* table = points.get();
+    std::copy_n(point_table.data(), 2 * num_points, table);
+
+    const Fq beta = Fq::cube_root_of_unity();
+    const size_t num_threads = calculate_num_threads(num_points);
+    const size_t block_size = (num_points + num_threads - 1) / num_threads; // round up
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = thread_idx * block_size;
+        const size_t end = std::min(num_points, (thread_idx + 1) * block_size);
+        if (start >= end) {
+            return;
+        }
+        std::vector<Element> shifted_points(end - start);
+        for (size_t idx = start; idx < end; ++idx) {
+            shifted_points[idx - start] = point_table[2 * idx];
+        }
+        for (size_t window_idx = 1; window_idx < num_windows; ++window_idx) {
+            for (auto& point : shifted_points) {
+                for (size_t bit = 0; bit < window_bits; ++bit) {
+                    point.self_dbl();
+                }
+            }
+            Element::batch_normalize(shifted_points.data(), shifted_points.size());
+            AffineElement* window = table + window_idx * 2 * num_points;
+            for (size_t idx = start; idx < end; ++idx) {
+                const auto& point = shifted_points[idx - start];
+                window[2 * idx] = AffineElement(point.x, point.y);
+                window[2 * idx + 1] = AffineElement(beta * point.x, -point.y);
+            }
+        }
+    });
+}
+
+template <typename Curve>
+std::string FixedBaseTable<Curve>::get_file_name(const std::string& cache_dir, size_t num_points, size_t window_bits)
+{
+    return format(cache_dir, "/fixed_base_", Curve::name, "_", num_points, "_", window_bits, ".dat");
+}
+
+template <typename Curve> void FixedBaseTable<Curve>::write_to_file(const std::string& path) const
+{
+    PROFILE_THIS_NAME("FixedBaseTable::write_to_file");
+
+    FileHeader header;
+    header.num_points = num_points;
+    header.window_bits = window_bits;
+    header.point_size = sizeof(AffineElement);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(points.get()), static_cast<std::streamsize>(get_memory_usage()));
+    if (!file) {
+        throw_or_abort("FixedBaseTable: failed to write table to " + path);
+    }
+}
+
+/**
+ * @brief Map a file written by write_to_file into memory, or return nullptr if there is no valid such file
+ */
+template <typename Curve>
+std::shared_ptr<FixedBaseTable<Curve>> FixedBaseTable<Curve>::map_file(const std::string& path,
+                                                                       size_t num_points,
+                                                                       size_t window_bits)
+{
+#ifdef __wasm__
+    static_cast<void>(path);
+    static_cast<void>(num_points);
+    static_cast<void>(window_bits);
+    return nullptr;
+#else
+    std::shared_ptr<FixedBaseTable> result(new FixedBaseTable(num_points, window_bits));
+    const size_t file_size = sizeof(FileHeader) + result->get_memory_usage();
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || static_cast<size_t>(file_stat.st_size) != file_size) {
+        close(fd);
+        return nullptr;
+    }
+    void* mapping = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return nullptr;
+    }
+
+    const auto* header = static_cast<const FileHeader*>(mapping);
+    if (header->magic != FileHeader::MAGIC || header->num_points != num_points || header->window_bits != window_bits ||
+        header->point_size != sizeof(AffineElement)) {
+        munmap(mapping, file_size);
+        return nullptr;
+    }
+    auto* table = reinterpret_cast<AffineElement*>(static_cast<uint8_t*>(mapping) + sizeof(FileHeader));
+    result->points = std::shared_ptr<AffineElement[]>(table, [mapping, file_size](AffineElement*) {
+        munmap(mapping, file_size);
+    });
+    return result;
+#endif
+}
+
+template <typename Curve>
+std::shared_ptr<FixedBaseTable<Curve>> FixedBaseTable<Curve>::load_or_compute(
+    std::span<const AffineElement> point_table, size_t num_points, size_t window_bits, const std::string& cache_dir)
+{
+    PROFILE_THIS_NAME("FixedBaseTable::load_or_compute");
+
+    if (cache_dir.empty()) {
+        return std::make_shared<FixedBaseTable>(point_table, num_points, window_bits);
+    }
+    const std::string path = get_file_name(cache_dir, num_points, window_bits);
+    if (auto table = map_file(path, num_points, window_bits)) {
+        // The first window is a copy of the point table, which guards against a table computed from a different SRS
+        auto window = table->get_window(0);
+        if (point_table.size() >= window.size() &&
+            std::memcmp(window.data(), point_table.data(), window.size_bytes()) == 0) {
+            vinfo("Loaded fixed base table from ", path);
+            return table;
+        }
+    }
+    auto table = std::make_shared<FixedBaseTable>(point_table, num_points, window_bits);
+    // Write to a temporary file and rename it so that any existing mapping of a stale file stays valid
+    const std::string tmp_path = path + ".tmp";
+    table->write_to_file(tmp_path);
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        throw_or_abort("FixedBaseTable: failed to move table to " + path);
+    }
+    vinfo("Wrote fixed base table of ", table->get_memory_usage() >> 20, " MiB to ", path);
+    return table;
+}
+
+/**
+ * @details For each window j, the shifted points 2ʲʷ⋅Pᵢ (negated for negative digits) are sorted by the magnitude of
+ * their digit dᵢⱼ and each bucket is summed using batched affine addition, together with the sum of that bucket
+ * over the previous windows. The buckets Bₘ, m = 1, ..., 2ʷ⁻¹, are finally combined as ∑ₘ m⋅Bₘ with a running sum.
+ * Processing one window at a time bounds the working memory to one copy of the (used part of the) point table.
+ */
+template <typename Curve>
+typename FixedBaseTable<Curve>::Element FixedBaseTable<Curve>::msm(PolynomialSpan<const Fr> scalars) const
+{
+    PROFILE_THIS_NAME("FixedBaseTable::msm");
+    using BatchedAddition = BatchedAffineAddition<Curve>;
+
+    if (scalars.start_index + scalars.size() > num_points) {
+        throw_or_abort(format("FixedBaseTable: cannot compute an MSM of size ",
+                              scalars.start_index + scalars.size(),
+                              " with a table of size ",
+                              num_points));
+    }
+    const size_t num_scalars = scalars.size();
+    const size_t num_table_points = 2 * num_scalars; // the endomorphism splits each scalar in two
+    const size_t num_buckets = (1ULL << (window_bits - 1)) + 1;
+
+    // Split the scalars and compute the digits of the half scalars, stored window by window
+    std::vector<uint32_t> digits(num_windows * num_table_points);
+    parallel_for_heuristic(
+        num_scalars,
+        [&](size_t idx) {
+            Fr scalar = scalars.span[idx].from_montgomery_form();
+            auto [k1, k2] = Fr::split_into_endomorphism_scalars(scalar);
+            compute_signed_digits(k1, window_bits, num_windows, &digits[2 * idx], num_table_points);
+            compute_signed_digits(k2, window_bits, num_windows, &digits[2 * idx + 1], num_table_points);
+        },
+        thread_heuristics::FF_COPY_COST * 2 + thread_heuristics::FF_MULTIPLICATION_COST * 4);
+
+    // Each thread handles at least as many points as there are buckets so that the counts take no more memory than
+    // the points
+    const size_t min_points_per_thread = std::max(num_buckets, static_cast<size_t>(DEFAULT_MIN_ITERS_PER_THREAD));
+    const size_t num_threads = calculate_num_threads(num_table_points, min_points_per_thread);
+    const size_t block_size = (num_table_points + num_threads - 1) / num_threads; // round up
+    std::vector<std::vector<size_t>> thread_bucket_offsets(num_threads);
+    std::vector<AffineElement> bucketed_points(num_table_points + num_buckets);
+    std::vector<AffineElement> buckets(num_buckets, AffineElement::infinity());
+
+    for (size_t window_idx = 0; window_idx < num_windows; ++window_idx) {
+        const AffineElement* window = get_window(window_idx).data() + 2 * scalars.start_index;
+        const uint32_t* window_digits = &digits[window_idx * num_table_points];
+
+        // Count the occurrences of each digit magnitude within each thread's block
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            auto& counts = thread_bucket_offsets[thread_idx];
+            counts.assign(num_buckets, 0);
+            const size_t start = thread_idx * block_size;
+            const size_t end = std::min(num_table_points, (thread_idx + 1) * block_size);
+            for (size_t idx = start; idx < end; ++idx) {
+                counts[window_digits[idx] & ~NEGATIVE_DIGIT]++;
+            }
+        });
+
+        // Convert the counts into the offset at which each thread writes the points of each bucket, skipping the zero
+        // bucket, and record the size and index of each bucket that receives new points. The sum of the bucket over
+        // the previous windows, if any, is placed at the start of the bucket so that it is absorbed by the batched
+        // addition rather than by a separate (more expensive) point addition per bucket.
+        std::vector<size_t> bucket_sizes;
+        std::vector<size_t> bucket_indices;
+        size_t num_bucketed_points = 0;
+        for (size_t bucket_idx = 1; bucket_idx < num_buckets; ++bucket_idx) {
+            size_t num_new_points = 0;
+            for (auto& offsets : thread_bucket_offsets) {
+                num_new_points += offsets[bucket_idx];
+            }
+            if (num_new_points == 0) {
+                continue;
+            }
+            size_t bucket_size = 0;
+            if (!buckets[bucket_idx].is_point_at_infinity()) {
+                bucketed_points[num_bucketed_points] = buckets[bucket_idx];
+                bucket_size = 1;
+            }
+            for (auto& offsets : thread_bucket_offsets) {
+                const size_t count = offsets[bucket_idx];
+                offsets[bucket_idx] = num_bucketed_points + bucket_size;
+                bucket_size += count;
+            }
+            bucket_sizes.emplace_back(bucket_size);
+            bucket_indices.emplace_back(bucket_idx);
+            num_bucketed_points += bucket_size;
+        }
+        if (num_bucketed_points == 0) {
+            continue;
+        }
+
+        // Sort the shifted points into their buckets, negating those with negative digits
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            auto& offsets = thread_bucket_offsets[thread_idx];
+            const size_t start = thread_idx * block_size;
+            const size_t end = std::min(num_table_points, (thread_idx + 1) * block_size);
+            for (size_t idx = start; idx < end; ++idx) {
+                const uint32_t digit = window_digits[idx];
+                const uint32_t magnitude = digit & ~NEGATIVE_DIGIT;
+                if (magnitude != 0) {
+                    AffineElement& point = bucketed_points[offsets[magnitude]++];
+                    point = window[idx];
+                    if ((digit & NEGATIVE_DIGIT) != 0) {
+                        point.y = -point.y;
+                    }
+                }
+            }
+        });
+
+        // Reduce each bucket to a single point
+        auto bucket_sums =
+            BatchedAddition::add_in_place(std::span(bucketed_points).subspan(0, num_bucketed_points), bucket_sizes);
+        for (size_t k = 0; k < bucket_sums.size(); ++k) {
+            buckets[bucket_indices[k]] = bucket_sums[k];
+        }
+    }
+
+    // Compute ∑ₘ m⋅Bₘ
+    Element running_sum = Element::infinity();
+    Element result = Element::infinity();
+    for (size_t bucket_idx = num_buckets - 1; bucket_idx > 0; --bucket_idx) {
+        if (!buckets[bucket_idx].is_point_at_infinity()) {
+            running_sum += buckets[bucket_idx];
+        }
+        result += running_sum;
+    }
+    return result;
+}
+
+template class FixedBaseTable<curve::BN254>;
+template class FixedBaseTable<curve::Grumpkin>;
+
+} // namespace bb::scalar_multiplication
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+
+namespace bb::scalar_multiplication {
+
+/**
+ * @brief Precomputed shifted copies of a fixed set of base points (e.g. the prover SRS) for fast fixed-base MSMs
+ *
+ * @details Scalars are split via the endomorphism into k = k₁ - λ⋅k₂ with k₁, k₂ < 2¹²⁸, exactly as in pippenger, so
+ * that an MSM over n points becomes an MSM over the 2n points of the pippenger point table (raw points at even indices,
+ * endomorphism points at odd indices). Each half scalar is written in signed base-2ʷ digits k = ∑ⱼ dⱼ⋅2ʲʷ with
+ * |dⱼ| ≤ 2ʷ⁻¹. The table stores the shifted points 2ʲʷ⋅P for every point P of the point table and every window j, so
+ * that
+ *
+ *      ∑ᵢ kᵢ⋅Pᵢ = ∑ᵢ ∑ⱼ dᵢⱼ⋅(2ʲʷ⋅Pᵢ)
+ *
+ * is a single round of bucket accumulation into 2ʷ⁻¹ buckets with no doublings at all, in place of the ~128/w rounds
+ * of a variable-base pippenger (each of which needs its own bucket reduction). The window width w is the memory/time
+ * trade-off: the table holds ⌈129/w⌉ copies of the point table, and an MSM performs roughly 2n⋅⌈129/w⌉ affine additions
+ * plus 2ʷ additions to combine the buckets.
+ *
+ * The table depends only on the base points, so it can be written to disk once and memory mapped by later processes
+ * via load_or_compute().
+ *
+ * @warning Like pippenger_unsafe, the MSM assumes that the base points are linearly independent (as for an SRS) so that
+ * the incomplete affine addition formulae are never exercised.
+ */
+template <typename Curve> class FixedBaseTable {
+  public:
+    using AffineElement = typename Curve::AffineElement;
+    using Element = typename Curve::Element;
+    using Fr = typename Curve::ScalarField;
+
+    static constexpr size_t NUM_SCALAR_BITS = 128; // upper bound on the bit length of the endomorphism scalars
+    static constexpr size_t MIN_WINDOW_BITS = 4;
+    static constexpr size_t MAX_WINDOW_BITS = 22;
+
+    /**
+     * @brief Compute the table for the first num_points points of a pippenger point table
+     *
+     * @param point_table Pippenger point table, see generate_pippenger_point_table
+     */
+    FixedBaseTable(std::span<const AffineElement> point_table, size_t num_points, size_t window_bits);
+
+    /**
+     * @brief Memory map a table previously written to cache_dir if there is one that matches point_table, otherwise
+     * compute the table and (if cache_dir is nonempty) write it to cache_dir for next time
+     */
+    static std::shared_ptr<FixedBaseTable> load_or_compute(std::span<const AffineElement> point_table,
+                                                           size_t num_points,
+                                                           size_t window_bits,
+                                                           const std::string& cache_dir = "");
+
+    /**
+     * @brief Compute ∑ᵢ aᵢ⋅Gᵢ for the scalars aᵢ of a polynomial, where Gᵢ are the base points
+     */
+    Element msm(PolynomialSpan<const Fr> scalars) const;
+
+    void write_to_file(const std::string& path) const;
+
+    // The number of signed digits needed for a scalar of NUM_SCALAR_BITS bits, i.e. ⌈(NUM_SCALAR_BITS + 1)/window_bits⌉
+    static constexpr size_t get_num_windows(size_t window_bits)
+    {
+        return (NUM_SCALAR_BITS + window_bits) / window_bits;
+    }
+
+    size_t get_num_points() const { return num_points; }
+
+    size_t get_window_bits() const { return window_bits; }
+
+    size_t get_memory_usage() const { return num_windows * 2 * num_points * sizeof(AffineElement); }
+
+    // The point table shifted by 2^{window_idx * window_bits}
+    std::span<const AffineElement> get_window(size_t window_idx) const
+    {
+        return { points.get() + window_idx * 2 * num_points, 2 * num_points };
+    }
+
+  private:
+    FixedBaseTable(size_t num_points, size_t window_bits);
+
+    static std::string get_file_name(const std::string& cache_dir, size_t num_points, size_t window_bits);
+    static std::shared_ptr<FixedBaseTable> map_file(const std::string& path, size_t num_points, size_t window_bits);
+
+    size_t num_points;
+    size_t window_bits;
+    size_t num_windows;
+    // Either heap allocated or a read-only mapping of a file written by write_to_file
+    std::shared_ptr<AffineElement[]> points;
+};
+
+} // namespace bb::scalar_multiplication
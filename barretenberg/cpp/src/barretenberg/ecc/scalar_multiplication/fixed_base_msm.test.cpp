@@ -0,0 +1,143 @@
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace bb::scalar_multiplication {
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+}
+
+template <typename Curve> class FixedBaseMsmTests : public ::testing::Test {
+  public:
+    using G1 = typename Curve::AffineElement;
+    using Element = typename Curve::Element;
+    using Fr = typename Curve::ScalarField;
+
+    // Construct a pippenger point table from random points
+    static std::vector<G1> generate_point_table(size_t num_points)
+    {
+        std::vector<G1> point_table(2 * num_points);
+        for (size_t i = 0; i < num_points; ++i) {
+            point_table[i] = G1::random_element();
+        }
+        generate_pippenger_point_table<Curve>(point_table.data(), point_table.data(), num_points);
+        return point_table;
+    }
+
+    static G1 naive_msm(const std::vector<G1>& point_table, PolynomialSpan<const Fr> scalars)
+    {
+        Element result = Element::infinity();
+        for (size_t i = 0; i < scalars.size(); ++i) {
+            result += Element(point_table[2 * (scalars.start_index + i)]) * scalars.span[i];
+        }
+        return result;
+    }
+};
+
+using Curves = ::testing::Types<curve::BN254, curve::Grumpkin>;
+
+TYPED_TEST_SUITE(FixedBaseMsmTests, Curves);
+
+// Check that the shifted copies are the points of the point table multiplied by the appropriate power of 2
+TYPED_TEST(FixedBaseMsmTests, TableWindows)
+{
+    using Curve = TypeParam;
+    using Fr = typename Curve::ScalarField;
+    using G1 = typename Curve::AffineElement;
+    using Table = FixedBaseTable<Curve>;
+
+    const size_t num_points = 5;
+    const size_t window_bits = 13;
+    auto point_table = TestFixture::generate_point_table(num_points);
+    Table table(point_table, num_points, window_bits);
+
+    EXPECT_EQ(Table::get_num_windows(window_bits), 10UL);
+    for (size_t window_idx = 0; window_idx < Table::get_num_windows(window_bits); ++window_idx) {
+        const Fr shift = Fr(uint256_t(1) << (window_idx * window_bits));
+        auto window = table.get_window(window_idx);
+        for (size_t i = 0; i < 2 * num_points; ++i) {
+            EXPECT_EQ(window[i], G1(point_table[i] * shift));
+        }
+    }
+}
+
+TYPED_TEST(FixedBaseMsmTests, MsmMatchesNaive)
+{
+    using Curve = TypeParam;
+    using Fr = typename Curve::ScalarField;
+    using G1 = typename Curve::AffineElement;
+    using Table = FixedBaseTable<Curve>;
+
+    const size_t num_points = 200;
+    auto point_table = TestFixture::generate_point_table(num_points);
+
+    for (const size_t window_bits : { Table::MIN_WINDOW_BITS, size_t(7), size_t(16) }) {
+        Table table(point_table, num_points, window_bits);
+        for (const size_t start_index : { size_t(0), size_t(37) }) {
+            const size_t size = num_points - start_index - 11;
+            std::vector<Fr> scalars(size);
+            for (auto& scalar : scalars) {
+                scalar = Fr::random_element();
+            }
+            // Include the edge cases of zero, small and maximal scalars
+            scalars[0] = 0;
+            scalars[1] = 1;
+            scalars[2] = -Fr(1);
+            scalars[3] = engine.get_random_uint8();
+
+            PolynomialSpan<const Fr> span{ start_index, scalars };
+            G1 expected = TestFixture::naive_msm(point_table, span);
+            EXPECT_EQ(G1(table.msm(span)), expected);
+        }
+    }
+
+    // The table cannot be used for MSMs larger than itself
+    Table table(point_table, num_points / 2, Table::MIN_WINDOW_BITS);
+    std::vector<Fr> scalars(num_points, Fr(1));
+    EXPECT_THROW(table.msm(PolynomialSpan<const Fr>{ 0, scalars }), std::runtime_error);
+}
+
+// Check that a table is written to the cache directory, read back when requested again and recomputed if the points
+// do not match
+TYPED_TEST(FixedBaseMsmTests, LoadOrCompute)
+{
+    using Curve = TypeParam;
+    using Fr = typename Curve::ScalarField;
+    using G1 = typename Curve::AffineElement;
+    using Table = FixedBaseTable<Curve>;
+
+    const size_t num_points = 64;
+    const size_t window_bits = 10;
+    auto cache_dir = std::filesystem::temp_directory_path() / ("fixed_base_msm_test_" + std::string(Curve::name));
+    std::filesystem::create_directories(cache_dir);
+
+    auto point_table = TestFixture::generate_point_table(num_points);
+    auto computed = Table::load_or_compute(point_table, num_points, window_bits, cache_dir);
+    auto loaded = Table::load_or_compute(point_table, num_points, window_bits, cache_dir);
+    ASSERT_EQ(loaded->get_memory_usage(), computed->get_memory_usage());
+    for (size_t window_idx = 0; window_idx < Table::get_num_windows(window_bits); ++window_idx) {
+        auto computed_window = computed->get_window(window_idx);
+        auto loaded_window = loaded->get_window(window_idx);
+        EXPECT_TRUE(std::equal(computed_window.begin(), computed_window.end(), loaded_window.begin()));
+    }
+
+    std::vector<Fr> scalars(num_points);
+    for (auto& scalar : scalars) {
+        scalar = Fr::random_element();
+    }
+    EXPECT_EQ(G1(loaded->msm({ 0, scalars })), TestFixture::naive_msm(point_table, { 0, scalars }));
+
+    // A table computed from different points must not be reused
+    auto other_point_table = TestFixture::generate_point_table(num_points);
+    auto recomputed = Table::load_or_compute(other_point_table, num_points, window_bits, cache_dir);
+    EXPECT_EQ(G1(recomputed->msm({ 0, scalars })), TestFixture::naive_msm(other_point_table, { 0, scalars }));
+
+    std::filesystem::remove_all(cache_dir);
+}
+
+} // namespace bb::scalar_multiplication
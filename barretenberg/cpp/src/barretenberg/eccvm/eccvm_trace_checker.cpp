@@ -34,7 +34,7 @@ bool ECCVMTraceChecker::check(Builder& builder, numeric::RNG* engine_ptr)
     compute_logderivative_inverse<Flavor, ECCVMLookupRelation<FF>>(polynomials, params, num_rows);
     compute_grand_product<Flavor, ECCVMSetRelation<FF>>(polynomials, params);
 
-    polynomials.z_perm_shift = Polynomial(polynomials.z_perm.shifted());
+    polynomials.z_perm_shift = polynomials.z_perm.shifted().copy_on_write();
 
     const auto evaluate_relation = [&]<typename Relation>(const std::string& relation_name) {
         typename Relation::SumcheckArrayOfValuesOverSubrelations result;
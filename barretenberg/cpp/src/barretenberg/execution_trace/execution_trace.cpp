@@ -4,6 +4,7 @@
 #include "barretenberg/stdlib_circuit_builders/mega_zk_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_keccak_flavor.hpp"
+#include <numeric>
 namespace bb {
 
 template <class Flavor> void ExecutionTrace_<Flavor>::populate_public_inputs_block(Builder& builder)
@@ -42,7 +43,7 @@ void ExecutionTrace_<Flavor>::populate(Builder& builder, typename Flavor::Provin
 
         PROFILE_THIS_NAME("add_memory_records_to_proving_key");
 
-        add_memory_records_to_proving_key(trace_data, builder, proving_key);
+        add_memory_records_to_proving_key(trace_data.ram_rom_offset, builder, proving_key);
     }
 
     if constexpr (IsGoblinFlavor<Flavor>) {
@@ -62,7 +63,69 @@ void ExecutionTrace_<Flavor>::populate(Builder& builder, typename Flavor::Provin
 }
 
 template <class Flavor>
-void ExecutionTrace_<Flavor>::add_memory_records_to_proving_key(TraceData& trace_data,
+void ExecutionTrace_<Flavor>::populate_witness(Builder& builder,
+                                               typename Flavor::ProvingKey& proving_key,
+                                               bool is_structured)
+    requires IsHonkFlavor<Flavor>
+{
+    PROFILE_THIS_NAME("trace populate_witness");
+
+    auto wires = proving_key.polynomials.get_wires();
+    const BlockPlacement placement = place_blocks(builder, proving_key, is_structured);
+    proving_key.pub_inputs_offset = placement.pub_inputs_offset;
+
+    size_t block_idx = 0;
+    for (auto& block : builder.blocks.get()) {
+        const uint32_t block_offset = placement.block_offsets[block_idx++];
+        // Insert the real witness values from this block into the wire polys at the correct offset
+        for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
+            auto& wire = wires[wire_idx];
+            const auto& block_wire = block.wires[wire_idx];
+            for (uint32_t block_row_idx = 0; block_row_idx < block.size(); ++block_row_idx) {
+                wire.at(block_row_idx + block_offset) = builder.get_variable(block_wire[block_row_idx]);
+            }
+        }
+    }
+
+    if constexpr (IsUltraPlonkOrHonk<Flavor>) {
+        add_memory_records_to_proving_key(placement.ram_rom_offset, builder, proving_key);
+    }
+
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        add_ecc_op_wires_to_proving_key(builder, proving_key, /*construct_selector=*/false);
+    }
+}
+
+template <class Flavor>
+typename ExecutionTrace_<Flavor>::BlockPlacement ExecutionTrace_<Flavor>::place_blocks(Builder& builder,
+                                                                                      ProvingKey& proving_key,
+                                                                                      bool is_structured)
+{
+    BlockPlacement placement;
+    uint32_t offset = Flavor::has_zero_row ? 1 : 0; // Offset at which to place each block in the trace polynomials
+    for (auto& block : builder.blocks.get()) {
+        placement.block_offsets.emplace_back(offset);
+
+        // Save ranges over which the blocks are "active" for use in structured commitments
+        if constexpr (IsHonkFlavor<Flavor>) {
+            proving_key.active_block_ranges.emplace_back(offset, offset + block.size());
+        }
+        // Store the offset of the block containing RAM/ROM read/write gates for use in updating memory records
+        if (block.has_ram_rom) {
+            placement.ram_rom_offset = offset;
+        }
+        // Store offset of public inputs block for use in the pub input mechanism of the permutation argument
+        if (block.is_pub_inputs) {
+            placement.pub_inputs_offset = offset;
+        }
+        offset += block.get_fixed_size(is_structured);
+    }
+    placement.num_rows = offset;
+    return placement;
+}
+
+template <class Flavor>
+void ExecutionTrace_<Flavor>::add_memory_records_to_proving_key(uint32_t ram_rom_offset,
                                                                 Builder& builder,
                                                                 typename Flavor::ProvingKey& proving_key)
     requires IsUltraPlonkOrHonk<Flavor>
@@ -71,10 +134,10 @@ void ExecutionTrace_<Flavor>::add_memory_records_to_proving_key(TraceData& trace
 
     // Update indices of RAM/ROM reads/writes based on where block containing these gates sits in the trace
     for (auto& index : builder.memory_read_records) {
-        proving_key.memory_read_records.emplace_back(index + trace_data.ram_rom_offset);
+        proving_key.memory_read_records.emplace_back(index + ram_rom_offset);
     }
     for (auto& index : builder.memory_write_records) {
-        proving_key.memory_write_records.emplace_back(index + trace_data.ram_rom_offset);
+        proving_key.memory_write_records.emplace_back(index + ram_rom_offset);
     }
 }
 
@@ -92,65 +155,129 @@ typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_t
 
     TraceData trace_data{ builder, proving_key };
 
-    uint32_t offset = Flavor::has_zero_row ? 1 : 0; // Offset at which to place each block in the trace polynomials
-    // For each block in the trace, populate wire polys, copy cycles and selector polys
-
-    for (auto& block : builder.blocks.get()) {
-        auto block_size = static_cast<uint32_t>(block.size());
+    const BlockPlacement placement = place_blocks(builder, proving_key, is_structured);
+    trace_data.ram_rom_offset = placement.ram_rom_offset;
+    trace_data.pub_inputs_offset = placement.pub_inputs_offset;
+    const std::vector<uint32_t>& block_offsets = placement.block_offsets;
+    const size_t num_rows = placement.num_rows;
 
-        // Save ranges over which the blocks are "active" for use in structured commitments
-        if constexpr (IsHonkFlavor<Flavor>) {
-            proving_key.active_block_ranges.emplace_back(offset, offset + block.size());
+    // For each block in the trace, populate wire polys and selector polys directly at the block's offset, and record
+    // the real variable held by each wire cell from which the copy cycles are then constructed
+    std::vector<uint32_t> cell_variables(num_rows * NUM_WIRES, UNUSED_CELL);
+    {
+        PROFILE_THIS_NAME("populating wires and selectors");
+
+        size_t block_idx = 0;
+        for (auto& block : builder.blocks.get()) {
+            const uint32_t block_offset = block_offsets[block_idx++];
+            // Rows are independent, so disjoint ranges of rows of the block are populated concurrently
+            parallel_for_range(
+                block.size(),
+                [&](size_t start, size_t end) {
+                    for (size_t block_row_idx = start; block_row_idx < end; ++block_row_idx) {
+                        const size_t trace_row_idx = block_row_idx + block_offset;
+                        for (size_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
+                            const uint32_t var_idx = block.wires[wire_idx][block_row_idx];
+                            trace_data.wires[wire_idx].at(trace_row_idx) = builder.get_variable(var_idx);
+                            cell_variables[trace_row_idx * NUM_WIRES + wire_idx] = builder.real_variable_index[var_idx];
+                        }
+                    }
+                    // TODO(https://github.com/AztecProtocol/barretenberg/issues/398): implicit arithmetization/flavor
+                    // consistency
+                    for (size_t selector_idx = 0; selector_idx < NUM_SELECTORS; selector_idx++) {
+                        block.selectors[selector_idx].populate_polynomial(
+                            trace_data.selectors[selector_idx], block_offset, start, end);
+                    }
+                },
+                /*no_multhreading_if_less_or_equal=*/1 << 10);
         }
+    }
+    {
+        PROFILE_THIS_NAME("constructing copy_cycles");
+
+        trace_data.copy_cycles = construct_copy_cycles(cell_variables, builder.variables.size());
+    }
+    return trace_data;
+}
 
-        // Update wire polynomials and copy cycles
-        // NB: The order of row/column loops is arbitrary but needs to be row/column to match old copy_cycle code
-        {
-
-            PROFILE_THIS_NAME("populating wires and copy_cycles");
-
-            for (uint32_t block_row_idx = 0; block_row_idx < block_size; ++block_row_idx) {
-                for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
-                    uint32_t var_idx = block.wires[wire_idx][block_row_idx]; // an index into the variables array
-                    uint32_t real_var_idx = builder.real_variable_index[var_idx];
-                    uint32_t trace_row_idx = block_row_idx + offset;
-                    // Insert the real witness values from this block into the wire polys at the correct offset
-                    trace_data.wires[wire_idx].at(trace_row_idx) = builder.get_variable(var_idx);
-                    // Add the address of the witness value to its corresponding copy cycle
-                    trace_data.copy_cycles[real_var_idx].emplace_back(cycle_node{ wire_idx, trace_row_idx });
-                }
+template <class Flavor>
+CopyCycles ExecutionTrace_<Flavor>::construct_copy_cycles(const std::vector<uint32_t>& cell_variables,
+                                                          const size_t num_variables)
+{
+    ASSERT(cell_variables.size() < UNUSED_CELL);
+    CopyCycles copy_cycles;
+    copy_cycles.offsets.assign(num_variables + 1, 0);
+    if (num_variables == 0) {
+        return copy_cycles;
+    }
+    // Disjoint chunks of cells are processed concurrently, each with a count per variable
+    const size_t num_cells = cell_variables.size();
+    const size_t num_chunks = calculate_num_threads(num_cells, 1 << 12);
+    const auto get_range = [num_chunks](size_t size, size_t chunk) {
+        const size_t chunk_size = (size + num_chunks - 1) / num_chunks;
+        const size_t start = std::min(chunk * chunk_size, size);
+        return std::make_pair(start, std::min(start + chunk_size, size));
+    };
+
+    // Count the cells of each variable within each chunk of cells
+    std::vector<std::vector<uint32_t>> next_node(num_chunks);
+    parallel_for(num_chunks, [&](size_t chunk) {
+        next_node[chunk].assign(num_variables, 0);
+        const auto [start, end] = get_range(num_cells, chunk);
+        for (size_t cell_idx = start; cell_idx < end; ++cell_idx) {
+            const uint32_t variable = cell_variables[cell_idx];
+            if (variable != UNUSED_CELL) {
+                ++next_node[chunk][variable];
             }
         }
-
-        // Insert the selector values for this block into the selector polynomials at the correct offset
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/398): implicit arithmetization/flavor consistency
-        for (size_t selector_idx = 0; selector_idx < NUM_SELECTORS; selector_idx++) {
-            auto& selector = block.selectors[selector_idx];
-            for (size_t row_idx = 0; row_idx < block_size; ++row_idx) {
-                size_t trace_row_idx = row_idx + offset;
-                trace_data.selectors[selector_idx].set_if_valid_index(trace_row_idx, selector[row_idx]);
+    });
+
+    // Turn the counts into the offsets of the cycles, then into the position at which each chunk writes the first of
+    // its cells of each variable, so that every cycle lists its cells in trace order
+    parallel_for(num_chunks, [&](size_t chunk) {
+        const auto [start, end] = get_range(num_variables, chunk);
+        for (size_t variable = start; variable < end; ++variable) {
+            uint32_t count = 0;
+            for (const auto& counts : next_node) {
+                count += counts[variable];
             }
+            copy_cycles.offsets[variable + 1] = count;
         }
-
-        // Store the offset of the block containing RAM/ROM read/write gates for use in updating memory records
-        if (block.has_ram_rom) {
-            trace_data.ram_rom_offset = offset;
+    });
+    std::partial_sum(copy_cycles.offsets.begin(), copy_cycles.offsets.end(), copy_cycles.offsets.begin());
+    parallel_for(num_chunks, [&](size_t chunk) {
+        const auto [start, end] = get_range(num_variables, chunk);
+        for (size_t variable = start; variable < end; ++variable) {
+            uint32_t position = copy_cycles.offsets[variable];
+            for (auto& counts : next_node) {
+                const uint32_t count = counts[variable];
+                counts[variable] = position;
+                position += count;
+            }
         }
-        // Store offset of public inputs block for use in the pub input mechanism of the permutation argument
-        if (block.is_pub_inputs) {
-            trace_data.pub_inputs_offset = offset;
+    });
+
+    // Write the address of each cell into the cycle of its variable
+    copy_cycles.nodes.resize(copy_cycles.offsets.back());
+    parallel_for(num_chunks, [&](size_t chunk) {
+        const auto [start, end] = get_range(num_cells, chunk);
+        for (size_t cell_idx = start; cell_idx < end; ++cell_idx) {
+            const uint32_t variable = cell_variables[cell_idx];
+            if (variable != UNUSED_CELL) {
+                copy_cycles.nodes[next_node[chunk][variable]++] = cycle_node{
+                    static_cast<uint32_t>(cell_idx % NUM_WIRES),
+                    static_cast<uint32_t>(cell_idx / NUM_WIRES),
+                };
+            }
         }
-
-        // If the trace is structured, we populate the data from the next block at a fixed block size offset
-        // otherwise, the next block starts immediately following the previous one
-        offset += block.get_fixed_size(is_structured);
-    }
-    return trace_data;
+    });
+    return copy_cycles;
 }
 
 template <class Flavor>
 void ExecutionTrace_<Flavor>::add_ecc_op_wires_to_proving_key(Builder& builder,
-                                                              typename Flavor::ProvingKey& proving_key)
+                                                              typename Flavor::ProvingKey& proving_key,
+                                                              bool construct_selector)
     requires IsGoblinFlavor<Flavor>
 {
     auto& ecc_op_selector = proving_key.polynomials.lagrange_ecc_op;
@@ -163,7 +290,9 @@ void ExecutionTrace_<Flavor>::add_ecc_op_wires_to_proving_key(Builder& builder,
         for (size_t i = 0; i < num_ecc_ops; ++i) {
             size_t idx = i + op_wire_offset;
             ecc_op_wire.at(idx) = wire[idx];
-            ecc_op_selector.at(idx) = 1; // construct selector as the indicator on the ecc op block
+            if (construct_selector) {
+                ecc_op_selector.at(idx) = 1; // construct selector as the indicator on the ecc op block
+            }
         }
     }
 }
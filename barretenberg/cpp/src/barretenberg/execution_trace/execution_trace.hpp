@@ -18,11 +18,14 @@ template <class Flavor> class ExecutionTrace_ {
 
     static constexpr size_t NUM_SELECTORS = Builder::Arithmetization::NUM_SELECTORS;
 
+    // Marks the wire cells of the trace that do not belong to any block (e.g. the padding of a structured trace)
+    static constexpr uint32_t UNUSED_CELL = UINT32_MAX;
+
     struct TraceData {
         std::array<Polynomial, NUM_WIRES> wires;
         std::array<Polynomial, NUM_SELECTORS> selectors;
-        // A vector of sets (vectors) of addresses into the wire polynomials whose values are copy constrained
-        std::vector<CyclicPermutation> copy_cycles;
+        // For each variable, the addresses into the wire polynomials whose values are copy constrained to it
+        CopyCycles copy_cycles;
         uint32_t ram_rom_offset = 0;    // offset of the RAM/ROM block in the execution trace
         uint32_t pub_inputs_offset = 0; // offset of the public inputs block in the execution trace
 
@@ -57,11 +60,6 @@ template <class Flavor> class ExecutionTrace_ {
                     }
                 }
             }
-            {
-                PROFILE_THIS_NAME("copy cycle initialization");
-
-                copy_cycles.resize(builder.variables.size());
-            }
         }
     };
 
@@ -78,6 +76,18 @@ template <class Flavor> class ExecutionTrace_ {
      */
     static void populate(Builder& builder, ProvingKey&, bool is_structured = false);
 
+    /**
+     * @brief Populate only the witness data of the execution trace, i.e. the wire polynomials, the ecc op wires and the
+     * memory records, into a proving key whose precomputed polynomials have been taken from a key for a circuit of
+     * identical structure
+     * @details The selectors and the copy cycles (and hence the sigma/id polynomials) are left untouched.
+     *
+     * @param builder
+     * @param is_structured whether or not the trace is to be structured with a fixed block size
+     */
+    static void populate_witness(Builder& builder, ProvingKey&, bool is_structured = false)
+        requires IsHonkFlavor<Flavor>;
+
     /**
      * @brief Populate the public inputs block
      * @details The first two wires are a copy of the public inputs and the other wires and all selectors are zero
@@ -87,6 +97,27 @@ template <class Flavor> class ExecutionTrace_ {
     static void populate_public_inputs_block(Builder& builder);
 
   private:
+    // The placement of the blocks in the trace
+    struct BlockPlacement {
+        std::vector<uint32_t> block_offsets; // offset of each block in the execution trace
+        uint32_t ram_rom_offset = 0;         // offset of the RAM/ROM block in the execution trace
+        uint32_t pub_inputs_offset = 0;      // offset of the public inputs block in the execution trace
+        size_t num_rows = 0;                 // number of rows spanned by the blocks, including the zero row if any
+    };
+
+    /**
+     * @brief Compute the offset at which each block is placed in the trace and record the active range of each block
+     * in the proving key
+     * @details If the trace is structured, each block is given a fixed amount of space, otherwise each block starts
+     * immediately following the previous one.
+     *
+     * @param builder
+     * @param proving_key
+     * @param is_structured whether or not the trace is to be structured with a fixed block size
+     * @return BlockPlacement
+     */
+    static BlockPlacement place_blocks(Builder& builder, ProvingKey& proving_key, bool is_structured);
+
     /**
      * @brief Add the memory records indicating which rows correspond to RAM/ROM reads/writes
      * @details The 4th wire of RAM/ROM read/write gates is generated at proving time as a linear combination of the
@@ -95,11 +126,11 @@ template <class Flavor> class ExecutionTrace_ {
      * within the block containing them. To obtain the row index in the trace at large, we simply increment these
      * indices by the offset at which that block is placed into the trace.
      *
-     * @param trace_data
+     * @param ram_rom_offset offset of the RAM/ROM block in the execution trace
      * @param builder
      * @param proving_key
      */
-    static void add_memory_records_to_proving_key(TraceData& trace_data,
+    static void add_memory_records_to_proving_key(uint32_t ram_rom_offset,
                                                   Builder& builder,
                                                   typename Flavor::ProvingKey& proving_key)
         requires IsUltraPlonkOrHonk<Flavor>;
@@ -116,6 +147,19 @@ template <class Flavor> class ExecutionTrace_ {
                                           typename Flavor::ProvingKey& proving_key,
                                           bool is_structured = false);
 
+    /**
+     * @brief Construct the copy cycles from the real variable held by each wire cell of the trace
+     * @details The cells are split into contiguous chunks, each handled by one thread. Each thread counts the cells of
+     * each variable in its chunk, the counts are prefix summed across variables and chunks, and each thread then
+     * writes its own cells into their cycles. Every cycle therefore lists its cells in trace order regardless of the
+     * number of threads, and the work is linear in the number of cells plus the number of variables per thread.
+     *
+     * @param cell_variables the real variable index of cell (row, wire) at row * NUM_WIRES + wire, or UNUSED_CELL
+     * @param num_variables
+     * @return CopyCycles
+     */
+    static CopyCycles construct_copy_cycles(const std::vector<uint32_t>& cell_variables, size_t num_variables);
+
     /**
      * @brief Construct and add the goblin ecc op wires to the proving key
      * @details The ecc op wires vanish everywhere except on the ecc op block, where they contain a copy of the ecc op
@@ -123,8 +167,11 @@ template <class Flavor> class ExecutionTrace_ {
      *
      * @param builder
      * @param proving_key
+     * @param construct_selector whether to also construct the ecc op selector (lagrange_ecc_op)
      */
-    static void add_ecc_op_wires_to_proving_key(Builder& builder, typename Flavor::ProvingKey& proving_key)
+    static void add_ecc_op_wires_to_proving_key(Builder& builder,
+                                                typename Flavor::ProvingKey& proving_key,
+                                                bool construct_selector = true)
         requires IsGoblinFlavor<Flavor>;
 };
 
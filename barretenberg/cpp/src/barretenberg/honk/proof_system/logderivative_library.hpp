@@ -31,6 +31,7 @@ void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_para
     constexpr size_t WRITE_TERMS = Relation::WRITE_TERMS;
 
     auto& inverse_polynomial = Relation::template get_inverse_polynomial(polynomials);
+    bool has_inverses = false;
     for (size_t i = 0; i < circuit_size; ++i) {
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
         auto row = polynomials.get_row(i);
@@ -38,6 +39,7 @@ void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_para
         if (!has_inverse) {
             continue;
         }
+        has_inverses = true;
         FF denominator = 1;
         bb::constexpr_for<0, READ_TERMS, 1>([&]<size_t read_index> {
             auto denominator_term =
@@ -53,8 +55,11 @@ void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_para
     };
 
     // Compute inverse polynomial I in place by inverting the product at each row
-    // Note: zeroes are ignored as they are not used anyway
-    FF::batch_invert(inverse_polynomial.coeffs());
+    // Note: zeroes are ignored as they are not used anyway, so a polynomial that was not written (and possibly not
+    // allocated) is left as is
+    if (has_inverses) {
+        FF::batch_invert(inverse_polynomial.coeffs());
+    }
 }
 
 /**
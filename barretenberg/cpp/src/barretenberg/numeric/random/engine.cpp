@@ -3,6 +3,7 @@
 #include <array>
 #include <cstring>
 #include <functional>
+#include <mutex>
 #include <random>
 #include <sys/random.h>
 
@@ -136,6 +137,12 @@ class RandomEngine : public RNG {
     }
 };
 
+/**
+ * @brief Deterministic engine shared by the whole process
+ * @details Draws are serialized by a mutex, since tests and benchmarks use the engine from several threads, e.g. the
+ * circuit producer thread of ClientIVC::accumulate_pipelined. The values drawn by one thread are only deterministic if
+ * no other thread draws from the engine at the same time.
+ */
 class DebugEngine : public RNG {
   public:
     DebugEngine()
@@ -148,34 +155,56 @@ class DebugEngine : public RNG {
         : engine(std::mt19937_64(seed))
     {}
 
-    uint8_t get_random_uint8() override { return static_cast<uint8_t>(dist(engine)); }
+    uint8_t get_random_uint8() override { return static_cast<uint8_t>(draw<1>()[0]); }
 
-    uint16_t get_random_uint16() override { return static_cast<uint16_t>(dist(engine)); }
+    uint16_t get_random_uint16() override { return static_cast<uint16_t>(draw<1>()[0]); }
 
-    uint32_t get_random_uint32() override { return static_cast<uint32_t>(dist(engine)); }
+    uint32_t get_random_uint32() override { return static_cast<uint32_t>(draw<1>()[0]); }
 
-    uint64_t get_random_uint64() override { return dist(engine); }
+    uint64_t get_random_uint64() override { return draw<1>()[0]; }
 
     uint128_t get_random_uint128() override
     {
-        uint128_t hi = dist(engine);
-        uint128_t lo = dist(engine);
+        const auto values = draw<2>();
+        uint128_t hi = values[0];
+        uint128_t lo = values[1];
         return (hi << 64) | lo;
     }
 
     uint256_t get_random_uint256() override
     {
-        // Do not inline in constructor call. Evaluation order is important for cross-compiler consistency.
-        auto a = dist(engine);
-        auto b = dist(engine);
-        auto c = dist(engine);
-        auto d = dist(engine);
-        return { a, b, c, d };
+        const auto values = draw<4>();
+        return { values[0], values[1], values[2], values[3] };
+    }
+
+    void reseed(std::uint_fast64_t seed)
+    {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(mutex);
+#endif
+        engine.seed(seed);
+        dist.reset();
     }
 
   private:
     std::mt19937_64 engine;
     std::uniform_int_distribution<uint64_t> dist = std::uniform_int_distribution<uint64_t>{ 0ULL, UINT64_MAX };
+#ifndef NO_MULTITHREADING
+    std::mutex mutex;
+#endif
+
+    // Draw consecutive values of the engine, in order, which is important for cross-compiler consistency
+    template <size_t num_values> std::array<uint64_t, num_values> draw()
+    {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(mutex);
+#endif
+        std::array<uint64_t, num_values> values;
+        for (auto& value : values) {
+            value = dist(engine);
+        }
+        return values;
+    }
 };
 
 /**
@@ -186,7 +215,7 @@ RNG& get_debug_randomness(bool reset, std::uint_fast64_t seed)
     // static std::seed_seq seed({ 1, 2, 3, 4, 5 });
     static DebugEngine debug_engine = DebugEngine();
     if (reset) {
-        debug_engine = DebugEngine(seed);
+        debug_engine.reseed(seed);
     }
     return debug_engine;
 }
@@ -1,7 +1,10 @@
 #include "engine.hpp"
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/common/streams.hpp"
+#include <algorithm>
 #include <gtest/gtest.h>
+#include <thread>
+#include <vector>
 
 using namespace bb;
 
@@ -33,6 +36,35 @@ TEST(engine, ResetDebugEngine)
     EXPECT_NE(a, e);
 }
 
+#ifndef NO_MULTITHREADING
+// Concurrent draws from the debug engine return the same values as sequential draws, in some order
+TEST(engine, ConcurrentDebugEngineDraws)
+{
+    constexpr size_t num_draws = 1 << 12;
+    std::vector<uint64_t> expected(2 * num_draws);
+    auto& debug_engine = numeric::get_debug_randomness(true);
+    for (auto& value : expected) {
+        value = debug_engine.get_random_uint64();
+    }
+
+    numeric::get_debug_randomness(true);
+    std::vector<uint64_t> drawn(2 * num_draws);
+    std::thread other_thread([&]() {
+        for (size_t i = 0; i < num_draws; ++i) {
+            drawn[i] = debug_engine.get_random_uint64();
+        }
+    });
+    for (size_t i = num_draws; i < 2 * num_draws; ++i) {
+        drawn[i] = debug_engine.get_random_uint64();
+    }
+    other_thread.join();
+
+    std::sort(expected.begin(), expected.end());
+    std::sort(drawn.begin(), drawn.end());
+    EXPECT_EQ(drawn, expected);
+}
+#endif
+
 TEST(engine, GetExpectedDebugValue)
 {
     auto& debug_engine = numeric::get_debug_randomness(true);
@@ -2,6 +2,10 @@
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/legacy_polynomial.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
+#include <algorithm>
+#include <optional>
+#include <set>
+#include <span>
 
 namespace bb::plonk {
 
@@ -155,131 +159,148 @@ void work_queue::flush_queue()
 
 void work_queue::add_to_queue(const work_item& item)
 {
-    // TODO: Why do we have this? It's caused (me) a lot of confusion over time as it's kind of a hidden deviation.
-    // Commenting it out as it wasn't needed to do FFT's in the WASM when I did low memory prover work.
-    // Somebody please put explanatory comment here in detail if it is needed. If time has gone by, delete it.
-    // #if 1
-    //     if (item.work_type == WorkType::FFT) {
-    //         const auto large_root = key->large_domain.root;
-    //         bb::fr coset_shifts[4]{
-    //             bb::fr(1), large_root, large_root.sqr(), large_root.sqr() * large_root
-    //         };
-    //         work_item_queue.push_back({
-    //             WorkType::SMALL_FFT,
-    //             nullptr,
-    //             item.tag,
-    //             coset_shifts[0],
-    //             0,
-    //         });
-    //         work_item_queue.push_back({
-    //             WorkType::SMALL_FFT,
-    //             nullptr,
-    //             item.tag,
-    //             coset_shifts[1],
-    //             1,
-    //         });
-    //         work_item_queue.push_back({
-    //             WorkType::SMALL_FFT,
-    //             nullptr,
-    //             item.tag,
-    //             coset_shifts[2],
-    //             2,
-    //         });
-    //         work_item_queue.push_back({
-    //             WorkType::SMALL_FFT,
-    //             nullptr,
-    //             item.tag,
-    //             coset_shifts[3],
-    //             3,
-    //         });
-    //     } else {
-    //         work_item_queue.push_back(item);
-    //     }
-    // #else
     work_item_queue.push_back(item);
-    // #endif
 }
 
-void work_queue::process_queue()
+/**
+ * @brief The end of the stage of the queue that starts at begin, i.e. the first item that depends on an earlier item of
+ * the stage
+ *
+ * @details Scalar multiplications read the scalars they were queued with, so they never depend on other items. An FFT
+ * reads the monomial form of its wire, which an IFFT of the same stage writes. The items of a stage are independent
+ * and can be processed in any order.
+ */
+size_t work_queue::get_stage_end(const size_t begin) const
 {
-    for (const auto& item : work_item_queue) {
-        switch (item.work_type) {
-        // most expensive op
-        case WorkType::SCALAR_MULTIPLICATION: {
-            // Note: work_item.constant is an Fr type (see SMALL_FFT), but here it is interpreted simply as a size_t
-            auto msm_size = static_cast<size_t>(static_cast<uint256_t>(item.constant));
-
-            ASSERT(msm_size <= key->reference_string->get_monomial_size());
-
-            std::span<bb::g1::affine_element> srs_points = key->reference_string->get_monomial_points();
-
-            // Run pippenger multi-scalar multiplication.
-            auto runtime_state = bb::scalar_multiplication::pippenger_runtime_state<curve::BN254>(msm_size);
-            bb::g1::affine_element result(bb::scalar_multiplication::pippenger_unsafe<curve::BN254>(
-                { 0, { item.mul_scalars.get(), msm_size } }, srs_points, runtime_state));
-
-            transcript->add_element(item.tag, result.to_buffer());
-
-            break;
+    std::set<std::string> ifft_tags;
+    std::set<std::string> fft_tags;
+    size_t end = begin;
+    for (; end < work_item_queue.size(); ++end) {
+        const auto& item = work_item_queue[end];
+        if (item.work_type == WorkType::FFT) {
+            if (ifft_tags.contains(item.tag)) {
+                break;
+            }
+            fft_tags.insert(item.tag);
         }
-        // Commenting this out as per above.
-        // About 20% of the cost of a scalar multiplication. For WASM, might be a bit more expensive
-        // due to the need to copy memory between web workers
-        // case WorkType::SMALL_FFT: {
-        //     using namespace bb;
-        //     const size_t n = key->circuit_size;
-        //     auto wire = key->polynomial_store.get(item.tag);
+        if (item.work_type == WorkType::IFFT) {
+            if (fft_tags.contains(item.tag)) {
+                break;
+            }
+            ifft_tags.insert(item.tag);
+        }
+    }
+    return end;
+}
 
-        //     polynomial wire_copy(wire, n);
-        //     wire_copy.coset_fft_with_generator_shift(key->small_domain, item.constant);
+/**
+ * @brief Process the (independent) items [begin, end) of the queue
+ *
+ * @details Every parallel loop of a transform is split across all threads however small the transform, so rather than
+ * running the items one after the other, the IFFTs and the FFTs of the stage are each done in a single batched call.
+ * Scalar multiplications of the same size share one pippenger runtime state. The commitments are added to the
+ * transcript in queue order.
+ */
+void work_queue::process_stage(const size_t begin, const size_t end)
+{
+    const auto items = std::span(work_item_queue).subspan(begin, end - begin);
 
-        //     if (item.index != 0) {
-        //         auto old_wire_fft = key->polynomial_store.get(item.tag + "_fft");
-        //         for (size_t i = 0; i < n; ++i) {
-        //             old_wire_fft[4 * i + item.index] = wire_copy[i];
-        //         }
-        //         old_wire_fft[4 * n + item.index] = wire_copy[0];
-        //         key->polynomial_store.put(item.tag + "_fft", std::move(old_wire_fft));
-        //     } else {
-        //         polynomial wire_fft(4 * n + 4);
-        //         for (size_t i = 0; i < n; ++i) {
-        //             wire_fft[4 * i + item.index] = wire_copy[i];
-        //         }
-        //         key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
-        //     }
-        //     break;
-        // }
-        case WorkType::FFT: {
-            using namespace bb;
-            auto wire = key->polynomial_store.get(item.tag);
-            polynomial wire_fft(wire, 4 * key->circuit_size + 4);
+    {
+        PROFILE_THIS_NAME("work_queue::IFFT");
+        // 1/4 the cost of an fft (each fft has 1/4 the number of elements)
+        std::vector<polynomial> wire_monomials;
+        std::vector<fr*> wire_monomial_ptrs;
+        for (const auto& item : items) {
+            if (item.work_type == WorkType::IFFT) {
+                // Copy the wire in lagrange form, to be transformed to monomial form in place
+                auto wire_lagrange = key->polynomial_store.get(item.tag + "_lagrange");
+                auto& wire_monomial = wire_monomials.emplace_back(key->circuit_size);
+                polynomial_arithmetic::copy_polynomial(
+                    &wire_lagrange[0], &wire_monomial[0], key->circuit_size, key->circuit_size);
+                wire_monomial_ptrs.push_back(wire_monomial.data().get());
+            }
+        }
+        polynomial_arithmetic::ifft_batch(wire_monomial_ptrs, key->small_domain);
+        auto wire_monomial = wire_monomials.begin();
+        for (const auto& item : items) {
+            if (item.work_type == WorkType::IFFT) {
+                key->polynomial_store.put(item.tag, std::move(*wire_monomial++));
+            }
+        }
+    }
 
-            wire_fft.coset_fft(key->large_domain);
-            for (size_t i = 0; i < 4; i++) {
-                wire_fft[4 * key->circuit_size + i] = wire_fft[i];
+    {
+        PROFILE_THIS_NAME("work_queue::FFT");
+        std::vector<polynomial> wire_ffts;
+        std::vector<fr*> wire_fft_ptrs;
+        for (const auto& item : items) {
+            if (item.work_type == WorkType::FFT) {
+                auto wire = key->polynomial_store.get(item.tag);
+                auto& wire_fft = wire_ffts.emplace_back(wire, 4 * key->circuit_size + 4);
+                wire_fft_ptrs.push_back(wire_fft.data().get());
             }
+        }
+        polynomial_arithmetic::coset_fft_batch(wire_fft_ptrs, key->large_domain);
+        auto wire_fft = wire_ffts.begin();
+        for (const auto& item : items) {
+            if (item.work_type == WorkType::FFT) {
+                for (size_t i = 0; i < 4; i++) {
+                    (*wire_fft)[4 * key->circuit_size + i] = (*wire_fft)[i];
+                }
+                key->polynomial_store.put(item.tag + "_fft", std::move(*wire_fft++));
+            }
+        }
+    }
 
-            key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
+    {
+        // most expensive op
+        PROFILE_THIS_NAME("work_queue::SCALAR_MULTIPLICATION");
+        std::span<bb::g1::affine_element> srs_points = key->reference_string->get_monomial_points();
 
-            break;
-        }
-        // 1/4 the cost of an fft (each fft has 1/4 the number of elements)
-        case WorkType::IFFT: {
-            using namespace bb;
-            // retrieve wire in lagrange form
-            auto wire_lagrange = key->polynomial_store.get(item.tag + "_lagrange");
+        // Scalar multiplications in order of size, so that those of the same size share a runtime state and there is
+        // one runtime state at a time
+        std::vector<std::pair<size_t, size_t>> msm_sizes_and_indices;
+        for (size_t i = 0; i < items.size(); ++i) {
+            if (items[i].work_type == WorkType::SCALAR_MULTIPLICATION) {
+                // Note: work_item.constant is an Fr type (see SMALL_FFT), but here it is interpreted simply as a size_t
+                auto msm_size = static_cast<size_t>(static_cast<uint256_t>(items[i].constant));
 
-            // Compute wire monomial form via ifft on lagrange form then add it to the store
-            polynomial wire_monomial(key->circuit_size);
-            polynomial_arithmetic::ifft((fr*)&wire_lagrange[0], &wire_monomial[0], key->small_domain);
-            key->polynomial_store.put(item.tag, std::move(wire_monomial));
+                ASSERT(msm_size <= key->reference_string->get_monomial_size());
 
-            break;
+                msm_sizes_and_indices.emplace_back(msm_size, i);
+            }
         }
-        default: {
+        std::sort(msm_sizes_and_indices.begin(), msm_sizes_and_indices.end());
+
+        std::vector<bb::g1::affine_element> results(items.size());
+        std::optional<bb::scalar_multiplication::pippenger_runtime_state<curve::BN254>> runtime_state;
+        size_t runtime_state_size = 0;
+        for (const auto& [msm_size, i] : msm_sizes_and_indices) {
+            if (!runtime_state.has_value() || runtime_state_size != msm_size) {
+                runtime_state.reset();
+                runtime_state.emplace(msm_size);
+                runtime_state_size = msm_size;
+            }
+            // Run pippenger multi-scalar multiplication.
+            results[i] = bb::scalar_multiplication::pippenger_unsafe<curve::BN254>(
+                { 0, { items[i].mul_scalars.get(), msm_size } }, srs_points, *runtime_state);
         }
+
+        for (size_t i = 0; i < items.size(); ++i) {
+            if (items[i].work_type == WorkType::SCALAR_MULTIPLICATION) {
+                transcript->add_element(items[i].tag, results[i].to_buffer());
+            }
         }
     }
+}
+
+void work_queue::process_queue()
+{
+    for (size_t begin = 0; begin < work_item_queue.size();) {
+        const size_t end = get_stage_end(begin);
+        process_stage(begin, end);
+        begin = end;
+    }
     work_item_queue = std::vector<work_item>();
 }
 
@@ -64,6 +64,10 @@ class work_queue {
     std::vector<work_item> get_queue() const;
 
   private:
+    size_t get_stage_end(size_t begin) const;
+
+    void process_stage(size_t begin, size_t end);
+
     proving_key* key;
     transcript::StandardTranscript* transcript;
     std::vector<work_item> work_item_queue;
@@ -2,7 +2,11 @@
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/ref_array.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
+#include "barretenberg/plonk_honk_shared/arithmetization/selector.hpp"
 #include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
 
 #ifdef CHECK_CIRCUIT_STACKTRACES
 #include <backward.hpp>
@@ -29,8 +33,31 @@ struct StackTraces {
 
 // A set of fixed block size conigurations to be used with the structured execution trace. The actual block sizes
 // corresponding to these settings are defined in the corresponding arithmetization classes (Ultra/Mega). For efficiency
-// it is best to use the smallest possible block sizes to accommodate a given situation.
-enum class TraceStructure { NONE, SMALL_TEST, CLIENT_IVC_BENCH, E2E_FULL_TEST };
+// it is best to use the smallest possible block sizes to accommodate a given situation. The block sizes of CUSTOM are
+// given at runtime in TraceSettings, e.g. a structure proposed by ExecutionTraceUsageTracker for the circuits of an
+// actual workload.
+enum class TraceStructure { NONE, SMALL_TEST, CLIENT_IVC_BENCH, E2E_FULL_TEST, CUSTOM };
+
+/**
+ * @brief The structure of an execution trace: one of the TraceStructure configurations, along with the block sizes of
+ * TraceStructure::CUSTOM
+ */
+struct TraceSettings {
+    TraceStructure structure = TraceStructure::NONE;
+    // The fixed size of each block, in the order of the blocks of the arithmetization, used if structure is CUSTOM
+    std::vector<uint32_t> custom_block_sizes;
+
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    TraceSettings(TraceStructure structure = TraceStructure::NONE)
+        : structure(structure)
+    {}
+    TraceSettings(std::vector<uint32_t> custom_block_sizes)
+        : structure(TraceStructure::CUSTOM)
+        , custom_block_sizes(std::move(custom_block_sizes))
+    {}
+
+    bool is_structured() const { return structure != TraceStructure::NONE; }
+};
 
 /**
  * @brief Basic structure for storing gate data in a builder
@@ -41,7 +68,7 @@ enum class TraceStructure { NONE, SMALL_TEST, CLIENT_IVC_BENCH, E2E_FULL_TEST };
  */
 template <typename FF, size_t NUM_WIRES, size_t NUM_SELECTORS> class ExecutionTraceBlock {
   public:
-    using SelectorType = SlabVector<FF>;
+    using SelectorType = Selector<FF>;
     using WireType = SlabVector<uint32_t>;
     using Selectors = std::array<SelectorType, NUM_SELECTORS>;
     using Wires = std::array<WireType, NUM_WIRES>;
@@ -71,7 +98,32 @@ template <typename FF, size_t NUM_WIRES, size_t NUM_SELECTORS> class ExecutionTr
 
     bool operator==(const ExecutionTraceBlock& other) const = default;
 
-    size_t size() const { return std::get<0>(this->wires).size(); }
+    size_t size() const { return count_only ? num_counted_gates : std::get<0>(this->wires).size(); }
+
+    /**
+     * @brief From now on only keep the wires and selector values of the last gate of the block, while still counting
+     * its gates
+     * @details For builders that are only used to generate the witness and count gates (e.g. for gate counts or the
+     * sizing of a structured trace), for which the gate data would be wasted memory. The last gate is kept since
+     * adding a gate can read it back (see the fusion of elliptic gates).
+     */
+    void set_count_only()
+    {
+        num_counted_gates = size();
+        for (auto& wire : wires) {
+            WireType last_gate_wire;
+            if (!wire.empty()) {
+                last_gate_wire.emplace_back(wire.back());
+            }
+            wire.swap(last_gate_wire);
+        }
+        for (auto& selector : selectors) {
+            selector.set_count_only();
+        }
+        count_only = true;
+    }
+
+    bool is_count_only() const { return count_only; }
 
     void reserve(size_t size_hint)
     {
@@ -103,8 +155,25 @@ template <typename FF, size_t NUM_WIRES, size_t NUM_SELECTORS> class ExecutionTr
         }
     }
 #endif
+  protected:
+    void append_wires(const std::array<uint32_t, NUM_WIRES>& gate_wires)
+    {
+        for (size_t idx = 0; idx < NUM_WIRES; ++idx) {
+            if (count_only && !wires[idx].empty()) {
+                wires[idx].back() = gate_wires[idx];
+            } else {
+                wires[idx].emplace_back(gate_wires[idx]);
+            }
+        }
+        if (count_only) {
+            ++num_counted_gates;
+        }
+    }
+
   private:
     uint32_t fixed_size = 0; // Fixed size for use in structured trace
+    bool count_only = false; // if true, the wires only hold the last gate and num_counted_gates is the size
+    size_t num_counted_gates = 0;
 };
 
 } // namespace bb
\ No newline at end of file
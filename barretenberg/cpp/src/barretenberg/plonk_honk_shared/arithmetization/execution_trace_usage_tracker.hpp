@@ -1,7 +1,10 @@
 #pragma once
 
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/plonk_honk_shared/arithmetization/mega_arithmetization.hpp"
 #include "barretenberg/stdlib_circuit_builders/mega_circuit_builder.hpp"
+#include <sstream>
+#include <string>
 
 namespace bb {
 
@@ -18,6 +21,7 @@ struct ExecutionTraceUsageTracker {
     using MegaTraceBlockSizes = MegaArithmetization::MegaTraceBlocks<size_t>;
     using MegaTraceActiveRanges = MegaArithmetization::MegaTraceBlocks<Range>;
     using MegaTraceFixedBlockSizes = MegaArithmetization::TraceBlocks;
+    using MegaTraceStructuredBlockSizes = MegaArithmetization::MegaTraceBlocks<uint32_t>;
 
     MegaTraceBlockSizes max_sizes;        // max utilization of each block
     MegaTraceFixedBlockSizes fixed_sizes; // fixed size of each block prescribed by structuring
@@ -29,9 +33,9 @@ struct ExecutionTraceUsageTracker {
     size_t max_databus_size = 0;
     size_t max_tables_size = 0;
 
-    TraceStructure trace_structure = TraceStructure::NONE;
+    TraceSettings trace_structure;
 
-    ExecutionTraceUsageTracker(const TraceStructure& trace_structure = TraceStructure::NONE)
+    ExecutionTraceUsageTracker(const TraceSettings& trace_structure = TraceStructure::NONE)
         : trace_structure(trace_structure)
     {
         for (auto& size : max_sizes.get()) {
@@ -78,7 +82,7 @@ struct ExecutionTraceUsageTracker {
     bool check_is_active(const size_t idx)
     {
         // If structured trace is not in use, assume the whole trace is active
-        if (trace_structure == TraceStructure::NONE) {
+        if (!trace_structure.is_structured()) {
             return true;
         }
         for (auto& range : active_ranges.get()) {
@@ -89,11 +93,87 @@ struct ExecutionTraceUsageTracker {
         return false;
     }
 
-    // For printing only. Must match the order of the members in the arithmetization
-    std::vector<std::string> block_labels{ "ecc_op",     "pub_inputs",         "busread",
-                                           "arithmetic", "delta_range",        "elliptic",
-                                           "aux",        "poseidon2_external", "poseidon2_internal",
-                                           "lookup" };
+    // For printing and serialization. Must match the order of the members in the arithmetization
+    inline static const std::vector<std::string> block_labels{ "ecc_op",     "pub_inputs",         "busread",
+                                                               "arithmetic", "delta_range",        "elliptic",
+                                                               "aux",        "poseidon2_external", "poseidon2_internal",
+                                                               "lookup" };
+
+    /**
+     * @brief Propose the smallest structured trace that accommodates every circuit seen so far
+     * @details Each block is given its max utilization. The trace must also be large enough for the databus and lookup
+     * table data and for the zero row preceding the blocks, which the arithmetic block is grown to account for if
+     * needed. The result can be serialized and used for subsequent proofs via TraceStructure::CUSTOM (see
+     * to_trace_settings).
+     */
+    MegaTraceStructuredBlockSizes propose_block_sizes() const
+    {
+        MegaTraceStructuredBlockSizes block_sizes{};
+        size_t total_size = 0;
+        for (auto [block_size, max_size] : zip_view(block_sizes.get(), max_sizes.get())) {
+            block_size = static_cast<uint32_t>(max_size);
+            total_size += max_size;
+        }
+        const size_t min_size = std::max({ total_size, max_databus_size, max_tables_size });
+        block_sizes.arithmetic += static_cast<uint32_t>(min_size - total_size);
+        total_size = min_size;
+        // The dyadic size is the power of two above the total block size, which leaves no room for the zero row
+        if ((total_size & (total_size - 1)) == 0) {
+            block_sizes.arithmetic += 1;
+        }
+        return block_sizes;
+    }
+
+    /**
+     * @brief Serialize block sizes as one "<block label> <size>" line per block
+     */
+    static std::string serialize_block_sizes(const MegaTraceStructuredBlockSizes& block_sizes)
+    {
+        std::ostringstream stream;
+        for (auto [label, block_size] : zip_view(block_labels, block_sizes.get())) {
+            stream << label << " " << block_size << "\n";
+        }
+        return stream.str();
+    }
+
+    /**
+     * @brief The settings of a TraceStructure::CUSTOM structured trace with the given block sizes
+     */
+    static TraceSettings to_trace_settings(const MegaTraceStructuredBlockSizes& block_sizes)
+    {
+        std::vector<uint32_t> custom_block_sizes;
+        for (const uint32_t block_size : block_sizes.get()) {
+            custom_block_sizes.emplace_back(block_size);
+        }
+        return TraceSettings(std::move(custom_block_sizes));
+    }
+
+    static MegaTraceStructuredBlockSizes deserialize_block_sizes(const std::string& serialized)
+    {
+        MegaTraceStructuredBlockSizes block_sizes{};
+        std::vector<bool> is_set(block_labels.size(), false);
+        std::istringstream stream(serialized);
+        std::string label;
+        uint32_t block_size = 0;
+        while (stream >> label >> block_size) {
+            const auto it = std::find(block_labels.begin(), block_labels.end(), label);
+            if (it == block_labels.end()) {
+                throw_or_abort("ExecutionTraceUsageTracker: unknown block in structured trace: " + label);
+            }
+            const auto idx = static_cast<size_t>(it - block_labels.begin());
+            block_sizes.get()[idx] = block_size;
+            is_set[idx] = true;
+        }
+        if (!stream.eof()) {
+            throw_or_abort("ExecutionTraceUsageTracker: malformed structured trace block sizes");
+        }
+        for (size_t idx = 0; idx < block_labels.size(); ++idx) {
+            if (!is_set[idx]) {
+                throw_or_abort("ExecutionTraceUsageTracker: missing block in structured trace: " + block_labels[idx]);
+            }
+        }
+        return block_sizes;
+    }
 
     void print()
     {
@@ -102,6 +182,9 @@ struct ExecutionTraceUsageTracker {
             std::cout << std::left << std::setw(20) << (label + ":") << max_size << std::endl;
         }
         info("");
+        info("Proposed structured trace (see TraceStructure::CUSTOM): ");
+        std::cout << serialize_block_sizes(propose_block_sizes());
+        info("");
     }
 
     void print_active_ranges()
@@ -140,7 +223,7 @@ struct ExecutionTraceUsageTracker {
 
         // Convert the active ranges for each gate type into a set of sorted non-overlapping ranges (union of the input)
         std::vector<Range> simplified_active_ranges;
-        if (trace_structure == TraceStructure::NONE) {
+        if (!trace_structure.is_structured()) {
             // If not using a structured trace, set the active range to the whole domain
             simplified_active_ranges.push_back(Range{ 0, full_domain_size });
         } else {
@@ -40,3 +40,34 @@ TEST_F(ExecutionTraceUsageTrackerTest, ConstructThreadRanges)
 
     EXPECT_EQ(thread_ranges, expected_thread_ranges);
 }
+
+// Test that the proposed structure fits the max block utilization, the tables and the zero row, and survives
+// serialization
+TEST_F(ExecutionTraceUsageTrackerTest, ProposeBlockSizes)
+{
+    ExecutionTraceUsageTracker tracker;
+    tracker.max_sizes.ecc_op = 100;
+    tracker.max_sizes.pub_inputs = 10;
+    tracker.max_sizes.arithmetic = 1000;
+    tracker.max_sizes.lookup = 12;
+
+    auto block_sizes = tracker.propose_block_sizes();
+    EXPECT_EQ(block_sizes.ecc_op, 100);
+    EXPECT_EQ(block_sizes.pub_inputs, 10);
+    EXPECT_EQ(block_sizes.busread, 0);
+    EXPECT_EQ(block_sizes.arithmetic, 1000);
+    EXPECT_EQ(block_sizes.lookup, 12);
+
+    // The arithmetic block makes room for tables larger than the blocks
+    tracker.max_tables_size = 2000;
+    block_sizes = tracker.propose_block_sizes();
+    EXPECT_EQ(block_sizes.arithmetic, 2000 - 122);
+
+    // ... and for the zero row if the blocks would fill the dyadic trace
+    tracker.max_tables_size = 2048;
+    block_sizes = tracker.propose_block_sizes();
+    EXPECT_EQ(block_sizes.arithmetic, 2048 - 122 + 1);
+
+    const std::string serialized = ExecutionTraceUsageTracker::serialize_block_sizes(block_sizes);
+    EXPECT_EQ(ExecutionTraceUsageTracker::deserialize_block_sizes(serialized), block_sizes);
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/common/zip_view.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/plonk_honk_shared/arithmetization/arithmetization.hpp"
@@ -150,10 +151,7 @@ template <typename FF_> class MegaArith {
             this->stack_traces.populate();
 #endif
             this->tracy_gate();
-            this->wires[0].emplace_back(idx_1);
-            this->wires[1].emplace_back(idx_2);
-            this->wires[2].emplace_back(idx_3);
-            this->wires[3].emplace_back(idx_4);
+            this->append_wires({ idx_1, idx_2, idx_3, idx_4 });
         }
 
         auto& w_l() { return std::get<0>(this->wires); };
@@ -202,11 +200,11 @@ template <typename FF_> class MegaArith {
         }
 
         // Set fixed block sizes for use in structured trace
-        void set_fixed_block_sizes(TraceStructure setting)
+        void set_fixed_block_sizes(const TraceSettings& settings)
         {
             MegaTraceBlocks<uint32_t> fixed_block_sizes{}; // zero initialized
 
-            switch (setting) {
+            switch (settings.structure) {
             case TraceStructure::NONE:
                 break;
             case TraceStructure::SMALL_TEST:
@@ -218,6 +216,14 @@ template <typename FF_> class MegaArith {
             case TraceStructure::E2E_FULL_TEST:
                 fixed_block_sizes = E2eStructuredBlockSizes();
                 break;
+            case TraceStructure::CUSTOM:
+                if (settings.custom_block_sizes.size() != fixed_block_sizes.get().size()) {
+                    throw_or_abort("MegaArithmetization: a custom structured trace needs a size for every block");
+                }
+                for (auto [size, custom_size] : zip_view(fixed_block_sizes.get(), settings.custom_block_sizes)) {
+                    size = custom_size;
+                }
+                break;
             }
             for (auto [block, size] : zip_view(this->get(), fixed_block_sizes.get())) {
                 block.set_fixed_size(size);
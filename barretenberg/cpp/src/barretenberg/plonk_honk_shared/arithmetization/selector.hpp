@@ -0,0 +1,266 @@
+#pragma once
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/slab_allocator.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace bb {
+
+/**
+ * @brief Compact storage of the values of a single selector over the gates of an execution trace block
+ *
+ * @details Almost all selector values are 0, 1 or other small integers, and most selectors vanish identically outside
+ * of the block of their own gate type, so storing a full field element per gate wastes most of the builder's memory.
+ * A selector is instead stored
+ *  - as a single entry for as long as every gate has the same value (e.g. a gate selector outside of its own block),
+ *  - otherwise as one int32_t entry per gate, holding either a small integer value directly or, for values that are
+ *    not small integers, an index into a vector of full field elements.
+ * Values are read back by value with operator[] and are expanded directly into the trace polynomials with
+ * populate_polynomial(). A selector of a builder that only counts gates keeps the value of its last gate only (see
+ * set_count_only()).
+ *
+ * @tparam FF
+ */
+template <typename FF> class Selector {
+  public:
+    // An entry e with |e| < SMALL_VALUE_BOUND is the value e, an entry e <= -SMALL_VALUE_BOUND is the full field
+    // element large_values[-SMALL_VALUE_BOUND - e]
+    static constexpr int32_t SMALL_VALUE_BOUND = 1 << 30;
+
+    template <typename T> void emplace_back(const T& value)
+    {
+        // Integer literals, by far the most common selector values, are stored without any field arithmetic
+        if constexpr (std::integral<T>) {
+            if (std::cmp_greater(value, -SMALL_VALUE_BOUND) && std::cmp_less(value, SMALL_VALUE_BOUND)) {
+                push_entry(static_cast<int32_t>(value));
+                return;
+            }
+        }
+        push_entry(encode(FF(value)));
+    }
+
+    FF operator[](size_t idx) const
+    {
+        ASSERT(!count_only || idx + 1 == num_values);
+        return decode(is_constant ? constant_entry : entries[idx]);
+    }
+
+    /**
+     * @brief Overwrite the value of an existing gate (e.g. when fusing a gate into the previous one)
+     */
+    void set(size_t idx, const FF& value)
+    {
+        ASSERT(idx < num_values);
+        const int32_t entry = encode(value);
+        if (count_only) {
+            ASSERT(idx + 1 == num_values);
+            constant_entry = entry;
+            return;
+        }
+        if (is_constant) {
+            if (entry == constant_entry) {
+                return;
+            }
+            materialize();
+        }
+        entries[idx] = entry;
+    }
+
+    size_t size() const { return num_values; }
+
+    /**
+     * @brief From now on only keep the value of the last gate, while still counting gates
+     * @details The last gate is the only one read back (or overwritten) while gates are being added, so this is all a
+     * builder that only generates the witness and counts gates needs.
+     */
+    void set_count_only()
+    {
+        const FF last_value = num_values > 0 ? (*this)[num_values - 1] : FF(0);
+        SlabVector<int32_t>().swap(entries);
+        SlabVector<FF>().swap(large_values);
+        count_only = true;
+        is_constant = true;
+        constant_entry = encode(last_value);
+    }
+
+    bool is_count_only() const { return count_only; }
+
+    void reserve(size_t size_hint)
+    {
+        capacity_hint = size_hint;
+        if (!is_constant) {
+            entries.reserve(size_hint);
+        }
+    }
+
+    /**
+     * @brief Resize to new_size gates, new gates having value zero
+     */
+    void resize(size_t new_size)
+    {
+        if (new_size <= num_values) {
+            num_values = new_size;
+            if (!is_constant) {
+                entries.resize(new_size);
+            }
+            return;
+        }
+        while (num_values < new_size) {
+            push_entry(0);
+        }
+    }
+
+    /**
+     * @brief Write the value of gate i into polynomial[offset + i] for every gate i in [start, end)
+     * @details The polynomial is assumed to be zero initialized, so zero values are skipped; in particular nothing is
+     * written for a selector that vanishes on the whole block. Disjoint ranges of gates can be populated concurrently.
+     */
+    template <typename Polynomial>
+    void populate_polynomial(Polynomial& polynomial, size_t offset, size_t start, size_t end) const
+    {
+        ASSERT(!count_only && start <= end && end <= num_values);
+        if (is_constant) {
+            if (constant_entry == 0) {
+                return;
+            }
+            const FF value = decode(constant_entry);
+            for (size_t i = start; i < end; ++i) {
+                polynomial.set_if_valid_index(offset + i, value);
+            }
+            return;
+        }
+        // Consecutive gates mostly share their selector values, so only decode on a change of entry
+        int32_t last_entry = 0;
+        FF last_value = 0;
+        for (size_t i = start; i < end; ++i) {
+            const int32_t entry = entries[i];
+            if (entry == 0) {
+                continue;
+            }
+            if (entry != last_entry) {
+                last_entry = entry;
+                last_value = decode(entry);
+            }
+            polynomial.set_if_valid_index(offset + i, last_value);
+        }
+    }
+
+    template <typename Polynomial> void populate_polynomial(Polynomial& polynomial, size_t offset) const
+    {
+        populate_polynomial(polynomial, offset, 0, num_values);
+    }
+
+    size_t get_memory_usage() const
+    {
+        return entries.capacity() * sizeof(int32_t) + large_values.capacity() * sizeof(FF);
+    }
+
+    bool operator==(const Selector& other) const
+    {
+        if (num_values != other.num_values || count_only != other.count_only) {
+            return false;
+        }
+        if (count_only) {
+            return num_values == 0 || (*this)[num_values - 1] == other[num_values - 1];
+        }
+        for (size_t i = 0; i < num_values; ++i) {
+            if ((*this)[i] != other[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+  private:
+    size_t num_values = 0;
+    size_t capacity_hint = 0;
+    bool is_constant = true; // if true, every gate has the value of constant_entry and entries is empty
+    bool count_only = false; // if true, constant_entry is the value of the last gate only (and is_constant is true)
+    int32_t constant_entry = 0;
+    SlabVector<int32_t> entries;
+    SlabVector<FF> large_values;
+
+    FF decode(int32_t entry) const
+    {
+        if (entry > -SMALL_VALUE_BOUND) {
+            return FF(static_cast<int>(entry));
+        }
+        return large_values[static_cast<size_t>(-SMALL_VALUE_BOUND - static_cast<int64_t>(entry))];
+    }
+
+    int32_t encode(const FF& value)
+    {
+        if (value.is_zero()) {
+            return 0;
+        }
+        const auto small_value = [](const FF& element) -> int32_t {
+            const auto integer = static_cast<uint256_t>(element);
+            const bool is_small = integer.data[1] == 0 && integer.data[2] == 0 && integer.data[3] == 0 &&
+                                  integer.data[0] < static_cast<uint64_t>(SMALL_VALUE_BOUND);
+            return is_small ? static_cast<int32_t>(integer.data[0]) : 0;
+        };
+        if (const int32_t positive = small_value(value); positive != 0) {
+            return positive;
+        }
+        if (const int32_t negative = small_value(-value); negative != 0) {
+            return -negative;
+        }
+        // Runs of the same large value (e.g. a constant coefficient) share a single stored element
+        if (count_only) {
+            large_values.clear();
+        }
+        if (large_values.empty() || large_values.back() != value) {
+            ASSERT(large_values.size() < static_cast<size_t>(SMALL_VALUE_BOUND));
+            large_values.emplace_back(value);
+        }
+        return static_cast<int32_t>(-SMALL_VALUE_BOUND - static_cast<int64_t>(large_values.size() - 1));
+    }
+
+    void push_entry(int32_t entry)
+    {
+        if (count_only) {
+            constant_entry = entry;
+            ++num_values;
+            return;
+        }
+        if (is_constant) {
+            if (num_values == 0) {
+                constant_entry = entry;
+            }
+            if (entry == constant_entry) {
+                ++num_values;
+                return;
+            }
+            materialize();
+        }
+        entries.emplace_back(entry);
+        ++num_values;
+    }
+
+    // Switch from the constant representation to one entry per gate
+    void materialize()
+    {
+        entries.reserve(std::max(capacity_hint, num_values + 1));
+        entries.assign(num_values, constant_entry);
+        is_constant = false;
+    }
+};
+
+/**
+ * @brief Serialize as the values of the selector, identically to a vector of field elements
+ */
+template <typename B, typename FF> inline void write(B& buf, const Selector<FF>& selector)
+{
+    using serialize::write;
+    write(buf, static_cast<uint32_t>(selector.size()));
+    for (size_t i = 0; i < selector.size(); ++i) {
+        write(buf, selector[i]);
+    }
+}
+
+} // namespace bb
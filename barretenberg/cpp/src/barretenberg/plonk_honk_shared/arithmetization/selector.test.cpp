@@ -0,0 +1,160 @@
+#include "barretenberg/plonk_honk_shared/arithmetization/selector.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+}
+
+class SelectorTest : public ::testing::Test {
+  protected:
+    using FF = fr;
+
+    static void expect_values(const Selector<FF>& selector, const std::vector<FF>& expected)
+    {
+        ASSERT_EQ(selector.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_EQ(selector[i], expected[i]);
+        }
+    }
+};
+
+// A selector with a single value on every gate is stored without any per gate memory
+TEST_F(SelectorTest, ConstantSelector)
+{
+    const size_t num_gates = 1 << 12;
+    Selector<FF> zero_selector;
+    Selector<FF> constant_selector;
+    zero_selector.reserve(num_gates);
+    for (size_t i = 0; i < num_gates; ++i) {
+        zero_selector.emplace_back(0);
+        constant_selector.emplace_back(FF(7));
+    }
+    expect_values(zero_selector, std::vector<FF>(num_gates, 0));
+    expect_values(constant_selector, std::vector<FF>(num_gates, 7));
+    EXPECT_EQ(zero_selector.get_memory_usage(), 0);
+    EXPECT_EQ(constant_selector.get_memory_usage(), 0);
+}
+
+// Small integers of either sign are stored in 4 bytes per gate and everything else as a full field element
+TEST_F(SelectorTest, MixedValues)
+{
+    const size_t num_gates = 1 << 10;
+    const int32_t bound = Selector<FF>::SMALL_VALUE_BOUND;
+    Selector<FF> selector;
+    std::vector<FF> expected;
+    for (size_t i = 0; i < num_gates; ++i) {
+        FF value;
+        switch (i % 6) {
+        case 0:
+            value = FF(static_cast<uint64_t>(engine.get_random_uint16()));
+            selector.emplace_back(value);
+            break;
+        case 1:
+            value = -FF(static_cast<uint64_t>(engine.get_random_uint16()));
+            selector.emplace_back(value);
+            break;
+        case 2:
+            value = FF::random_element();
+            selector.emplace_back(value);
+            break;
+        case 3:
+            value = FF(-1);
+            selector.emplace_back(-1);
+            break;
+        case 4:
+            // Just outside of the small integers, on both sides
+            value = (i % 12 == 4) ? FF(static_cast<uint64_t>(bound)) : -FF(static_cast<uint64_t>(bound));
+            selector.emplace_back(value);
+            break;
+        default:
+            value = FF(static_cast<uint64_t>(bound - 1));
+            selector.emplace_back(static_cast<uint32_t>(bound - 1));
+            break;
+        }
+        expected.emplace_back(value);
+    }
+    expect_values(selector, expected);
+    EXPECT_LT(selector.get_memory_usage(), num_gates * sizeof(FF));
+
+    // Overwrite values of existing gates, including in a selector that was constant so far
+    Selector<FF> constant_selector;
+    constant_selector.resize(num_gates);
+    std::vector<FF> constant_expected(num_gates, 0);
+    for (size_t i = 0; i < num_gates; i += 7) {
+        const FF value = (i % 2 == 0) ? FF(1) : FF::random_element();
+        selector.set(i, value);
+        expected[i] = value;
+        constant_selector.set(i, value);
+        constant_expected[i] = value;
+    }
+    expect_values(selector, expected);
+    expect_values(constant_selector, constant_expected);
+
+    selector.resize(num_gates / 2);
+    expected.resize(num_gates / 2);
+    expect_values(selector, expected);
+}
+
+TEST_F(SelectorTest, PopulatePolynomial)
+{
+    const size_t num_gates = 1 << 10;
+    const size_t offset = 5;
+    Selector<FF> zero_selector;
+    Selector<FF> constant_selector;
+    Selector<FF> selector;
+    for (size_t i = 0; i < num_gates; ++i) {
+        zero_selector.emplace_back(0);
+        constant_selector.emplace_back(3);
+        selector.emplace_back(i % 3 == 0 ? FF::random_element() : FF(i % 3));
+    }
+
+    for (const auto* source : { &zero_selector, &constant_selector, &selector }) {
+        Polynomial<FF> polynomial(num_gates + offset);
+        source->populate_polynomial(polynomial, offset);
+        for (size_t i = 0; i < offset; ++i) {
+            EXPECT_EQ(polynomial[i], 0);
+        }
+        for (size_t i = 0; i < num_gates; ++i) {
+            EXPECT_EQ(polynomial[i + offset], (*source)[i]);
+        }
+
+        // Populating disjoint ranges of gates gives the same result
+        Polynomial<FF> polynomial_by_ranges(num_gates + offset);
+        source->populate_polynomial(polynomial_by_ranges, offset, num_gates / 3, num_gates);
+        source->populate_polynomial(polynomial_by_ranges, offset, 0, num_gates / 3);
+        for (size_t i = 0; i < num_gates + offset; ++i) {
+            EXPECT_EQ(polynomial_by_ranges[i], polynomial[i]);
+        }
+    }
+}
+
+// A count only selector keeps counting gates but only stores the value of the last one, which can still be overwritten
+TEST_F(SelectorTest, CountOnly)
+{
+    const size_t num_gates = 1 << 10;
+    Selector<FF> selector;
+    for (size_t i = 0; i < num_gates / 2; ++i) {
+        selector.emplace_back(i % 2 == 0 ? FF::random_element() : FF(i));
+    }
+    const FF last_value = selector[num_gates / 2 - 1];
+    selector.set_count_only();
+    EXPECT_TRUE(selector.is_count_only());
+    EXPECT_EQ(selector.size(), num_gates / 2);
+    EXPECT_EQ(selector[num_gates / 2 - 1], last_value);
+    EXPECT_EQ(selector.get_memory_usage(), 0);
+
+    for (size_t i = num_gates / 2; i < num_gates; ++i) {
+        const FF value = i % 2 == 0 ? FF::random_element() : FF(i);
+        selector.emplace_back(value);
+        EXPECT_EQ(selector[i], value);
+        selector.set(i, value + 1);
+        EXPECT_EQ(selector[i], value + 1);
+    }
+    EXPECT_EQ(selector.size(), num_gates);
+    EXPECT_LE(selector.get_memory_usage(), sizeof(FF));
+}
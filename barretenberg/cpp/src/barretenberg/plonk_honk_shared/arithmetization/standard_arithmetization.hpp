@@ -18,9 +18,7 @@ template <typename FF_> class StandardArith {
             this->stack_traces.populate();
 #endif
             this->tracy_gate();
-            this->wires[0].emplace_back(idx_1);
-            this->wires[1].emplace_back(idx_2);
-            this->wires[2].emplace_back(idx_3);
+            this->append_wires({ idx_1, idx_2, idx_3 });
         }
 
         auto& w_l() { return std::get<0>(this->wires); };
@@ -67,10 +67,7 @@ template <typename FF_> class UltraArith {
             this->stack_traces.populate();
 #endif
             this->tracy_gate();
-            this->wires[0].emplace_back(idx_1);
-            this->wires[1].emplace_back(idx_2);
-            this->wires[2].emplace_back(idx_3);
-            this->wires[3].emplace_back(idx_4);
+            this->append_wires({ idx_1, idx_2, idx_3, idx_4 });
         }
 
         auto& w_l() { return std::get<0>(this->wires); };
@@ -102,17 +99,18 @@ template <typename FF_> class UltraArith {
         }
 
         // Set fixed block sizes for use in structured trace
-        void set_fixed_block_sizes(TraceStructure setting)
+        void set_fixed_block_sizes(const TraceSettings& settings)
         {
             UltraTraceBlocks<uint32_t> fixed_block_sizes{}; // zero initialized
 
-            switch (setting) {
+            switch (settings.structure) {
             case TraceStructure::NONE:
                 break;
             // We don't use Ultra in ClientIvc so no need for anything other than sizing for simple unit tests
             case TraceStructure::SMALL_TEST:
             case TraceStructure::CLIENT_IVC_BENCH:
             case TraceStructure::E2E_FULL_TEST:
+            case TraceStructure::CUSTOM:
                 fixed_block_sizes = SmallTestStructuredBlockSizes();
                 break;
             }
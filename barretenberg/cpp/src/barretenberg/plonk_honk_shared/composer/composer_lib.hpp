@@ -28,11 +28,12 @@ void construct_lookup_table_polynomials(const RefArray<typename Flavor::Polynomi
 
     for (const auto& table : circuit.lookup_tables) {
         const fr table_index(table.table_index);
+        const auto& basic_table = *table.basic_table;
 
         for (size_t i = 0; i < table.size(); ++i) {
-            table_polynomials[0].at(offset) = table.column_1[i];
-            table_polynomials[1].at(offset) = table.column_2[i];
-            table_polynomials[2].at(offset) = table.column_3[i];
+            table_polynomials[0].at(offset) = basic_table.column_1[i];
+            table_polynomials[1].at(offset) = basic_table.column_2[i];
+            table_polynomials[2].at(offset) = basic_table.column_3[i];
             table_polynomials[3].at(offset) = table_index;
             ++offset;
         }
@@ -58,14 +59,15 @@ void construct_lookup_read_counts(typename Flavor::Polynomial& read_counts,
 
     // loop over all tables used in the circuit; each table contains data about the lookups made on it
     for (auto& table : circuit.lookup_tables) {
-        table.initialize_index_map();
+        // the index map of a shared table is initialized when the table is created
+        const auto& basic_table = *table.basic_table;
 
         for (auto& gate_data : table.lookup_gates) {
             // convert lookup gate data to an array of three field elements, one for each of the 3 columns
-            auto table_entry = gate_data.to_table_components(table.use_twin_keys);
+            auto table_entry = gate_data.to_table_components(basic_table.use_twin_keys);
 
             // find the index of the entry in the table
-            auto index_in_table = table.index_map[table_entry];
+            auto index_in_table = basic_table.index_map[table_entry];
 
             // increment the read count at the corresponding index in the full polynomial
             size_t index_in_poly = table_offset + index_in_table;
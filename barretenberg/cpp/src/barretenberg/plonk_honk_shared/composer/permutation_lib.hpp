@@ -9,6 +9,7 @@
 
 #include "barretenberg/common/ref_span.hpp"
 #include "barretenberg/common/ref_vector.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
@@ -18,6 +19,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <initializer_list>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -82,7 +84,22 @@ template <size_t NUM_WIRES, bool generalized> struct PermutationMapping {
     }
 };
 
-using CyclicPermutation = std::vector<cycle_node>;
+/**
+ * @brief The copy cycles of a circuit, i.e. for each (real) variable the addresses of the wire cells holding it, in the
+ * order of the execution trace
+ * @details The cycles are stored back to back, the cycle of variable i being nodes[offsets[i], offsets[i + 1]), rather
+ * than in a vector per variable, which costs an allocation per variable of the circuit.
+ */
+struct CopyCycles {
+    std::vector<uint32_t> offsets;
+    std::vector<cycle_node> nodes;
+
+    size_t size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+    std::span<const cycle_node> operator[](size_t idx) const
+    {
+        return { nodes.data() + offsets[idx], nodes.data() + offsets[idx + 1] };
+    }
+};
 
 namespace {
 /**
@@ -101,7 +118,7 @@ template <typename Flavor, bool generalized>
 PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     const typename Flavor::CircuitBuilder& circuit_constructor,
     typename Flavor::ProvingKey* proving_key,
-    const std::vector<CyclicPermutation>& wire_copy_cycles)
+    const CopyCycles& wire_copy_cycles)
 {
 
     // Initialize the table of permutations so that every element points to itself
@@ -110,44 +127,45 @@ PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     // Represents the index of a variable in circuit_constructor.variables (needed only for generalized)
     std::span<const uint32_t> real_variable_tags = circuit_constructor.real_variable_tags;
 
-    // Go through each cycle
-    size_t cycle_index = 0;
-    for (const auto& copy_cycle : wire_copy_cycles) {
-        for (size_t node_idx = 0; node_idx < copy_cycle.size(); ++node_idx) {
-            // Get the indices of the current node and next node in the cycle
-            const cycle_node& current_cycle_node = copy_cycle[node_idx];
-            // If current node is the last one in the cycle, then the next one is the first one
-            size_t next_cycle_node_index = (node_idx == copy_cycle.size() - 1 ? 0 : node_idx + 1);
-            const cycle_node& next_cycle_node = copy_cycle[next_cycle_node_index];
-            const auto current_row = current_cycle_node.gate_index;
-            const auto next_row = next_cycle_node.gate_index;
-
-            const auto current_column = current_cycle_node.wire_index;
-            const auto next_column = static_cast<uint8_t>(next_cycle_node.wire_index);
-            // Point current node to the next node
-            mapping.sigmas[current_column][current_row] = {
-                .row_index = next_row, .column_index = next_column, .is_public_input = false, .is_tag = false
-            };
+    // Go through each cycle. Every wire cell belongs to exactly one cycle, so the cycles are processed concurrently.
+    parallel_for_range(wire_copy_cycles.size(), [&](size_t start, size_t end) {
+        for (size_t cycle_index = start; cycle_index < end; ++cycle_index) {
+            const std::span<const cycle_node> copy_cycle = wire_copy_cycles[cycle_index];
+            for (size_t node_idx = 0; node_idx < copy_cycle.size(); ++node_idx) {
+                // Get the indices of the current node and next node in the cycle
+                const cycle_node& current_cycle_node = copy_cycle[node_idx];
+                // If current node is the last one in the cycle, then the next one is the first one
+                size_t next_cycle_node_index = (node_idx == copy_cycle.size() - 1 ? 0 : node_idx + 1);
+                const cycle_node& next_cycle_node = copy_cycle[next_cycle_node_index];
+                const auto current_row = current_cycle_node.gate_index;
+                const auto next_row = next_cycle_node.gate_index;
+
+                const auto current_column = current_cycle_node.wire_index;
+                const auto next_column = static_cast<uint8_t>(next_cycle_node.wire_index);
+                // Point current node to the next node
+                mapping.sigmas[current_column][current_row] = {
+                    .row_index = next_row, .column_index = next_column, .is_public_input = false, .is_tag = false
+                };
 
-            if constexpr (generalized) {
-                bool first_node = (node_idx == 0);
-                bool last_node = (next_cycle_node_index == 0);
-
-                if (first_node) {
-                    mapping.ids[current_column][current_row].is_tag = true;
-                    mapping.ids[current_column][current_row].row_index = (real_variable_tags[cycle_index]);
-                }
-                if (last_node) {
-                    mapping.sigmas[current_column][current_row].is_tag = true;
-
-                    // TODO(Zac): yikes, std::maps (tau) are expensive. Can we find a way to get rid of this?
-                    mapping.sigmas[current_column][current_row].row_index =
-                        circuit_constructor.tau.at(real_variable_tags[cycle_index]);
+                if constexpr (generalized) {
+                    bool first_node = (node_idx == 0);
+                    bool last_node = (next_cycle_node_index == 0);
+
+                    if (first_node) {
+                        mapping.ids[current_column][current_row].is_tag = true;
+                        mapping.ids[current_column][current_row].row_index = (real_variable_tags[cycle_index]);
+                    }
+                    if (last_node) {
+                        mapping.sigmas[current_column][current_row].is_tag = true;
+
+                        // TODO(Zac): yikes, std::maps (tau) are expensive. Can we find a way to get rid of this?
+                        mapping.sigmas[current_column][current_row].row_index =
+                            circuit_constructor.tau.at(real_variable_tags[cycle_index]);
+                    }
                 }
             }
         }
-        cycle_index++;
-    }
+    });
 
     // Add information about public inputs so that the cycles can be altered later; See the construction of the
     // permutation polynomials for details.
@@ -372,7 +390,7 @@ inline std::tuple<LegacyPolynomial<FF>, LegacyPolynomial<FF>> compute_first_and_
 template <typename Flavor>
 void compute_permutation_argument_polynomials(const typename Flavor::CircuitBuilder& circuit,
                                               typename Flavor::ProvingKey* key,
-                                              const std::vector<CyclicPermutation>& copy_cycles)
+                                              const CopyCycles& copy_cycles)
 {
     constexpr bool generalized = IsUltraPlonkFlavor<Flavor> || IsUltraFlavor<Flavor>;
     auto mapping = compute_permutation_mapping<Flavor, generalized>(circuit, key, copy_cycles);
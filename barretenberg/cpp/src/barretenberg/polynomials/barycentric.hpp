@@ -19,7 +19,6 @@
 namespace bb {
 
 /**
- * @todo: TODO(https://github.com/AztecProtocol/barretenberg/issues/713) Optimize with lookup tables?
  * @tparam domain_end, domain_start specify the given evaluation domain {domain_start,..., domain_end - 1}
  * @tparam num_evals the number of evaluations that are computable with specific barycentric extension formula
  */
@@ -120,11 +119,28 @@ template <class Fr, size_t domain_end, size_t num_evals, size_t domain_start = 0
         return result;
     }
 
+    // for each x_k outside of the domain, the Lagrange coefficients L_j(x_k) = M(x_k) / (d_j*(x_k - x_j)), so that
+    // extending a univariate to x_k is the dot product of its evaluations with a fixed row of this table
+    static constexpr std::array<Fr, domain_size * num_evals> construct_extension_coefficients(
+        const auto& precomputed_denominator_inverses, const auto& full_numerator_values)
+    {
+        std::array<Fr, domain_size * num_evals> result{};
+        for (size_t k = domain_size; k < num_evals; ++k) {
+            for (size_t j = 0; j < domain_size; ++j) {
+                result[k * domain_size + j] = precomputed_denominator_inverses[k * domain_size + j];
+                result[k * domain_size + j] *= full_numerator_values[k];
+            }
+        }
+        return result;
+    }
+
     static constexpr auto big_domain = construct_big_domain();
     static constexpr auto lagrange_denominators = construct_lagrange_denominators(big_domain);
     static constexpr auto precomputed_denominator_inverses =
         construct_denominator_inverses(big_domain, lagrange_denominators);
     static constexpr auto full_numerator_values = construct_full_numerator_values(big_domain);
+    static constexpr auto extension_coefficients =
+        construct_extension_coefficients(precomputed_denominator_inverses, full_numerator_values);
 };
 
 template <class Fr, size_t domain_end, size_t num_evals, size_t domain_start = 0> class BarycentricDataRunTime {
@@ -222,11 +238,28 @@ template <class Fr, size_t domain_end, size_t num_evals, size_t domain_start = 0
         return result;
     }
 
+    // for each x_k outside of the domain, the Lagrange coefficients L_j(x_k) = M(x_k) / (d_j*(x_k - x_j)), so that
+    // extending a univariate to x_k is the dot product of its evaluations with a fixed row of this table
+    static std::array<Fr, domain_size * num_evals> construct_extension_coefficients(
+        const auto& precomputed_denominator_inverses, const auto& full_numerator_values)
+    {
+        std::array<Fr, domain_size * num_evals> result{};
+        for (size_t k = domain_size; k < num_evals; ++k) {
+            for (size_t j = 0; j < domain_size; ++j) {
+                result[k * domain_size + j] = precomputed_denominator_inverses[k * domain_size + j];
+                result[k * domain_size + j] *= full_numerator_values[k];
+            }
+        }
+        return result;
+    }
+
     inline static const auto big_domain = construct_big_domain();
     inline static const auto lagrange_denominators = construct_lagrange_denominators(big_domain);
     inline static const auto precomputed_denominator_inverses =
         construct_denominator_inverses(big_domain, lagrange_denominators);
     inline static const auto full_numerator_values = construct_full_numerator_values(big_domain);
+    inline static const auto extension_coefficients =
+        construct_extension_coefficients(precomputed_denominator_inverses, full_numerator_values);
 };
 
 /**
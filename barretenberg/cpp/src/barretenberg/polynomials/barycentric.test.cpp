@@ -48,6 +48,20 @@ TYPED_TEST(BarycentricDataTests, SelfExtend)
     EXPECT_EQ(f, expected_result);
 }
 
+TYPED_TEST(BarycentricDataTests, SelfExtendHigherDegree)
+{
+    BARYCENTIC_DATA_TESTS_TYPE_ALIASES
+    static constexpr size_t initial_size(4);
+    static constexpr size_t domain_size(10);
+    auto initial = Univariate<FF, initial_size>::get_random();
+    auto f = Univariate<FF, domain_size>::zero();
+    for (size_t idx = 0; idx < initial_size; idx++) {
+        f.value_at(idx) = initial.value_at(idx);
+    }
+    f.template self_extend_from<initial_size>();
+    EXPECT_EQ(f, initial.template extend_to<domain_size>());
+}
+
 TYPED_TEST(BarycentricDataTests, Evaluate)
 {
     BARYCENTIC_DATA_TESTS_TYPE_ALIASES
@@ -256,6 +256,33 @@ void fft_bench_parallel(State& state) noexcept
 }
 BENCHMARK(fft_bench_parallel)->RangeMultiplier(2)->Range(START * 4, MAX_GATES * 4)->Unit(benchmark::kMicrosecond);
 
+constexpr size_t NUM_BATCHED_POLYS = 4;
+
+/**
+ * @brief Coset FFT of NUM_BATCHED_POLYS polynomials, one call at a time (0) or in a single batched call (1)
+ */
+void coset_fft_batch_bench_parallel(State& state) noexcept
+{
+    const auto num_gates = static_cast<size_t>(state.range(0));
+    const size_t idx = (size_t)numeric::get_msb((uint64_t)num_gates) - (size_t)numeric::get_msb(START);
+    std::vector<fr*> polys;
+    for (size_t i = 0; i < NUM_BATCHED_POLYS; ++i) {
+        polys.push_back(&globals.data[i * num_gates]);
+    }
+    for (auto _ : state) {
+        if (state.range(1) == 0) {
+            for (auto* poly : polys) {
+                bb::polynomial_arithmetic::coset_fft(poly, evaluation_domains[idx]);
+            }
+        } else {
+            bb::polynomial_arithmetic::coset_fft_batch(polys, evaluation_domains[idx]);
+        }
+    }
+}
+BENCHMARK(coset_fft_batch_bench_parallel)
+    ->ArgsProduct({ benchmark::CreateRange(START * 4, MAX_GATES * 4, 2), { 0, 1 } })
+    ->Unit(benchmark::kMicrosecond);
+
 void fft_bench_serial(State& state) noexcept
 {
     for (auto _ : state) {
@@ -7,6 +7,7 @@
 #include "barretenberg/polynomials/shared_shifted_virtual_zeroes_array.hpp"
 #include "polynomial_arithmetic.hpp"
 #include <cstddef>
+#include <cstdlib>
 #include <fcntl.h>
 #include <list>
 #include <memory>
@@ -39,6 +40,41 @@ SharedShiftedVirtualZeroesArray<Fr> _clone(const SharedShiftedVirtualZeroesArray
     return { array.start_ - left_expansion, array.end_ + right_expansion, array.virtual_size_, backing_clone };
 }
 
+/**
+ * @brief Get read-only memory holding at least the given number of zeroes, shared by all polynomials constructed with
+ * AllocateOnWrite.
+ * @details The memory comes from calloc, so that untouched pages of large allocations are only ever mapped to the
+ * zero page when read and do not add to the resident memory. A request for more zeroes than currently available
+ * replaces the buffer for subsequent requests, polynomials already using the previous one keep it alive.
+ */
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+template <typename Fr> std::shared_ptr<Fr[]> _get_shared_zeroes(size_t n_elements)
+{
+#ifndef NO_MULTITHREADING
+    static std::mutex zeroes_mutex;
+    std::unique_lock<std::mutex> lock(zeroes_mutex);
+#endif
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    static std::shared_ptr<Fr[]> zeroes;
+    static size_t num_zeroes = 0;
+    if (n_elements > num_zeroes || !zeroes) {
+        num_zeroes = std::max<size_t>(n_elements, 1);
+        // Over-allocate to be able to align the zeroes like any other polynomial memory
+        constexpr size_t alignment = 64;
+        size_t space = sizeof(Fr) * num_zeroes + alignment;
+        void* allocation = std::calloc(space, 1);
+        if (allocation == nullptr) {
+            info("bad alloc of size: ", space);
+            std::abort();
+        }
+        void* aligned = allocation;
+        std::align(alignment, sizeof(Fr) * num_zeroes, aligned, space);
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+        zeroes = std::shared_ptr<Fr[]>(std::shared_ptr<void>(allocation, std::free), static_cast<Fr*>(aligned));
+    }
+    return zeroes;
+}
+
 template <typename Fr>
 void Polynomial<Fr>::allocate_backing_memory(size_t size, size_t virtual_size, size_t start_index)
 {
@@ -79,6 +115,24 @@ Polynomial<Fr>::Polynomial(size_t size, size_t virtual_size, size_t start_index,
     allocate_backing_memory(size, virtual_size, start_index);
 }
 
+/**
+ * @brief Initialize a zero Polynomial to size 'size' without allocating memory until it is first written.
+ *
+ * @param size The size of the polynomial.
+ * @param flag Signals that the memory is allocated on the first write.
+ */
+template <typename Fr>
+Polynomial<Fr>::Polynomial(size_t size,
+                           size_t virtual_size,
+                           size_t start_index,
+                           [[maybe_unused]] AllocateOnWrite flag)
+{
+    ASSERT(start_index + size <= virtual_size);
+    coefficients_ = SharedShiftedVirtualZeroesArray<Fr>{
+        start_index, size + start_index, virtual_size, _get_shared_zeroes<Fr>(size), /* copy on write */ true
+    };
+}
+
 template <typename Fr>
 Polynomial<Fr>::Polynomial(const Polynomial<Fr>& other)
     : Polynomial<Fr>(other, other.size())
@@ -88,6 +142,11 @@ Polynomial<Fr>::Polynomial(const Polynomial<Fr>& other)
 template <typename Fr> Polynomial<Fr>::Polynomial(const Polynomial<Fr>& other, const size_t target_size)
 {
     ASSERT(other.size() <= target_size);
+    // A copy-on-write polynomial does not own its memory, so neither does its copy until it is written
+    if (other.is_copy_on_write() && target_size == other.size()) {
+        coefficients_ = other.coefficients_;
+        return;
+    }
     coefficients_ = _clone(other.coefficients_, target_size - other.size());
 }
 
@@ -119,17 +178,34 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator=(const Polynomia
     if (this == &other) {
         return *this;
     }
-    coefficients_ = _clone(other.coefficients_);
+    coefficients_ = other.is_copy_on_write() ? other.coefficients_ : _clone(other.coefficients_);
     return *this;
 }
 
 template <typename Fr> Polynomial<Fr> Polynomial<Fr>::share() const
+{
+    ASSERT(!coefficients_.copy_on_write_);
+    Polynomial p;
+    p.coefficients_ = coefficients_;
+    return p;
+}
+
+template <typename Fr> Polynomial<Fr> Polynomial<Fr>::copy_on_write() const
 {
     Polynomial p;
     p.coefficients_ = coefficients_;
+    p.coefficients_.copy_on_write_ = true;
     return p;
 }
 
+template <typename Fr> void Polynomial<Fr>::detach()
+{
+    ASSERT(coefficients_.copy_on_write_);
+    // Other threads of the parallel_for may hold references into the memory being replaced
+    ASSERT(!is_in_parallel_for());
+    coefficients_ = _clone(coefficients_);
+}
+
 template <typename Fr> bool Polynomial<Fr>::operator==(Polynomial const& rhs) const
 {
     // If either is empty, both must be
@@ -153,6 +229,7 @@ template <typename Fr> bool Polynomial<Fr>::operator==(Polynomial const& rhs) co
 
 template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator+=(PolynomialSpan<const Fr> other)
 {
+    materialize(); // before writing concurrently
     ASSERT(start_index() <= other.start_index);
     ASSERT(end_index() >= other.end_index());
     size_t num_threads = calculate_num_threads(other.size());
@@ -242,6 +319,7 @@ Fr Polynomial<Fr>::compute_barycentric_evaluation(const Fr& z, const EvaluationD
 
 template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator-=(PolynomialSpan<const Fr> other)
 {
+    materialize(); // before writing concurrently
     ASSERT(start_index() <= other.start_index);
     ASSERT(end_index() >= other.end_index());
     const size_t num_threads = calculate_num_threads(other.size());
@@ -259,6 +337,7 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator-=(PolynomialSpan
 
 template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator*=(const Fr scaling_factor)
 {
+    materialize(); // before writing concurrently
     const size_t num_threads = calculate_num_threads(size());
     const size_t range_per_thread = size() / num_threads;
     const size_t leftovers = size() - (range_per_thread * num_threads);
@@ -300,6 +379,7 @@ template <typename Fr> Polynomial<Fr> Polynomial<Fr>::full() const
 
 template <typename Fr> void Polynomial<Fr>::add_scaled(PolynomialSpan<const Fr> other, Fr scaling_factor) &
 {
+    materialize(); // before writing concurrently
     ASSERT(start_index() <= other.start_index);
     ASSERT(end_index() >= other.end_index());
     const size_t num_threads = calculate_num_threads(other.size());
@@ -64,6 +64,7 @@ template <typename Fr> class Polynomial {
   public:
     using FF = Fr;
     enum class DontZeroMemory { FLAG };
+    enum class AllocateOnWrite { FLAG };
 
     Polynomial(size_t size, size_t virtual_size, size_t start_index = 0);
     // Intended just for plonk, where size == virtual_size always
@@ -80,6 +81,9 @@ template <typename Fr> class Polynomial {
     Polynomial(size_t size, DontZeroMemory flag)
         : Polynomial(size, size, flag)
     {}
+    // Constructor of a zero polynomial backed by shared zeroes, that only allocates its memory when first written. Use
+    // for polynomials that are often never written, e.g. the databus columns of a circuit without databus.
+    Polynomial(size_t size, size_t virtual_size, size_t start_index, AllocateOnWrite flag);
     Polynomial(const Polynomial& other);
     Polynomial(const Polynomial& other, size_t target_size);
 
@@ -120,9 +124,36 @@ template <typename Fr> class Polynomial {
 
     /**
      * Return a shallow clone of the polynomial. i.e. underlying memory is shared.
+     * @note The polynomial must not be copy-on-write, since a write through either handle would then allocate memory
+     * of its own and no longer be seen by the other. Materialize it first, or use copy_on_write() for a read-only view.
      */
     Polynomial share() const;
 
+    /**
+     * @brief Return a shallow clone of the polynomial that allocates its own copy of the coefficients when first
+     * written, i.e. a cheap copy as long as it is only read.
+     * @note Unlike for a full copy, writes to this polynomial remain visible in the clone until the clone is written.
+     */
+    Polynomial copy_on_write() const;
+
+    /**
+     * @brief Whether the polynomial does not own its memory yet, i.e. was created by copy_on_write() or with
+     * AllocateOnWrite and has not been written since.
+     */
+    bool is_copy_on_write() const { return coefficients_.copy_on_write_; }
+
+    /**
+     * @brief Allocate the memory of a copy-on-write polynomial, a no-op for any other polynomial.
+     * @details Mutable accessors do this implicitly, but not in a thread-safe way: a copy-on-write polynomial must be
+     * materialized before it is written concurrently, and materializing it within a parallel_for is an error.
+     */
+    void materialize()
+    {
+        if (coefficients_.copy_on_write_) {
+            detach();
+        }
+    }
+
     void clear() { coefficients_ = SharedShiftedVirtualZeroesArray<Fr>{}; }
 
     /**
@@ -161,6 +192,7 @@ template <typename Fr> class Polynomial {
      *
      * @details If the n coefficients of self are (0, a₁, …, aₙ₋₁),
      * we returns the view of the n-1 coefficients (a₁, …, aₙ₋₁).
+     * The shift of a copy-on-write polynomial is itself copy-on-write.
      */
     Polynomial shifted() const;
 
@@ -252,7 +284,11 @@ template <typename Fr> class Polynomial {
     std::size_t size() const { return coefficients_.size(); }
     std::size_t virtual_size() const { return coefficients_.virtual_size(); }
 
-    Fr* data() { return coefficients_.data(); }
+    Fr* data()
+    {
+        materialize();
+        return coefficients_.data();
+    }
     const Fr* data() const { return coefficients_.data(); }
 
     /**
@@ -263,7 +299,11 @@ template <typename Fr> class Polynomial {
      * @param index the index, to be subtracted by start_index() and read into the array memory
      * @return Fr& a mutable reference.
      */
-    Fr& at(size_t index) { return coefficients_[index]; }
+    Fr& at(size_t index)
+    {
+        materialize();
+        return coefficients_[index];
+    }
     const Fr& at(size_t index) const { return coefficients_[index]; }
 
     const Fr& operator[](size_t i) { return get(i); }
@@ -378,6 +418,9 @@ template <typename Fr> class Polynomial {
     // DOES NOT initialize memory
     void allocate_backing_memory(size_t size, size_t virtual_size, size_t start_index);
 
+    // replace borrowed backing memory with a copy of our own
+    void detach();
+
     // safety check for in place operations
     bool in_place_operation_viable(size_t domain_size) { return (size() >= domain_size); }
 
@@ -1,6 +1,8 @@
 #include <cstddef>
 #include <gtest/gtest.h>
+#include <utility>
 
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 
 // Simple test/demonstration of shifted functionality
@@ -57,6 +59,75 @@ TEST(Polynomial, Share)
     EXPECT_NE(poly_clone, poly);
 }
 
+// Polynomials constructed with AllocateOnWrite share zeroes until written
+TEST(Polynomial, AllocateOnWrite)
+{
+    using FF = bb::fr;
+    using Polynomial = bb::Polynomial<FF>;
+    const size_t SIZE = 10;
+    Polynomial poly(SIZE - 1, SIZE, /*start_index*/ 1, Polynomial::AllocateOnWrite::FLAG);
+    Polynomial other(SIZE - 1, SIZE, /*start_index*/ 1, Polynomial::AllocateOnWrite::FLAG);
+    EXPECT_TRUE(poly.is_copy_on_write());
+    EXPECT_EQ(poly.start_index(), 1);
+    EXPECT_EQ(poly.end_index(), SIZE);
+    EXPECT_TRUE(poly.is_zero());
+    EXPECT_EQ(poly, Polynomial(SIZE - 1, SIZE, /*start_index*/ 1));
+
+    // Copies and shifts of an unwritten polynomial do not allocate either
+    Polynomial copy = poly;
+    auto poly_shifted = poly.shifted();
+    EXPECT_TRUE(copy.is_copy_on_write());
+    EXPECT_TRUE(poly_shifted.is_copy_on_write());
+    EXPECT_EQ(std::as_const(copy).data(), std::as_const(poly).data());
+
+    // Writing allocates memory of our own, leaving every other polynomial zero
+    poly.at(3) = 25;
+    EXPECT_FALSE(poly.is_copy_on_write());
+    EXPECT_EQ(poly[3], 25);
+    EXPECT_TRUE(other.is_zero());
+    EXPECT_TRUE(copy.is_zero());
+    EXPECT_TRUE(poly_shifted.is_zero());
+
+    // Polynomial operations materialize the polynomial before writing it
+    other += poly;
+    EXPECT_FALSE(other.is_copy_on_write());
+    EXPECT_EQ(other, poly);
+    EXPECT_TRUE(copy.is_zero());
+}
+
+// A copy-on-write clone reads the memory of the original until it is written
+TEST(Polynomial, CopyOnWrite)
+{
+    using FF = bb::fr;
+    using Polynomial = bb::Polynomial<FF>;
+    const size_t SIZE = 10;
+    auto poly = Polynomial::random(SIZE - 1, SIZE, /*start_index*/ 1);
+
+    auto poly_clone = poly.copy_on_write();
+    auto poly_shifted = poly.shifted().copy_on_write();
+    EXPECT_TRUE(poly_clone.is_copy_on_write());
+    EXPECT_FALSE(poly.is_copy_on_write());
+    EXPECT_EQ(poly_clone, poly);
+    EXPECT_EQ(std::as_const(poly_clone).data(), std::as_const(poly).data());
+
+    // Writing the clone does not change the original
+    const Polynomial original = poly;
+    poly_clone.at(2) = 13;
+    poly_shifted.at(4) = 7;
+    EXPECT_FALSE(poly_clone.is_copy_on_write());
+    EXPECT_EQ(poly_clone[2], 13);
+    EXPECT_EQ(poly_shifted[4], 7);
+    EXPECT_EQ(poly, original);
+    for (size_t i = 0; i < SIZE - 1; ++i) {
+        if (i != 2) {
+            EXPECT_EQ(poly_clone[i], poly[i]);
+        }
+        if (i != 4) {
+            EXPECT_EQ(poly_shifted[i], poly[i + 1]);
+        }
+    }
+}
+
 // Simple test/demonstration of various edge conditions
 TEST(Polynomial, Indices)
 {
@@ -202,4 +273,24 @@ TEST(Polynomial, Expand)
     ASSERT_DEATH(test_subset_bad3(), ".*new_end_index.*end_index.*");
 }
 
+TEST(Polynomial, CopyOnWriteEdgeConditions)
+{
+    // Suppress warnings about fork(), we're OK with the edge cases.
+    GTEST_FLAG_SET(death_test_style, "threadsafe");
+    using FF = bb::fr;
+    using Polynomial = bb::Polynomial<FF>;
+    auto test_share = []() {
+        // Writes through a share of a copy-on-write polynomial would not be seen by the original
+        Polynomial poly(4, 4, /*start_index*/ 0, Polynomial::AllocateOnWrite::FLAG);
+        auto shared = poly.share();
+    };
+    ASSERT_DEATH(test_share(), ".*copy_on_write_.*");
+    auto test_materialize_in_parallel_for = []() {
+        // Materializing within a parallel_for would replace memory that other iterations may be writing
+        Polynomial poly(4, 4, /*start_index*/ 0, Polynomial::AllocateOnWrite::FLAG);
+        bb::parallel_for(1, [&](size_t) { poly.at(0) = 1; });
+    };
+    ASSERT_DEATH(test_materialize_in_parallel_for(), ".*is_in_parallel_for.*");
+}
+
 #endif
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "iterate_over_domain.hpp"
+#include <array>
 #include <math.h>
 #include <memory.h>
 #include <memory>
@@ -168,6 +169,157 @@ void compute_multiplicative_subgroup(const size_t log2_subgroup_size,
     }
 }
 
+namespace {
+
+// Blocks of 2^FFT_LOG2_BLOCK_SIZE coefficients (128KiB for a 254-bit field) go through the early butterfly layers
+// while they are in L2
+constexpr size_t FFT_LOG2_BLOCK_SIZE = 12;
+// The number of later butterfly layers applied per pass over memory, i.e. the radix of the later passes is 2^3 = 8
+constexpr size_t FFT_MAX_LAYERS_PER_PASS = 3;
+
+/**
+ * @brief Cache-blocked radix-2 decimation in time FFT of num_polys independent polynomials of size 2^log2_size
+ *
+ * @details Computes exactly the butterflies of the iterative algorithm (so the output is bit-identical to it), but
+ * schedules them to make few passes over memory instead of one pass per layer:
+ *
+ *  1. A block of consecutive coefficients (after bit reversal) only depends on itself in the layers whose butterflies
+ *     are shorter than the block, so each block is gathered (fused with the first layer, as the butterflies of size 2
+ *     are) and goes through all these layers while it is in cache.
+ *  2. The coefficients {base + j + t⋅m : t < 2^r} are closed under the r layers of half-sizes m, 2m, ..., 2^{r-1}m, so
+ *     the remaining layers are applied FFT_MAX_LAYERS_PER_PASS at a time as radix-2^r butterflies: each group of 2^r
+ *     coefficients is loaded once, goes through r layers and is stored once.
+ *
+ * Each step is a single parallel loop over all the blocks or groups of all the polynomials. The final layer writes to
+ * the output rather than to working memory.
+ *
+ * @param data data[p] is working memory for the 2^log2_size coefficients of polynomial p
+ * @param input input(p, i) is the coefficient of polynomial p that goes to position i, i.e. the input coefficient at
+ * the bit reversal of i
+ * @param output output(p, i) is a reference to where evaluation i of polynomial p is written. It may alias data[p][i]
+ * but not the input of other positions
+ */
+template <typename Fr, typename Input, typename Output>
+void fft_blocked(const std::vector<Fr*>& data,
+                 const Input& input,
+                 const Output& output,
+                 const size_t log2_size,
+                 const std::vector<Fr*>& root_table)
+{
+    const size_t num_polys = data.size();
+    const size_t size = 1UL << log2_size;
+    if (log2_size == 0) {
+        for (size_t p = 0; p < num_polys; ++p) {
+            output(p, 0) = input(p, 0);
+        }
+        return;
+    }
+
+    // Smaller blocks if there would otherwise be fewer blocks than threads
+    const auto log2_num_polys = static_cast<size_t>(numeric::get_msb(num_polys));
+    const auto log2_num_cpus = static_cast<size_t>(numeric::get_msb(get_num_cpus_pow2()));
+    size_t log2_block_size = std::min(log2_size, FFT_LOG2_BLOCK_SIZE);
+    if (log2_size + log2_num_polys > log2_num_cpus) {
+        log2_block_size = std::min(log2_block_size, std::max(log2_size + log2_num_polys - log2_num_cpus, size_t(1)));
+    } else {
+        log2_block_size = 1;
+    }
+    const size_t block_size = 1UL << log2_block_size;
+    const size_t blocks_per_poly = size >> log2_block_size;
+
+    // Step 1: the layers of half-size less than the block size
+    parallel_for(num_polys * blocks_per_poly, [&](size_t block_index) {
+        const size_t p = block_index / blocks_per_poly;
+        const size_t block_start = (block_index % blocks_per_poly) << log2_block_size;
+        Fr* block = data[p] + block_start;
+        const bool is_last_block_layer_final = block_size == size;
+        if (block_size == 2 && is_last_block_layer_final) {
+            const Fr temp_1 = input(p, 0);
+            const Fr temp_2 = input(p, 1);
+            output(p, 1) = temp_1 - temp_2;
+            output(p, 0) = temp_1 + temp_2;
+            return;
+        }
+        for (size_t i = 0; i < block_size; i += 2) {
+            Fr temp_1;
+            Fr temp_2;
+            Fr::__copy(input(p, block_start + i), temp_1);
+            Fr::__copy(input(p, block_start + i + 1), temp_2);
+            block[i + 1] = temp_1 - temp_2;
+            block[i] = temp_1 + temp_2;
+        }
+        for (size_t m = 2; m < block_size; m <<= 1) {
+            const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
+            const bool is_final = is_last_block_layer_final && (m << 1) == block_size;
+            for (size_t k = 0; k < block_size; k += 2 * m) {
+                for (size_t j = 0; j < m; ++j) {
+                    const Fr temp = round_roots[j] * block[k + j + m];
+                    if (is_final) {
+                        // There is a single block
+                        output(p, k + j + m) = block[k + j] - temp;
+                        output(p, k + j) = block[k + j] + temp;
+                    } else {
+                        block[k + j + m] = block[k + j] - temp;
+                        block[k + j] += temp;
+                    }
+                }
+            }
+        }
+    });
+
+    // Step 2: the remaining layers, in passes of up to FFT_MAX_LAYERS_PER_PASS layers
+    for (size_t log2_m = log2_block_size; log2_m < log2_size;) {
+        const size_t num_layers = std::min(FFT_MAX_LAYERS_PER_PASS, log2_size - log2_m);
+        const size_t m = 1UL << log2_m;
+        const size_t group_size = 1UL << num_layers;
+        const size_t log2_groups_per_poly = log2_size - num_layers;
+        const bool is_final_pass = log2_m + num_layers == log2_size;
+        parallel_for_heuristic(
+            num_polys << log2_groups_per_poly,
+            [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+                std::array<Fr, 1UL << FFT_MAX_LAYERS_PER_PASS> x;
+                for (size_t g = start; g < end; ++g) {
+                    const size_t p = g >> log2_groups_per_poly;
+                    const size_t group = g & ((1UL << log2_groups_per_poly) - 1);
+                    const size_t j = group & (m - 1);
+                    const size_t base = ((group >> log2_m) << (log2_m + num_layers)) + j;
+                    Fr* poly_data = data[p];
+                    for (size_t t = 0; t < group_size; ++t) {
+                        Fr::__copy(poly_data[base + t * m], x[t]);
+                    }
+                    for (size_t layer = 0; layer < num_layers; ++layer) {
+                        const Fr* round_roots = root_table[log2_m + layer - 1];
+                        const size_t half = 1UL << layer;
+                        const bool is_final = is_final_pass && layer + 1 == num_layers;
+                        for (size_t t = 0; t < group_size; ++t) {
+                            if ((t & half) != 0) {
+                                continue;
+                            }
+                            const Fr temp = round_roots[j + (t & (half - 1)) * m] * x[t + half];
+                            if (is_final) {
+                                output(p, base + (t + half) * m) = x[t] - temp;
+                                output(p, base + t * m) = x[t] + temp;
+                            } else {
+                                x[t + half] = x[t] - temp;
+                                x[t] += temp;
+                            }
+                        }
+                    }
+                    if (!is_final_pass) {
+                        for (size_t t = 0; t < group_size; ++t) {
+                            Fr::__copy(x[t], poly_data[base + t * m]);
+                        }
+                    }
+                }
+            },
+            (thread_heuristics::FF_MULTIPLICATION_COST + thread_heuristics::FF_ADDITION_COST * 2) * num_layers *
+                group_size / 2);
+        log2_m += num_layers;
+    }
+}
+
+} // namespace
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void fft_inner_parallel(std::vector<Fr*> coeffs,
@@ -184,116 +336,18 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
     ASSERT(is_power_of_two(poly_size));
     const size_t poly_mask = poly_size - 1;
     const size_t log2_poly_size = (size_t)numeric::get_msb(poly_size);
-
-    parallel_for(domain.num_threads, [&](size_t j) {
-        Fr temp_1;
-        Fr temp_2;
-        for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); i += 2) {
-            uint32_t next_index_1 = (uint32_t)reverse_bits((uint32_t)i + 2, (uint32_t)domain.log2_size);
-            uint32_t next_index_2 = (uint32_t)reverse_bits((uint32_t)i + 3, (uint32_t)domain.log2_size);
-            __builtin_prefetch(&coeffs[next_index_1]);
-            __builtin_prefetch(&coeffs[next_index_2]);
-
-            uint32_t swap_index_1 = (uint32_t)reverse_bits((uint32_t)i, (uint32_t)domain.log2_size);
-            uint32_t swap_index_2 = (uint32_t)reverse_bits((uint32_t)i + 1, (uint32_t)domain.log2_size);
-
-            size_t poly_idx_1 = swap_index_1 >> log2_poly_size;
-            size_t elem_idx_1 = swap_index_1 & poly_mask;
-            size_t poly_idx_2 = swap_index_2 >> log2_poly_size;
-            size_t elem_idx_2 = swap_index_2 & poly_mask;
-
-            Fr::__copy(coeffs[poly_idx_1][elem_idx_1], temp_1);
-            Fr::__copy(coeffs[poly_idx_2][elem_idx_2], temp_2);
-            scratch_space[i + 1] = temp_1 - temp_2;
-            scratch_space[i] = temp_1 + temp_2;
-        }
-    });
-
-    // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
-    // reduce + copy
-    if (domain.size <= 2) {
-        coeffs[0][0] = scratch_space[0];
-        coeffs[0][1] = scratch_space[1];
-    }
-
-    // outer FFT loop
-    for (size_t m = 2; m < (domain.size); m <<= 1) {
-        parallel_for(domain.num_threads, [&](size_t j) {
-            Fr temp;
-
-            // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
-            // out into multiple independent threads. For `num_threads`, each thread will evaluation `domain.size /
-            // num_threads` of the polynomial. The actual iteration length will be half of this, because we leverage
-            // the fact that \omega^{n/2} = -\omega (where \omega is a root of unity)
-
-            // Here, `start` and `end` are used as our iterator limits, so that we can use our iterator `i` to
-            // directly access the roots of unity lookup table
-            const size_t start = j * (domain.thread_size >> 1);
-            const size_t end = (j + 1) * (domain.thread_size >> 1);
-
-            // For all but the last round of our FFT, the roots of unity that we need, will be a subset of our
-            // lookup table. e.g. for a size 2^n FFT, the 2^n'th roots create a multiplicative subgroup of order 2^n
-            //      the 1st round will use the roots from the multiplicative subgroup of order 2 : the 2'th roots of
-            //      unity the 2nd round will use the roots from the multiplicative subgroup of order 4 : the 4'th
-            //      roots of unity
-            // i.e. each successive FFT round will double the set of roots that we need to index.
-            // We have already laid out the `root_table` container so that each FFT round's roots are linearly
-            // ordered in memory. For all FFT rounds, the number of elements we're iterating over is greater than
-            // the size of our lookup table. We need to access this table in a cyclical fasion - i.e. for a subgroup
-            // of size x, the first x iterations will index the subgroup elements in order, then for the next x
-            // iterations, we loop back to the start.
-
-            // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the
-            // root table), but we want to flatten this out - as for the first few rounds, the inner loop will be
-            // tiny and we'll have quite a bit of unneccesary branch checks For each iteration of our flattened
-            // loop, indexed by `i`, the element of the root table we need to access will be `i % (current round
-            // subgroup size)` Given that each round subgroup size is `m`, which is a power of 2, we can index the
-            // root table with a very cheap `i & (m - 1)` Which is why we have this odd `block_mask` variable
-            const size_t block_mask = m - 1;
-
-            // The next problem to tackle, is we now need to efficiently index the polynomial element in
-            // `scratch_space` in our flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates
-            // from 0 to 'domain size', in steps of 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We
-            // have our inner loop indexer with `i & (m - 1)`. We need to add to this our outer loop indexer, which
-            // is equivalent to taking our indexer `i`, masking out the bits used in the 'inner loop', and doubling
-            // the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m - 1)) >> 1) To simplify this, we
-            // cache index_mask = ~block_mask, meaning that our indexer is just `((i & index_mask) << 1 + (i &
-            // block_mask)`
-            const size_t index_mask = ~block_mask;
-
-            // `round_roots` fetches the pointer to this round's lookup table. We use `numeric::get_msb(m) - 1` as
-            // our indexer, because we don't store the precomputed root values for the 1st round (because they're
-            // all 1).
-            const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
-
-            // Finally, we want to treat the final round differently from the others,
-            // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
-            // `scratch_space`
-            if (m != (domain.size >> 1)) {
-                for (size_t i = start; i < end; ++i) {
-                    size_t k1 = (i & index_mask) << 1;
-                    size_t j1 = i & block_mask;
-                    temp = round_roots[j1] * scratch_space[k1 + j1 + m];
-                    scratch_space[k1 + j1 + m] = scratch_space[k1 + j1] - temp;
-                    scratch_space[k1 + j1] += temp;
-                }
-            } else {
-                for (size_t i = start; i < end; ++i) {
-                    size_t k1 = (i & index_mask) << 1;
-                    size_t j1 = i & block_mask;
-
-                    size_t poly_idx_1 = (k1 + j1) >> log2_poly_size;
-                    size_t elem_idx_1 = (k1 + j1) & poly_mask;
-                    size_t poly_idx_2 = (k1 + j1 + m) >> log2_poly_size;
-                    size_t elem_idx_2 = (k1 + j1 + m) & poly_mask;
-
-                    temp = round_roots[j1] * scratch_space[k1 + j1 + m];
-                    coeffs[poly_idx_2][elem_idx_2] = scratch_space[k1 + j1] - temp;
-                    coeffs[poly_idx_1][elem_idx_1] = scratch_space[k1 + j1] + temp;
-                }
-            }
-        });
-    }
+    const auto log2_size = static_cast<uint32_t>(domain.log2_size);
+
+    // The coefficients are split across the polynomials of `coeffs`, which together are a single polynomial
+    fft_blocked(
+        { scratch_space },
+        [&](size_t, size_t i) -> const Fr& {
+            const uint32_t swap_index = reverse_bits(static_cast<uint32_t>(i), log2_size);
+            return coeffs[swap_index >> log2_poly_size][swap_index & poly_mask];
+        },
+        [&](size_t, size_t i) -> Fr& { return coeffs[i >> log2_poly_size][i & poly_mask]; },
+        domain.log2_size,
+        root_table);
 }
 
 template <typename Fr>
@@ -301,94 +355,40 @@ template <typename Fr>
 void fft_inner_parallel(
     Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain, const Fr&, const std::vector<Fr*>& root_table)
 {
-    parallel_for(domain.num_threads, [&](size_t j) {
-        Fr temp_1;
-        Fr temp_2;
-        for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); i += 2) {
-            uint32_t next_index_1 = (uint32_t)reverse_bits((uint32_t)i + 2, (uint32_t)domain.log2_size);
-            uint32_t next_index_2 = (uint32_t)reverse_bits((uint32_t)i + 3, (uint32_t)domain.log2_size);
-            __builtin_prefetch(&coeffs[next_index_1]);
-            __builtin_prefetch(&coeffs[next_index_2]);
-
-            uint32_t swap_index_1 = (uint32_t)reverse_bits((uint32_t)i, (uint32_t)domain.log2_size);
-            uint32_t swap_index_2 = (uint32_t)reverse_bits((uint32_t)i + 1, (uint32_t)domain.log2_size);
-
-            Fr::__copy(coeffs[swap_index_1], temp_1);
-            Fr::__copy(coeffs[swap_index_2], temp_2);
-            target[i + 1] = temp_1 - temp_2;
-            target[i] = temp_1 + temp_2;
-        }
-    });
+    const auto log2_size = static_cast<uint32_t>(domain.log2_size);
+    fft_blocked(
+        { target },
+        [&](size_t, size_t i) -> const Fr& { return coeffs[reverse_bits(static_cast<uint32_t>(i), log2_size)]; },
+        [&](size_t, size_t i) -> Fr& { return target[i]; },
+        domain.log2_size,
+        root_table);
+}
 
-    // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
-    // reduce + copy
-    if (domain.size <= 2) {
-        coeffs[0] = target[0];
-        coeffs[1] = target[1];
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner_parallel_batch(const std::vector<Fr*>& polys, const std::vector<Fr*>& root_table, const size_t log2_size)
+{
+    if (polys.empty()) {
+        return;
     }
-
-    // outer FFT loop
-    for (size_t m = 2; m < (domain.size); m <<= 1) {
-        parallel_for(domain.num_threads, [&](size_t j) {
-            Fr temp;
-
-            // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
-            // out into multiple independent threads. For `num_threads`, each thread will evaluation `domain.size /
-            // num_threads` of the polynomial. The actual iteration length will be half of this, because we leverage
-            // the fact that \omega^{n/2} = -\omega (where \omega is a root of unity)
-
-            // Here, `start` and `end` are used as our iterator limits, so that we can use our iterator `i` to
-            // directly access the roots of unity lookup table
-            const size_t start = j * (domain.thread_size >> 1);
-            const size_t end = (j + 1) * (domain.thread_size >> 1);
-
-            // For all but the last round of our FFT, the roots of unity that we need, will be a subset of our
-            // lookup table. e.g. for a size 2^n FFT, the 2^n'th roots create a multiplicative subgroup of order 2^n
-            //      the 1st round will use the roots from the multiplicative subgroup of order 2 : the 2'th roots of
-            //      unity the 2nd round will use the roots from the multiplicative subgroup of order 4 : the 4'th
-            //      roots of unity
-            // i.e. each successive FFT round will double the set of roots that we need to index.
-            // We have already laid out the `root_table` container so that each FFT round's roots are linearly
-            // ordered in memory. For all FFT rounds, the number of elements we're iterating over is greater than
-            // the size of our lookup table. We need to access this table in a cyclical fasion - i.e. for a subgroup
-            // of size x, the first x iterations will index the subgroup elements in order, then for the next x
-            // iterations, we loop back to the start.
-
-            // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the
-            // root table), but we want to flatten this out - as for the first few rounds, the inner loop will be
-            // tiny and we'll have quite a bit of unneccesary branch checks For each iteration of our flattened
-            // loop, indexed by `i`, the element of the root table we need to access will be `i % (current round
-            // subgroup size)` Given that each round subgroup size is `m`, which is a power of 2, we can index the
-            // root table with a very cheap `i & (m - 1)` Which is why we have this odd `block_mask` variable
-            const size_t block_mask = m - 1;
-
-            // The next problem to tackle, is we now need to efficiently index the polynomial element in
-            // `scratch_space` in our flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates
-            // from 0 to 'domain size', in steps of 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We
-            // have our inner loop indexer with `i & (m - 1)`. We need to add to this our outer loop indexer, which
-            // is equivalent to taking our indexer `i`, masking out the bits used in the 'inner loop', and doubling
-            // the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m - 1)) >> 1) To simplify this, we
-            // cache index_mask = ~block_mask, meaning that our indexer is just `((i & index_mask) << 1 + (i &
-            // block_mask)`
-            const size_t index_mask = ~block_mask;
-
-            // `round_roots` fetches the pointer to this round's lookup table. We use `numeric::get_msb(m) - 1` as
-            // our indexer, because we don't store the precomputed root values for the 1st round (because they're
-            // all 1).
-            const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
-
-            // Finally, we want to treat the final round differently from the others,
-            // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
-            // `scratch_space`
-            for (size_t i = start; i < end; ++i) {
-                size_t k1 = (i & index_mask) << 1;
-                size_t j1 = i & block_mask;
-                temp = round_roots[j1] * target[k1 + j1 + m];
-                target[k1 + j1 + m] = target[k1 + j1] - temp;
-                target[k1 + j1] += temp;
+    const size_t size = 1UL << log2_size;
+    // Bit reversal permutation in place, so that no working memory is needed for the batch
+    parallel_for_heuristic(
+        polys.size() * size,
+        [&](size_t k) {
+            const size_t i = k & (size - 1);
+            const size_t swap_index = reverse_bits(static_cast<uint32_t>(i), static_cast<uint32_t>(log2_size));
+            if (i < swap_index) {
+                Fr::__swap(polys[k >> log2_size][i], polys[k >> log2_size][swap_index]);
             }
-        });
-    }
+        },
+        thread_heuristics::FF_COPY_COST * 2);
+    fft_blocked(
+        polys,
+        [&](size_t p, size_t i) -> const Fr& { return polys[p][i]; },
+        [&](size_t p, size_t i) -> Fr& { return polys[p][i]; },
+        log2_size,
+        root_table);
 }
 
 template <typename Fr>
@@ -579,6 +579,34 @@ void ifft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain)
     ITERATE_OVER_DOMAIN_END;
 }
 
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain)
+{
+    fft_inner_parallel_batch(polys, domain.get_round_roots(), domain.log2_size);
+}
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void ifft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain)
+{
+    fft_inner_parallel_batch(polys, domain.get_inverse_round_roots(), domain.log2_size);
+    parallel_for_heuristic(
+        polys.size() * domain.size,
+        [&](size_t k) { polys[k >> domain.log2_size][k & (domain.size - 1)] *= domain.domain_inverse; },
+        thread_heuristics::FF_MULTIPLICATION_COST);
+}
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void coset_fft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain)
+{
+    for (Fr* poly : polys) {
+        scale_by_generator(poly, poly, domain, Fr::one(), domain.generator, domain.generator_size);
+    }
+    fft_batch(polys, domain);
+}
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void fft_with_constant(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr& value)
@@ -1445,6 +1473,9 @@ template void coset_fft_with_generator_shift<fr>(fr*, const EvaluationDomain<fr>
 template void ifft<fr>(fr*, const EvaluationDomain<fr>&);
 template void ifft<fr>(fr*, fr*, const EvaluationDomain<fr>&);
 template void ifft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
+template void fft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
+template void ifft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
+template void coset_fft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
 template void ifft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
 template void coset_ifft<fr>(fr*, const EvaluationDomain<fr>&);
 template void coset_ifft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
@@ -84,6 +84,21 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void ifft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain);
 
+/**
+ * @brief Transform several independent polynomials, each of domain.size coefficients, in place
+ * @details Equivalent to calling fft (resp. ifft, coset_fft) on each polynomial, with bit-identical results, but the
+ * butterfly passes over all the polynomials share their parallel loops, and no working memory is used
+ */
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain);
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void ifft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain);
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void coset_fft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain);
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void ifft_with_constant(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr& value);
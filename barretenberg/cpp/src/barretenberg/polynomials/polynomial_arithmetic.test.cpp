@@ -241,6 +241,51 @@ TEST(polynomials, split_polynomial_fft_coset_ifft_consistency)
     }
 }
 
+/**
+ * @brief The batched transforms must agree exactly with transforming each polynomial on its own
+ */
+TEST(polynomials, fft_batch_consistency)
+{
+    constexpr size_t n = 1 << 13;
+    constexpr size_t num_polys = 3;
+    auto domain = evaluation_domain(n);
+    domain.compute_lookup_table();
+
+    std::vector<std::vector<fr>> polys(num_polys, std::vector<fr>(n));
+    for (auto& poly : polys) {
+        for (auto& coeff : poly) {
+            coeff = fr::random_element();
+        }
+    }
+
+    auto batch_fft = polys;
+    auto batch_ifft = polys;
+    auto batch_coset_fft = polys;
+    std::vector<fr*> batch_fft_ptrs;
+    std::vector<fr*> batch_ifft_ptrs;
+    std::vector<fr*> batch_coset_fft_ptrs;
+    for (size_t j = 0; j < num_polys; ++j) {
+        batch_fft_ptrs.push_back(batch_fft[j].data());
+        batch_ifft_ptrs.push_back(batch_ifft[j].data());
+        batch_coset_fft_ptrs.push_back(batch_coset_fft[j].data());
+    }
+    polynomial_arithmetic::fft_batch(batch_fft_ptrs, domain);
+    polynomial_arithmetic::ifft_batch(batch_ifft_ptrs, domain);
+    polynomial_arithmetic::coset_fft_batch(batch_coset_fft_ptrs, domain);
+
+    for (size_t j = 0; j < num_polys; ++j) {
+        auto expected_fft = polys[j];
+        auto expected_ifft = polys[j];
+        auto expected_coset_fft = polys[j];
+        polynomial_arithmetic::fft(expected_fft.data(), domain);
+        polynomial_arithmetic::ifft(expected_ifft.data(), domain);
+        polynomial_arithmetic::coset_fft(expected_coset_fft.data(), domain);
+        EXPECT_EQ(batch_fft[j], expected_fft);
+        EXPECT_EQ(batch_ifft[j], expected_ifft);
+        EXPECT_EQ(batch_coset_fft[j], expected_coset_fft);
+    }
+}
+
 TEST(polynomials, fft_coset_ifft_cross_consistency)
 {
     constexpr size_t n = 2;
@@ -14,6 +14,8 @@
  *
  * The class allows for sharing the underlying array with potential offset adjustments, making it possible
  * to represent shifted arrays where the actual memory-backed range starts from a non-zero index.
+ * The backing memory may also be borrowed read-only (see `copy_on_write_`), e.g. from a sentinel of shared zeroes, so
+ * that polynomials which are never written do not use any memory of their own.
  * It is designed to be wrapped by another class, namely `Polynomial`, and is not intended to be used directly.
  *
  * @tparam T The type of the elements in the array.
@@ -115,4 +117,13 @@ template <typename T> struct SharedShiftedVirtualZeroesArray {
      */
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
     std::shared_ptr<T[]> backing_memory_;
+
+    /**
+     * @brief Whether the backing memory is only borrowed for reading.
+     *
+     * Set for arrays backed by the shared zero sentinel or by the memory of another array (a copy-on-write view).
+     * Such memory must never be written through this array; the owner (i.e. `Polynomial`) gives the array its own
+     * copy of the memory-backed range before the first write.
+     */
+    bool copy_on_write_ = false;
 };
\ No newline at end of file
@@ -467,22 +467,27 @@ template <class Fr, size_t domain_end, size_t domain_start = 0, size_t skip_coun
             }
         } else {
             for (size_t k = domain_end; k != EXTENDED_DOMAIN_END; ++k) {
-                result.value_at(k) = 0;
-                // compute each term v_j / (d_j*(x-x_j)) of the sum
+                // each new evaluation is the dot product of the evaluations with the precomputed Lagrange
+                // coefficients L_j(k) = B(k) / (d_j*(k-x_j))
+                Fr sum = 0;
                 for (size_t j = domain_start; j != domain_end; ++j) {
-                    Fr term = value_at(j);
-                    term *= Data::precomputed_denominator_inverses[LENGTH * k + j];
-                    result.value_at(k) += term;
+                    sum += value_at(j) * Data::extension_coefficients[LENGTH * k + j];
                 }
-                // scale the sum by the value of of B(x)
-                result.value_at(k) *= Data::full_numerator_values[k];
+                result.value_at(k) = sum;
             }
         }
         return result;
     }
 
+    /**
+     * @brief Extend, in place, a univariate of which only the first INITIAL_LENGTH evaluations are set
+     * @details Unlike extend_to, this writes straight into existing storage, which is what the hot loops of sumcheck
+     * and protogalaxy want. The degree-1 case is a running sum; otherwise each new evaluation is a dot product with a
+     * row of the compile-time table BarycentricData::extension_coefficients.
+     */
     template <size_t INITIAL_LENGTH> void self_extend_from()
     {
+        static_assert(INITIAL_LENGTH <= LENGTH);
         if constexpr (INITIAL_LENGTH == 2) {
             const Fr delta = value_at(1) - value_at(0);
             Fr next = value_at(1);
@@ -490,6 +495,15 @@ template <class Fr, size_t domain_end, size_t domain_start = 0, size_t skip_coun
                 next += delta;
                 value_at(idx) = next;
             }
+        } else if constexpr (INITIAL_LENGTH < LENGTH) {
+            using Data = BarycentricData<Fr, INITIAL_LENGTH, LENGTH>;
+            for (size_t k = INITIAL_LENGTH; k < LENGTH; k++) {
+                Fr sum = 0;
+                for (size_t j = 0; j < INITIAL_LENGTH; j++) {
+                    sum += value_at(j) * Data::extension_coefficients[INITIAL_LENGTH * k + j];
+                }
+                value_at(k) = sum;
+            }
         }
     }
 
@@ -176,6 +176,42 @@ template <typename Flavor> class ProtogalaxyTests : public testing::Test {
         }
     }
 
+    /**
+     * @brief Check that the chunked perturbator computation, which never materialises the row evaluations, agrees
+     * with building the perturbator tree from the full Honk evaluations.
+     *
+     */
+    static void test_perturbator_coefficients_from_polynomials()
+    {
+        using RelationSeparator = typename Flavor::RelationSeparator;
+        // Large enough to span several chunks of the perturbator computation
+        const size_t log_size = PGInternal::PERTURBATOR_LOG_CHUNK_SIZE + 2;
+        const size_t size = 1 << log_size;
+        ProverPolynomials full_polynomials;
+        for (auto& poly : full_polynomials.get_all()) {
+            poly = bb::Polynomial<FF>::random(size);
+        }
+
+        auto relation_parameters = bb::RelationParameters<FF>::get_random();
+        RelationSeparator alphas;
+        for (auto& alpha : alphas) {
+            alpha = FF::random_element();
+        }
+        std::vector<FF> betas(log_size);
+        std::vector<FF> deltas(log_size);
+        for (size_t idx = 0; idx < log_size; idx++) {
+            betas[idx] = FF::random_element();
+            deltas[idx] = FF::random_element();
+        }
+
+        PGInternal pg_internal;
+        auto full_honk_evals = pg_internal.compute_row_evaluations(full_polynomials, alphas, relation_parameters);
+        auto expected = PGInternal::construct_perturbator_coefficients(betas, deltas, full_honk_evals);
+        auto perturbator = pg_internal.compute_perturbator_coefficients(
+            full_polynomials, alphas, relation_parameters, betas, deltas);
+        EXPECT_EQ(perturbator, expected);
+    }
+
     /**
      * @brief Create a dummy accumulator and ensure coefficient 0 of the computed perturbator is the same as the
      * accumulator's target sum.
@@ -577,6 +613,11 @@ TYPED_TEST(ProtogalaxyTests, FullHonkEvaluationsValidCircuit)
     TestFixture::test_full_honk_evaluations_valid_circuit();
 }
 
+TYPED_TEST(ProtogalaxyTests, PerturbatorCoefficientsFromPolynomials)
+{
+    TestFixture::test_perturbator_coefficients_from_polynomials();
+}
+
 TYPED_TEST(ProtogalaxyTests, PerturbatorPolynomial)
 {
     TestFixture::test_pertubator_polynomial();
@@ -56,6 +56,9 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
 
     static constexpr size_t NUM_SUBRELATIONS = DeciderPKs::NUM_SUBRELATIONS;
 
+    // Log of the number of rows evaluated and folded together by a single task of the perturbator computation
+    static constexpr size_t PERTURBATOR_LOG_CHUNK_SIZE = 8;
+
     ExecutionTraceUsageTracker trace_usage_tracker;
 
     ProtogalaxyProverInternal(ExecutionTraceUsageTracker trace_usage_tracker = ExecutionTraceUsageTracker{})
@@ -99,6 +102,17 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
         return linearly_independent_contribution;
     }
 
+    /**
+     * @brief Prepend the challenge 1 of the first subrelation to the relation separator challenges.
+     */
+    static std::array<FF, NUM_SUBRELATIONS> get_subrelation_challenges(const RelationSeparator& alphas)
+    {
+        std::array<FF, NUM_SUBRELATIONS> result;
+        result[0] = 1;
+        std::copy(alphas.begin(), alphas.end(), result.begin() + 1);
+        return result;
+    }
+
     /**
      * @brief Compute the values of the aggregated relation evaluations at each row in the execution trace, representing
      * f_i(ω) in the Protogalaxy paper, given the evaluations of all the prover polynomials and \vec{α} (the batching
@@ -122,12 +136,7 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
         const size_t polynomial_size = polynomials.get_polynomial_size();
         std::vector<FF> aggregated_relation_evaluations(polynomial_size);
 
-        const std::array<FF, NUM_SUBRELATIONS> alphas = [&alphas_]() {
-            std::array<FF, NUM_SUBRELATIONS> tmp;
-            tmp[0] = 1;
-            std::copy(alphas_.begin(), alphas_.end(), tmp.begin() + 1);
-            return tmp;
-        }();
+        const std::array<FF, NUM_SUBRELATIONS> alphas = get_subrelation_challenges(alphas_);
 
         // Determine the number of threads over which to distribute the work
         const size_t num_threads = compute_num_threads(polynomial_size);
@@ -198,8 +207,8 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
      * the tree, label the branch connecting the left node n_l to its parent by 1 and for the right node n_r by β_i +
      * δ_i X. The value of the parent node n will be constructed as n = n_l + n_r * (β_i + δ_i X). Recurse over each
      * layer until the root is reached which will correspond to the perturbator polynomial F(X).
-     * TODO(https://github.com/AztecProtocol/barretenberg/issues/745): make computation of perturbator more memory
-     * efficient, operate in-place and use std::resize; add multithreading
+     * @note The prover uses compute_perturbator_coefficients, which never materialises the leaves; this version is kept
+     * as a reference for testing.
      */
     static std::vector<FF> construct_perturbator_coefficients(std::span<const FF> betas,
                                                               std::span<const FF> deltas,
@@ -219,6 +228,83 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
         return construct_coefficients_tree(betas, deltas, first_level_coeffs);
     }
 
+    /**
+     * @brief Compute the perturbator coefficients directly from the prover polynomials, without materialising the full
+     * Honk evaluation of every row.
+     * @details In the tree of construct_perturbator_coefficients, the leaves of an aligned range of 2^k rows only
+     * interact with each other in the first k levels. Each such chunk is therefore evaluated into a small scratch
+     * buffer and immediately folded into a single node of degree k, so that only n/2^k nodes, rather than the n leaves
+     * and the wide first levels of the tree, are held in memory. As in compute_row_evaluations, the linearly dependent
+     * contribution belongs to row 0, whose path to the root only ever multiplies it by 1, so it is added to the
+     * constant coefficient at the end.
+     */
+    std::vector<FF> compute_perturbator_coefficients(const ProverPolynomials& polynomials,
+                                                     const RelationSeparator& alphas_,
+                                                     const RelationParameters<FF>& relation_parameters,
+                                                     std::span<const FF> betas,
+                                                     std::span<const FF> deltas)
+    {
+        PROFILE_THIS_NAME("ProtogalaxyProver_::compute_perturbator_coefficients");
+
+        const size_t log_polynomial_size = betas.size();
+        const size_t polynomial_size = polynomials.get_polynomial_size();
+        ASSERT(polynomial_size == (size_t(1) << log_polynomial_size));
+
+        const std::array<FF, NUM_SUBRELATIONS> alphas = get_subrelation_challenges(alphas_);
+
+        const size_t log_chunk_size = std::min(PERTURBATOR_LOG_CHUNK_SIZE, log_polynomial_size);
+        const size_t chunk_size = size_t(1) << log_chunk_size;
+        const size_t num_chunks = polynomial_size >> log_chunk_size;
+
+        std::vector<std::vector<FF>> chunk_coeffs(num_chunks);
+        std::vector<FF> linearly_dependent_contributions(num_chunks, FF(0));
+
+        parallel_for(num_chunks, [&](size_t chunk_idx) {
+            const size_t start = chunk_idx * chunk_size;
+
+            // Level l of the chunk's subtree has 2^(k-l) nodes of l+1 coefficients each, so two buffers of chunk_size
+            // elements are enough to fold it
+            std::vector<FF> current_level(chunk_size, FF(0));
+            std::vector<FF> next_level(chunk_size);
+
+            for (size_t idx = 0; idx < chunk_size; idx++) {
+                // The contribution is only non-trivial at a given row if the accumulator is active at that row
+                if (trace_usage_tracker.check_is_active(start + idx)) {
+                    const AllValues row = polynomials.get_row(start + idx);
+                    const RelationEvaluations evals =
+                        RelationUtils::accumulate_relation_evaluations(row, relation_parameters, FF(1));
+                    current_level[idx] = process_subrelation_evaluations(
+                        evals, alphas, linearly_dependent_contributions[chunk_idx]);
+                }
+            }
+
+            for (size_t level = 0; level < log_chunk_size; level++) {
+                const size_t num_coeffs = level + 1;
+                const size_t num_parents = chunk_size >> (level + 1);
+                for (size_t parent = 0; parent < num_parents; parent++) {
+                    const size_t left = 2 * parent * num_coeffs;
+                    const size_t right = left + num_coeffs;
+                    const size_t result = parent * (num_coeffs + 1);
+                    for (size_t d = 0; d < num_coeffs; d++) {
+                        next_level[result + d] = current_level[left + d] + current_level[right + d] * betas[level];
+                    }
+                    next_level[result + num_coeffs] = 0;
+                    for (size_t d = 0; d < num_coeffs; d++) {
+                        next_level[result + d + 1] += current_level[right + d] * deltas[level];
+                    }
+                }
+                std::swap(current_level, next_level);
+            }
+
+            current_level.resize(log_chunk_size + 1);
+            chunk_coeffs[chunk_idx] = std::move(current_level);
+        });
+
+        std::vector<FF> perturbator = construct_coefficients_tree(betas, deltas, chunk_coeffs, log_chunk_size);
+        perturbator[0] += sum(linearly_dependent_contributions);
+        return perturbator;
+    }
+
     /**
      * @brief Construct the power perturbator polynomial F(X) in coefficient form from the accumulator
      */
@@ -226,16 +312,16 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
                                        const std::vector<FF>& deltas)
     {
         PROFILE_THIS();
-        auto full_honk_evaluations = compute_row_evaluations(
-            accumulator->proving_key.polynomials, accumulator->alphas, accumulator->relation_parameters);
         const auto betas = accumulator->gate_challenges;
         ASSERT(betas.size() == deltas.size());
         const size_t log_circuit_size = accumulator->proving_key.log_circuit_size;
 
         // Compute the perturbator using only the first log_circuit_size-many betas/deltas
-        std::vector<FF> perturbator = construct_perturbator_coefficients(std::span{ betas.data(), log_circuit_size },
-                                                                         std::span{ deltas.data(), log_circuit_size },
-                                                                         full_honk_evaluations);
+        std::vector<FF> perturbator = compute_perturbator_coefficients(accumulator->proving_key.polynomials,
+                                                                       accumulator->alphas,
+                                                                       accumulator->relation_parameters,
+                                                                       std::span{ betas.data(), log_circuit_size },
+                                                                       std::span{ deltas.data(), log_circuit_size });
 
         // Populate the remaining coefficients with zeros to reach the required constant size
         for (size_t idx = log_circuit_size; idx < CONST_PG_LOG_N; ++idx) {
@@ -249,7 +335,6 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
      * @details For a fixed prover polynomial index, extract that polynomial from each key in DeciderProvingKeys. From
      * each polynomial, extract the value at row_idx. Use these values to create a univariate polynomial, and then
      * extend (i.e., compute additional evaluations at adjacent domain values) as needed.
-     * @todo TODO(https://github.com/AztecProtocol/barretenberg/issues/751) Optimize memory
      */
 
     template <size_t skip_count = 0>
@@ -260,11 +345,17 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
         const size_t row_idx)
     {
         PROFILE_THIS_NAME("PG::extend_univariates");
-        auto incoming_univariates = keys.template row_to_univariates<ExtendedUnivariate::LENGTH, skip_count>(row_idx);
-        for (auto [extended_univariate, incoming_univariate] :
-             zip_view(extended_univariates.get_all(), incoming_univariates)) {
-            incoming_univariate.template self_extend_from<NUM_KEYS>();
-            extended_univariate = std::move(incoming_univariate);
+        // Write the values straight into the caller's (per-thread) univariates and extend them in place, rather than
+        // materialising a fresh set of univariates for every row
+        for (size_t key_idx = 0; const auto& key : keys) {
+            for (auto [extended_univariate, polynomial] :
+                 zip_view(extended_univariates.get_all(), key->proving_key.polynomials.get_all())) {
+                extended_univariate.value_at(key_idx) = polynomial[row_idx];
+            }
+            key_idx++;
+        }
+        for (auto& extended_univariate : extended_univariates.get_all()) {
+            extended_univariate.template self_extend_from<NUM_KEYS>();
         }
     }
 
@@ -233,6 +233,7 @@ template <typename FF_> class DatabusLookupRelationImpl {
         auto& inverse_polynomial = BusData<bus_idx, Polynomials>::inverses(polynomials);
         bool is_read = false;
         bool nonzero_read_count = false;
+        bool has_inverses = false;
         for (size_t i = 0; i < circuit_size; ++i) {
             // Determine if the present row contains a databus operation
             auto q_busread = polynomials.q_busread[i];
@@ -255,11 +256,15 @@ template <typename FF_> class DatabusLookupRelationImpl {
                 auto value = compute_read_term<FF>(row, relation_parameters) *
                              compute_write_term<FF, bus_idx>(row, relation_parameters);
                 inverse_polynomial.at(i) = value;
+                has_inverses = true;
             }
         }
         // Compute inverse polynomial I in place by inverting the product at each row
-        // Note: zeroes are ignored as they are not used anyway
-        FF::batch_invert(inverse_polynomial.coeffs());
+        // Note: zeroes are ignored as they are not used anyway, so a polynomial that was not written (and possibly not
+        // allocated) is left as is
+        if (has_inverses) {
+            FF::batch_invert(inverse_polynomial.coeffs());
+        }
     };
 
     /**
@@ -102,6 +102,48 @@ template <typename FF_> class DeltaRangeConstraintRelationImpl {
         tmp_4 *= scaling_factor;
         std::get<3>(accumulators) += tmp_4;
     };
+
+    /**
+     * @brief Specialised version of accumulate for Univariate accumulators, see HasAccumulationKernel.
+     * @details Computes q_delta_range * scaling_factor once for all four subrelations and squares in place.
+     */
+    template <typename ContainerOverSubrelations, typename AllEntities, typename Parameters>
+    inline static void accumulate_kernel(ContainerOverSubrelations& accumulators,
+                                         const AllEntities& in,
+                                         const Parameters&,
+                                         const FF& scaling_factor)
+    {
+        PROFILE_THIS_NAME("DeltaRange::accumulate_kernel");
+        using Accumulator = std::tuple_element_t<0, ContainerOverSubrelations>;
+        using View = typename Accumulator::View;
+        auto w_1 = View(in.w_l);
+        auto w_2 = View(in.w_r);
+        auto w_3 = View(in.w_o);
+        auto w_4 = View(in.w_4);
+        auto w_1_shift = View(in.w_l_shift);
+
+        static const FF minus_one = FF(-1);
+        static const FF minus_two = FF(-2);
+
+        const Accumulator q_delta_range_scaled = View(in.q_delta_range) * scaling_factor;
+
+        // ((delta - 1)^2 - 1)((delta - 2)^2 - 1) = (delta - 3)(delta - 2)(delta - 1)delta
+        const auto add_range_identity = [&](auto& accumulator, Accumulator delta) {
+            Accumulator shifted = delta + minus_two;
+            shifted.self_sqr();
+            shifted += minus_one;
+            delta += minus_one;
+            delta.self_sqr();
+            delta += minus_one;
+            delta *= shifted;
+            delta *= q_delta_range_scaled;
+            accumulator += delta;
+        };
+        add_range_identity(std::get<0>(accumulators), w_2 - w_1);
+        add_range_identity(std::get<1>(accumulators), w_3 - w_2);
+        add_range_identity(std::get<2>(accumulators), w_4 - w_3);
+        add_range_identity(std::get<3>(accumulators), w_1_shift - w_4);
+    };
 };
 
 template <typename FF> using DeltaRangeConstraintRelation = Relation<DeltaRangeConstraintRelationImpl<FF>>;
@@ -0,0 +1,80 @@
+/**
+ * @file relation_kernel_consistency.test.cpp
+ * @brief Check that the specialised accumulation kernels agree with the generic relation arithmetic.
+ * @details The same random extended edges are fed to a relation's generic accumulate and to its accumulate_kernel, and
+ * the resulting Univariate accumulators are compared. The accumulators start from random values so that the kernels
+ * are also checked to add into, rather than overwrite, their accumulators.
+ */
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/relations/delta_range_constraint_relation.hpp"
+#include "barretenberg/relations/relation_parameters.hpp"
+#include "barretenberg/relations/ultra_arithmetic_relation.hpp"
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+namespace {
+
+using FF = fr;
+
+// Longer than any subrelation so that the truncation to each subrelation length is exercised
+constexpr size_t EDGE_LENGTH = 8;
+using Edge = Univariate<FF, EDGE_LENGTH>;
+
+struct ExtendedEdges {
+    Edge q_c = Edge::get_random();
+    Edge q_l = Edge::get_random();
+    Edge q_r = Edge::get_random();
+    Edge q_o = Edge::get_random();
+    Edge q_4 = Edge::get_random();
+    Edge q_m = Edge::get_random();
+    Edge q_arith = Edge::get_random();
+    Edge q_delta_range = Edge::get_random();
+    Edge w_l = Edge::get_random();
+    Edge w_r = Edge::get_random();
+    Edge w_o = Edge::get_random();
+    Edge w_4 = Edge::get_random();
+    Edge w_l_shift = Edge::get_random();
+    Edge w_4_shift = Edge::get_random();
+};
+
+template <typename Container> Container get_random_accumulators()
+{
+    Container accumulators;
+    std::apply([](auto&... accumulator) { ((accumulator = std::decay_t<decltype(accumulator)>::get_random()), ...); },
+               accumulators);
+    return accumulators;
+}
+
+} // namespace
+
+template <typename RelationImpl> class RelationKernelConsistency : public testing::Test {};
+
+using RelationImpls = testing::Types<UltraArithmeticRelationImpl<FF>, DeltaRangeConstraintRelationImpl<FF>>;
+TYPED_TEST_SUITE(RelationKernelConsistency, RelationImpls);
+
+TYPED_TEST(RelationKernelConsistency, KernelMatchesGenericAccumulation)
+{
+    using RelationImpl = TypeParam;
+    using WrappedRelation = Relation<RelationImpl>;
+    using Accumulators = typename WrappedRelation::SumcheckTupleOfUnivariatesOverSubrelations;
+    static_assert(HasAccumulationKernel<RelationImpl, Accumulators, ExtendedEdges, RelationParameters<FF>>);
+
+    for (size_t trial = 0; trial < 4; trial++) {
+        const ExtendedEdges edges;
+        const auto parameters = RelationParameters<FF>::get_random();
+        const FF scaling_factor = FF::random_element();
+
+        const auto initial = get_random_accumulators<Accumulators>();
+        auto generic = initial;
+        auto kernel = initial;
+        RelationImpl::accumulate(generic, edges, parameters, scaling_factor);
+        RelationImpl::accumulate_kernel(kernel, edges, parameters, scaling_factor);
+        EXPECT_EQ(kernel, generic);
+
+        // Relation::accumulate dispatches to the kernel unless kernels are disabled; either way it must agree
+        auto dispatched = initial;
+        WrappedRelation::accumulate(dispatched, edges, parameters, scaling_factor);
+        EXPECT_EQ(dispatched, generic);
+    }
+}
@@ -151,6 +151,31 @@ concept isSkippable = requires(const AllEntities& input) {
     } -> std::same_as<bool>;
 };
 
+template <typename T> struct IsTupleOfUnskippedUnivariates : std::false_type {};
+template <typename FF, size_t... LENGTHS>
+struct IsTupleOfUnskippedUnivariates<std::tuple<Univariate<FF, LENGTHS, 0, 0>...>> : std::true_type {};
+
+/**
+ * @brief Check whether a relation provides a specialised kernel for accumulating into the given container.
+ *
+ * @details Kernels are hand-specialised versions of accumulate for the sumcheck and protogalaxy prover hot loops. They
+ * share common subexpressions between subrelations and operate in place on Univariates rather than building the
+ * temporaries of the generic View arithmetic, which has to remain valid for every accumulator type. They are only used
+ * for prover-side accumulation into Univariates without optimistic skipping; every other accumulator type (verifier
+ * values, recursive circuit values, protogalaxy univariates with skipping) goes through the generic accumulate. Kernels
+ * can be switched off at build time with DISABLE_RELATION_KERNELS, e.g. to compare proving times against the generic
+ * arithmetic. Only relations for which relations_bench shows a clear gain over the generic accumulate have a kernel.
+ */
+template <typename RelationImpl, typename ContainerOverSubrelations, typename AllEntities, typename Parameters>
+concept HasAccumulationKernel =
+    IsTupleOfUnskippedUnivariates<ContainerOverSubrelations>::value &&
+    requires(ContainerOverSubrelations& accumulators,
+             const AllEntities& in,
+             const Parameters& params,
+             const typename RelationImpl::FF& scaling_factor) {
+        RelationImpl::accumulate_kernel(accumulators, in, params, scaling_factor);
+    };
+
 /**
  * @brief A wrapper for Relations to expose methods used by the Sumcheck prover or verifier to add the
  * contribution of a given relation to the corresponding accumulator.
@@ -198,5 +223,24 @@ template <typename RelationImpl> class Relation : public RelationImpl {
     // compute_foo_numerator/denomintor.
     using UnivariateAccumulator0 = std::tuple_element_t<0, SumcheckTupleOfUnivariatesOverSubrelations>;
     using ValueAccumulator0 = std::tuple_element_t<0, SumcheckArrayOfValuesOverSubrelations>;
+
+    /**
+     * @brief Add the contribution of the relation to the accumulators, using the relation's specialised kernel when
+     * one exists for this accumulator type (see HasAccumulationKernel) and the generic arithmetic otherwise.
+     */
+    template <typename ContainerOverSubrelations, typename AllEntities, typename Parameters>
+    inline static void accumulate(ContainerOverSubrelations& accumulators,
+                                  const AllEntities& in,
+                                  const Parameters& params,
+                                  const FF& scaling_factor)
+    {
+#ifndef DISABLE_RELATION_KERNELS
+        if constexpr (HasAccumulationKernel<RelationImpl, ContainerOverSubrelations, AllEntities, Parameters>) {
+            RelationImpl::accumulate_kernel(accumulators, in, params, scaling_factor);
+            return;
+        }
+#endif
+        RelationImpl::accumulate(accumulators, in, params, scaling_factor);
+    }
 };
 } // namespace bb
@@ -125,6 +125,58 @@ template <typename FF_> class UltraArithmeticRelationImpl {
             std::get<1>(evals) += tmp;
         };
     };
+
+    /**
+     * @brief Specialised version of accumulate for Univariate accumulators, see HasAccumulationKernel.
+     * @details Shares q_arith * scaling_factor and q_arith - 1 between the two subrelations and works in place on full
+     * columns. Each column operation is a run of independent field multiplications, which pipelines far better than
+     * evaluating the whole expression one point at a time.
+     */
+    template <typename ContainerOverSubrelations, typename AllEntities, typename Parameters>
+    inline static void accumulate_kernel(ContainerOverSubrelations& evals,
+                                         const AllEntities& in,
+                                         const Parameters&,
+                                         const FF& scaling_factor)
+    {
+        PROFILE_THIS_NAME("Arithmetic::accumulate_kernel");
+        using Accumulator = std::tuple_element_t<0, ContainerOverSubrelations>;
+        using View = typename Accumulator::View;
+        using ShortAccumulator = std::tuple_element_t<1, ContainerOverSubrelations>;
+        using ShortView = typename ShortAccumulator::View;
+        auto w_l = View(in.w_l);
+        auto w_r = View(in.w_r);
+        auto q_arith = View(in.q_arith);
+
+        static const FF neg_half = FF(-2).invert();
+        static const FF minus_one = FF(-1);
+        static const FF minus_two = FF(-2);
+        static const FF minus_three = FF(-3);
+
+        Accumulator q_arith_scaled = q_arith * scaling_factor;
+        Accumulator q_arith_minus_one = q_arith + minus_one;
+
+        Accumulator tmp = q_arith + minus_three;
+        tmp *= neg_half;
+        tmp *= View(in.q_m);
+        tmp *= w_r;
+        tmp *= w_l;
+        tmp += View(in.q_l) * w_l;
+        tmp += View(in.q_r) * w_r;
+        tmp += View(in.q_o) * View(in.w_o);
+        tmp += View(in.q_4) * View(in.w_4);
+        tmp += View(in.q_c);
+        tmp += q_arith_minus_one * View(in.w_4_shift);
+        tmp *= q_arith_scaled;
+        std::get<0>(evals) += tmp;
+
+        auto q_arith_short = ShortView(in.q_arith);
+        ShortAccumulator tmp_short = ShortView(in.w_l) + ShortView(in.w_4);
+        tmp_short -= ShortView(in.w_l_shift);
+        tmp_short += ShortView(in.q_m);
+        tmp_short *= ShortView(q_arith_scaled);
+        tmp_short *= ShortView(q_arith_minus_one) * (q_arith_short + minus_two);
+        std::get<1>(evals) += tmp_short;
+    };
 };
 
 template <typename FF> using UltraArithmeticRelation = Relation<UltraArithmeticRelationImpl<FF>>;
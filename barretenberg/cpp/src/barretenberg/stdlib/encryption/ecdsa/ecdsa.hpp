@@ -15,16 +15,19 @@ template <typename Builder> struct ecdsa_signature {
 template <typename Builder, typename Curve, typename Fq, typename Fr, typename G1>
 bool_t<Builder> ecdsa_verify_signature(const stdlib::byte_array<Builder>& message,
                                        const G1& public_key,
-                                       const ecdsa_signature<Builder>& sig);
+                                       const ecdsa_signature<Builder>& sig,
+                                       bool use_windowed_batch_mul = false);
 
 template <typename Builder, typename Curve, typename Fq, typename Fr, typename G1>
 bool_t<Builder> ecdsa_verify_signature_noassert(const stdlib::byte_array<Builder>& message,
                                                 const G1& public_key,
-                                                const ecdsa_signature<Builder>& sig);
+                                                const ecdsa_signature<Builder>& sig,
+                                                bool use_windowed_batch_mul = false);
 template <typename Builder, typename Curve, typename Fq, typename Fr, typename G1>
 bool_t<Builder> ecdsa_verify_signature_prehashed_message_noassert(const stdlib::byte_array<Builder>& hashed_message,
                                                                   const G1& public_key,
-                                                                  const ecdsa_signature<Builder>& sig);
+                                                                  const ecdsa_signature<Builder>& sig,
+                                                                  bool use_windowed_batch_mul = false);
 
 template <typename Builder>
 static ecdsa_signature<Builder> ecdsa_from_witness(Builder* ctx, const crypto::ecdsa_signature& input)
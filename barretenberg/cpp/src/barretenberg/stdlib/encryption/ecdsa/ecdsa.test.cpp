@@ -105,6 +105,42 @@ TEST(stdlib_ecdsa, verify_r1_signature)
     EXPECT_EQ(proof_result, true);
 }
 
+// The windowed batch mul accepts the same signatures as the default one
+TEST(stdlib_ecdsa, verify_r1_signature_windowed_batch_mul)
+{
+    std::string message_string = "Instructions unclear, ask again later.";
+
+    ecdsa_key_pair<curveR1::fr, curveR1::g1> account;
+    account.private_key = curveR1::fr::random_element();
+    account.public_key = curveR1::g1::one * account.private_key;
+
+    ecdsa_signature signature =
+        ecdsa_construct_signature<Sha256Hasher, curveR1::fq, curveR1::fr, curveR1::g1>(message_string, account);
+
+    std::array<size_t, 2> num_gates;
+    for (const bool use_windowed_batch_mul : { false, true }) {
+        Builder builder = Builder();
+        curveR1::g1_bigfr_ct public_key = curveR1::g1_bigfr_ct::from_witness(&builder, account.public_key);
+
+        std::vector<uint8_t> rr(signature.r.begin(), signature.r.end());
+        std::vector<uint8_t> ss(signature.s.begin(), signature.s.end());
+        stdlib::ecdsa_signature<Builder> sig{ curveR1::byte_array_ct(&builder, rr),
+                                              curveR1::byte_array_ct(&builder, ss),
+                                              stdlib::uint8<Builder>(&builder, signature.v) };
+        curveR1::byte_array_ct message(&builder, message_string);
+
+        curveR1::bool_ct signature_result =
+            stdlib::ecdsa_verify_signature<Builder, curveR1, curveR1::fq_ct, curveR1::bigfr_ct, curveR1::g1_bigfr_ct>(
+                message, public_key, sig, use_windowed_batch_mul);
+
+        EXPECT_EQ(signature_result.get_value(), true);
+        EXPECT_TRUE(CircuitChecker::check(builder));
+        num_gates[use_windowed_batch_mul ? 1 : 0] = builder.get_estimated_num_finalized_gates();
+    }
+    info("num gates: batch_mul = ", num_gates[0], ", wnaf_batch_mul = ", num_gates[1]);
+    EXPECT_LT(num_gates[1], num_gates[0]);
+}
+
 TEST(stdlib_ecdsa, ecdsa_verify_signature_noassert_succeed)
 {
     Builder builder = Builder();
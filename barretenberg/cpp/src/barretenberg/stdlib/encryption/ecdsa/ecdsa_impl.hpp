@@ -11,6 +11,31 @@ namespace {
 auto& engine = numeric::get_debug_randomness();
 }
 
+/**
+ * @brief Compute u1⋅G + u2⋅public_key for ECDSA verification
+ *
+ * @details With plookup, secp256k1 uses its endomorphism (see secp256k1_ecdsa_mul). For other curves, batch_mul uses
+ * 1-bit rounds with tables of the linear combinations of both points, while wnaf_batch_mul, if use_windowed_batch_mul
+ * is set, uses 4-bit windows with ROM tables of the odd multiples of each point and shares the doublings between the
+ * two points, which takes fewer gates for so few points. The flag changes the circuit, so it must be set consistently
+ * by the prover and the verifier.
+ */
+template <typename Builder, typename Curve, typename Fr, typename G1>
+G1 ecdsa_mul(Builder* ctx, const G1& public_key, const Fr& u1, const Fr& u2, bool use_windowed_batch_mul)
+{
+    // TODO(Cody): Having Plookup should not determine which curve is used.
+    // Use special plookup secp256k1 ECDSA mul if available (this relies on k1 endomorphism, and cannot be used for
+    // other curves)
+    if constexpr (HasPlookup<Builder> && Curve::type == bb::CurveType::SECP256K1) {
+        return G1::secp256k1_ecdsa_mul(public_key, u1, u2);
+    } else if constexpr (HasPlookup<Builder>) {
+        if (use_windowed_batch_mul) {
+            return G1::wnaf_batch_mul({ G1::one(ctx), public_key }, { u1, u2 });
+        }
+    }
+    return G1::batch_mul({ G1::one(ctx), public_key }, { u1, u2 });
+}
+
 /**
  * @brief Verify ECDSA signature. Produces unsatisfiable constraints if signature fails
  *
@@ -22,12 +47,14 @@ auto& engine = numeric::get_debug_randomness();
  * @param message
  * @param public_key
  * @param sig
+ * @param use_windowed_batch_mul see ecdsa_mul
  * @return bool_t<Builder>
  */
 template <typename Builder, typename Curve, typename Fq, typename Fr, typename G1>
 bool_t<Builder> ecdsa_verify_signature(const stdlib::byte_array<Builder>& message,
                                        const G1& public_key,
-                                       const ecdsa_signature<Builder>& sig)
+                                       const ecdsa_signature<Builder>& sig,
+                                       bool use_windowed_batch_mul)
 {
     Builder* ctx = message.get_context() ? message.get_context() : public_key.x.context;
 
@@ -88,15 +115,7 @@ bool_t<Builder> ecdsa_verify_signature(const stdlib::byte_array<Builder>& messag
 
     public_key.validate_on_curve();
 
-    G1 result;
-    // TODO(Cody): Having Plookup should not determine which curve is used.
-    // Use special plookup secp256k1 ECDSA mul if available (this relies on k1 endomorphism, and cannot be used for
-    // other curves)
-    if constexpr (HasPlookup<Builder> && Curve::type == bb::CurveType::SECP256K1) {
-        result = G1::secp256k1_ecdsa_mul(public_key, u1, u2);
-    } else {
-        result = G1::batch_mul({ G1::one(ctx), public_key }, { u1, u2 });
-    }
+    G1 result = ecdsa_mul<Builder, Curve, Fr, G1>(ctx, public_key, u1, u2, use_windowed_batch_mul);
     result.x.self_reduce();
 
     // transfer Fq value x to an Fr element and reduce mod r
@@ -133,12 +152,14 @@ bool_t<Builder> ecdsa_verify_signature(const stdlib::byte_array<Builder>& messag
  * @param hashed_message
  * @param public_key
  * @param sig
+ * @param use_windowed_batch_mul see ecdsa_mul
  * @return bool_t<Builder>
  */
 template <typename Builder, typename Curve, typename Fq, typename Fr, typename G1>
 bool_t<Builder> ecdsa_verify_signature_prehashed_message_noassert(const stdlib::byte_array<Builder>& hashed_message,
                                                                   const G1& public_key,
-                                                                  const ecdsa_signature<Builder>& sig)
+                                                                  const ecdsa_signature<Builder>& sig,
+                                                                  bool use_windowed_batch_mul)
 {
     Builder* ctx = hashed_message.get_context() ? hashed_message.get_context() : public_key.x.context;
 
@@ -164,14 +185,7 @@ bool_t<Builder> ecdsa_verify_signature_prehashed_message_noassert(const stdlib::
 
     public_key.validate_on_curve();
 
-    G1 result;
-    // Use special plookup secp256k1 ECDSA mul if available (this relies on k1 endomorphism, and cannot be used for
-    // other curves)
-    if constexpr (HasPlookup<Builder> && Curve::type == bb::CurveType::SECP256K1) {
-        result = G1::secp256k1_ecdsa_mul(public_key, u1, u2);
-    } else {
-        result = G1::batch_mul({ G1::one(ctx), public_key }, { u1, u2 });
-    }
+    G1 result = ecdsa_mul<Builder, Curve, Fr, G1>(ctx, public_key, u1, u2, use_windowed_batch_mul);
     result.x.self_reduce();
 
     // transfer Fq value x to an Fr element and reduce mod r
@@ -213,18 +227,20 @@ bool_t<Builder> ecdsa_verify_signature_prehashed_message_noassert(const stdlib::
  * @param message
  * @param public_key
  * @param sig
+ * @param use_windowed_batch_mul see ecdsa_mul
  * @return bool_t<Builder>
  */
 template <typename Builder, typename Curve, typename Fq, typename Fr, typename G1>
 bool_t<Builder> ecdsa_verify_signature_noassert(const stdlib::byte_array<Builder>& message,
                                                 const G1& public_key,
-                                                const ecdsa_signature<Builder>& sig)
+                                                const ecdsa_signature<Builder>& sig,
+                                                bool use_windowed_batch_mul)
 {
     stdlib::byte_array<Builder> hashed_message =
         static_cast<stdlib::byte_array<Builder>>(stdlib::sha256<Builder>(message));
 
     return ecdsa_verify_signature_prehashed_message_noassert<Builder, Curve, Fq, Fr, G1>(
-        hashed_message, public_key, sig);
+        hashed_message, public_key, sig, use_windowed_batch_mul);
 }
 
 /**
@@ -1051,6 +1051,7 @@ template <typename Builder> cycle_group<Builder> cycle_group<Builder>::straus_lo
  * @param base_points
  * @param offset_generators
  * @param unconditional_add
+ * @param table_bits the number of scalar bits per Straus round, each point table holds 2^table_bits points
  * @return cycle_group<Builder>::batch_mul_internal_output
  */
 template <typename Builder>
@@ -1058,7 +1059,8 @@ typename cycle_group<Builder>::batch_mul_internal_output cycle_group<Builder>::_
     const std::span<cycle_scalar> scalars,
     const std::span<cycle_group> base_points,
     const std::span<AffineElement const> offset_generators,
-    const bool unconditional_add)
+    const bool unconditional_add,
+    const size_t table_bits)
 {
     ASSERT(scalars.size() == base_points.size());
 
@@ -1080,15 +1082,15 @@ typename cycle_group<Builder>::batch_mul_internal_output cycle_group<Builder>::_
     for (auto& s : scalars) {
         num_bits = std::max(num_bits, s.num_bits());
     }
-    size_t num_rounds = (num_bits + TABLE_BITS - 1) / TABLE_BITS;
+    size_t num_rounds = (num_bits + table_bits - 1) / table_bits;
 
     const size_t num_points = scalars.size();
 
     std::vector<straus_scalar_slice> scalar_slices;
     std::vector<straus_lookup_table> point_tables;
     for (size_t i = 0; i < num_points; ++i) {
-        scalar_slices.emplace_back(straus_scalar_slice(context, scalars[i], TABLE_BITS));
-        point_tables.emplace_back(straus_lookup_table(context, base_points[i], offset_generators[i + 1], TABLE_BITS));
+        scalar_slices.emplace_back(straus_scalar_slice(context, scalars[i], table_bits));
+        point_tables.emplace_back(straus_lookup_table(context, base_points[i], offset_generators[i + 1], table_bits));
     }
 
     Element offset_generator_accumulator = offset_generators[0];
@@ -1114,7 +1116,7 @@ typename cycle_group<Builder>::batch_mul_internal_output cycle_group<Builder>::_
     size_t point_counter = 0;
     for (size_t i = 0; i < num_rounds; ++i) {
         if (i != 0) {
-            for (size_t j = 0; j < TABLE_BITS; ++j) {
+            for (size_t j = 0; j < table_bits; ++j) {
                 // offset_generator_accuulator is a regular Element, so dbl() won't add constraints
                 accumulator = accumulator.dbl();
                 offset_generator_accumulator = offset_generator_accumulator.dbl();
@@ -1336,18 +1338,29 @@ typename cycle_group<Builder>::batch_mul_internal_output cycle_group<Builder>::_
  *        depends on if one or both of _fixed_base_batch_mul_internal, _variable_base_batch_mul_internal are called)
  *       If you're calling this function repeatedly and you KNOW you need >32 offset generators,
  *       it's faster to create a `generator_data` object with the required size and pass it in as a parameter.
+ *
+ * @note For ULTRA Builders, table_bits sets the window size of the Straus algorithm for the variable-base points:
+ *       every point gets a ROM table of 2^table_bits multiples, and all points share the doublings of a round.
+ *       Larger windows trade table construction gates, paid once per point, for fewer rounds and hence fewer ROM
+ *       reads and additions per point, so the best window depends on the number of scalar bits. It must divide
+ *       cycle_scalar::LO_BITS. Changing it changes the circuit.
  * @tparam Builder
  * @param scalars
  * @param base_points
  * @param offset_generator_data
+ * @param table_bits window size for the variable-base points, must be TABLE_BITS for non-ULTRA Builders
  * @return cycle_group<Builder>
  */
 template <typename Builder>
 cycle_group<Builder> cycle_group<Builder>::batch_mul(const std::vector<cycle_group>& base_points,
                                                      const std::vector<cycle_scalar>& scalars,
-                                                     const GeneratorContext context)
+                                                     const GeneratorContext context,
+                                                     const size_t table_bits)
 {
     ASSERT(scalars.size() == base_points.size());
+    // A round must not straddle the lo and hi limbs of the scalars, see straus_scalar_slice
+    ASSERT(IS_ULTRA ? (table_bits > 0 && table_bits <= ULTRA_MAX_TABLE_BITS && cycle_scalar::LO_BITS % table_bits == 0)
+                    : table_bits == TABLE_BITS);
 
     std::vector<cycle_scalar> variable_base_scalars;
     std::vector<cycle_group> variable_base_points;
@@ -1440,7 +1453,8 @@ cycle_group<Builder> cycle_group<Builder>::batch_mul(const std::vector<cycle_gro
             _variable_base_batch_mul_internal(variable_base_scalars,
                                               variable_base_points,
                                               offset_generators_for_variable_base_batch_mul,
-                                              can_unconditional_add);
+                                              can_unconditional_add,
+                                              table_bits);
         offset_accumulator += offset_generator_delta;
         if (has_fixed_points) {
             result = can_unconditional_add ? result.unconditional_add(variable_accumulator)
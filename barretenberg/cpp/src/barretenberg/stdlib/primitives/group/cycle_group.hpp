@@ -45,6 +45,8 @@ template <typename Builder> class cycle_group {
     static constexpr size_t TABLE_BITS = IS_ULTRA ? ULTRA_NUM_TABLE_BITS : STANDARD_NUM_TABLE_BITS;
     static constexpr size_t NUM_BITS = ScalarField::modulus.get_msb() + 1;
     static constexpr size_t NUM_ROUNDS = (NUM_BITS + TABLE_BITS - 1) / TABLE_BITS;
+    // Largest window size of the ROM tables of a variable-base batch_mul (2^ULTRA_MAX_TABLE_BITS points per input)
+    static constexpr size_t ULTRA_MAX_TABLE_BITS = 8;
     inline static constexpr std::string_view OFFSET_GENERATOR_DOMAIN_SEPARATOR = "cycle_group_offset_generator";
 
   private:
@@ -204,17 +206,19 @@ template <typename Builder> class cycle_group {
     cycle_group& operator-=(const cycle_group& other);
     static cycle_group batch_mul(const std::vector<cycle_group>& base_points,
                                  const std::vector<BigScalarField>& scalars,
-                                 GeneratorContext context = {})
+                                 GeneratorContext context = {},
+                                 size_t table_bits = TABLE_BITS)
     {
         std::vector<cycle_scalar> cycle_scalars;
         for (auto scalar : scalars) {
             cycle_scalars.emplace_back(scalar);
         }
-        return batch_mul(base_points, cycle_scalars, context);
+        return batch_mul(base_points, cycle_scalars, context, table_bits);
     }
     static cycle_group batch_mul(const std::vector<cycle_group>& base_points,
                                  const std::vector<cycle_scalar>& scalars,
-                                 GeneratorContext context = {});
+                                 GeneratorContext context = {},
+                                 size_t table_bits = TABLE_BITS);
     cycle_group operator*(const cycle_scalar& scalar) const;
     cycle_group& operator*=(const cycle_scalar& scalar);
     cycle_group operator*(const BigScalarField& scalar) const;
@@ -234,7 +238,8 @@ template <typename Builder> class cycle_group {
     static batch_mul_internal_output _variable_base_batch_mul_internal(std::span<cycle_scalar> scalars,
                                                                        std::span<cycle_group> base_points,
                                                                        std::span<AffineElement const> offset_generators,
-                                                                       bool unconditional_add);
+                                                                       bool unconditional_add,
+                                                                       size_t table_bits);
 
     static batch_mul_internal_output _fixed_base_batch_mul_internal(std::span<cycle_scalar> scalars,
                                                                     std::span<AffineElement> base_points,
@@ -613,6 +613,40 @@ TYPED_TEST(CycleGroupTest, TestBatchMul)
     EXPECT_EQ(check_result, true);
 }
 
+// batch_mul is correct for every supported window size of the Straus tables, including for scalars of fewer bits and
+// points at infinity
+TYPED_TEST(CycleGroupTest, TestBatchMulTableBits)
+{
+    STDLIB_TYPE_ALIASES;
+    const size_t num_muls = 3;
+    for (const size_t table_bits : { 1UL, 2UL, 8UL }) {
+        auto builder = Builder();
+        std::vector<cycle_group_ct> points;
+        std::vector<cycle_scalar_ct> scalars;
+        Element expected = Group::point_at_infinity;
+        for (size_t i = 0; i < num_muls; ++i) {
+            auto element = TestFixture::generators[i];
+            typename Group::subgroup_field scalar = Group::subgroup_field::random_element(&engine);
+            expected += (element * scalar);
+            points.emplace_back(cycle_group_ct::from_witness(&builder, element));
+            scalars.emplace_back(cycle_scalar_ct::from_witness(&builder, scalar));
+        }
+        const uint256_t short_scalar = engine.get_random_uint64() >> 3;
+        expected += (TestFixture::generators[num_muls] * typename Group::subgroup_field(short_scalar));
+        points.emplace_back(cycle_group_ct::from_witness(&builder, TestFixture::generators[num_muls]));
+        scalars.emplace_back(cycle_scalar_ct::from_witness_bitstring(&builder, short_scalar, 61));
+
+        auto point_at_infinity = cycle_group_ct::from_witness(&builder, TestFixture::generators[num_muls + 1]);
+        point_at_infinity.set_point_at_infinity(bool_ct(witness_ct(&builder, true)));
+        points.emplace_back(point_at_infinity);
+        scalars.emplace_back(cycle_scalar_ct::from_witness(&builder, Group::subgroup_field::random_element(&engine)));
+
+        auto result = cycle_group_ct::batch_mul(points, scalars, {}, table_bits);
+        EXPECT_EQ(result.get_value(), AffineElement(expected));
+        EXPECT_TRUE(CircuitChecker::check(builder));
+    }
+}
+
 TYPED_TEST(CycleGroupTest, TestMul)
 {
     STDLIB_TYPE_ALIASES
@@ -182,6 +182,34 @@ class ECCOpQueue {
      */
     void prepend_previous_queue(const ECCOpQueue* previous_ptr) { prepend_previous_queue(*previous_ptr); }
 
+    /**
+     * @brief Append the ops of a circuit that was constructed on a queue of its own (e.g. concurrently with the
+     * accumulation of the previous circuits), as if they had been written to this queue directly
+     * @details Unlike prepend_previous_queue, the size data and commitments of this queue, i.e. the state of the merge
+     * protocol, are kept. The pending accumulator of the subsequent queue is taken over, which is only sound if this
+     * queue has been reset, since the subsequent ops were written starting from a reset accumulator.
+     *
+     * @param subsequent A queue on which no merge proof has been constructed
+     */
+    void append_subsequent_queue(const ECCOpQueue& subsequent)
+    {
+        ASSERT(raw_ops.empty() || raw_ops.back().eq || raw_ops.back().reset);
+        ASSERT(cached_active_msm_count == 0);
+        ASSERT(subsequent.current_ultra_ops_size == 0);
+
+        raw_ops.insert(raw_ops.end(), subsequent.raw_ops.begin(), subsequent.raw_ops.end());
+        for (size_t i = 0; i < 4; i++) {
+            ultra_ops[i].insert(ultra_ops[i].end(), subsequent.ultra_ops[i].begin(), subsequent.ultra_ops[i].end());
+        }
+        accumulator = subsequent.accumulator;
+
+        cached_num_muls += subsequent.cached_num_muls;
+        cached_active_msm_count = subsequent.cached_active_msm_count;
+        num_msm_rows += subsequent.num_msm_rows;
+        num_precompute_table_rows += subsequent.num_precompute_table_rows;
+        num_transcript_rows += subsequent.num_transcript_rows;
+    }
+
     /**
      * @brief Enable using std::swap on queues
      *
@@ -88,4 +88,54 @@ TEST(ECCOpQueueTest, PrependAndSwapTests)
     for (size_t i = 0; i < raw_ops_c.size(); i++) {
         EXPECT_EQ(raw_ops_a[i], raw_ops_c[i]);
     }
-}
\ No newline at end of file
+}
+// Ops written to a queue of their own and then appended give the same queue as ops written to it directly, including
+// the pending accumulator and the merge protocol size data
+TEST(ECCOpQueueTest, AppendSubsequentQueue)
+{
+    using point = g1::affine_element;
+    using scalar = fr;
+
+    auto P1 = point::random_element();
+    auto P2 = point::random_element();
+    auto z = scalar::random_element();
+
+    const auto write_previous_ops = [&](ECCOpQueue& op_queue) {
+        op_queue.add_accumulate(P1);
+        op_queue.mul_accumulate(P2, z);
+        op_queue.eq_and_reset();
+        op_queue.set_size_data();
+    };
+    const auto write_subsequent_ops = [&](ECCOpQueue& op_queue) {
+        op_queue.mul_accumulate(P1, z);
+        op_queue.mul_accumulate(P2, z + z);
+        op_queue.eq_and_reset();
+        op_queue.add_accumulate(P2);
+    };
+
+    ECCOpQueue op_queue_direct;
+    write_previous_ops(op_queue_direct);
+    write_subsequent_ops(op_queue_direct);
+
+    ECCOpQueue op_queue_appended;
+    write_previous_ops(op_queue_appended);
+    ECCOpQueue op_queue_subsequent;
+    write_subsequent_ops(op_queue_subsequent);
+    op_queue_appended.append_subsequent_queue(op_queue_subsequent);
+
+    EXPECT_EQ(op_queue_appended.get_raw_ops(), op_queue_direct.get_raw_ops());
+    EXPECT_EQ(op_queue_appended.get_accumulator(), op_queue_direct.get_accumulator());
+    EXPECT_EQ(op_queue_appended.get_previous_size(), op_queue_direct.get_previous_size());
+    EXPECT_EQ(op_queue_appended.get_current_size(), op_queue_direct.get_current_size());
+    EXPECT_EQ(op_queue_appended.get_num_rows(), op_queue_direct.get_num_rows());
+    const auto ultra_ops_appended = op_queue_appended.get_aggregate_transcript();
+    const auto ultra_ops_direct = op_queue_direct.get_aggregate_transcript();
+    for (size_t i = 0; i < ultra_ops_direct.size(); i++) {
+        EXPECT_TRUE(std::ranges::equal(ultra_ops_appended[i], ultra_ops_direct[i]));
+    }
+
+    // The pending accumulation continues as on the direct queue
+    op_queue_appended.eq_and_reset();
+    op_queue_direct.eq_and_reset();
+    EXPECT_EQ(op_queue_appended.get_raw_ops(), op_queue_direct.get_raw_ops());
+}
@@ -12,7 +12,13 @@ namespace bb::plookup::ecc_generator_tables {
  **/
 template <typename G1> void ecc_generator_table<G1>::init_generator_tables()
 {
-    if (init) {
+    if (init.load(std::memory_order_acquire)) {
+        return;
+    }
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(init_mutex);
+#endif
+    if (init.load(std::memory_order_relaxed)) {
         return;
     }
     element base_point = G1::one;
@@ -70,7 +76,7 @@ template <typename G1> void ecc_generator_table<G1>::init_generator_tables()
         ecc_generator_table<G1>::generator_endo_xyprime_table[i] = std::make_pair<bb::fr, bb::fr>(
             bb::fr(uint256_t(point_table[i].x * beta)), bb::fr(uint256_t(point_table[i].y)));
     }
-    init = true;
+    init.store(true, std::memory_order_release);
 }
 
 // map 0 to 255 into 0 to 510 in steps of two
@@ -5,6 +5,8 @@
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
 #include "barretenberg/ecc/curves/secp256k1/secp256k1.hpp"
 #include <array>
+#include <atomic>
+#include <mutex>
 
 namespace bb::plookup::ecc_generator_tables {
 
@@ -23,7 +25,11 @@ template <typename G1> class ecc_generator_table {
     inline static std::array<std::pair<fr, fr>, 256> generator_yhi_table;
     inline static std::array<std::pair<fr, fr>, 256> generator_xyprime_table;
     inline static std::array<std::pair<fr, fr>, 256> generator_endo_xyprime_table;
-    inline static bool init = false;
+    // Set once the tables above are complete, read without the lock by init_generator_tables
+    inline static std::atomic<bool> init = false;
+#ifndef NO_MULTITHREADING
+    inline static std::mutex init_mutex;
+#endif
 
     static void init_generator_tables();
 
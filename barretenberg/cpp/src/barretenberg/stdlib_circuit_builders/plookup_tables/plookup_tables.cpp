@@ -13,7 +13,9 @@
 #include "barretenberg/stdlib_circuit_builders/plookup_tables/keccak/keccak_output.hpp"
 #include "barretenberg/stdlib_circuit_builders/plookup_tables/keccak/keccak_rho.hpp"
 #include "barretenberg/stdlib_circuit_builders/plookup_tables/keccak/keccak_theta.hpp"
+#include <atomic>
 #include <mutex>
+#include <unordered_map>
 namespace bb::plookup {
 
 using namespace bb;
@@ -22,20 +24,29 @@ namespace {
 // TODO(@zac-williamson) convert these into static const members of a struct
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 std::array<MultiTable, MultiTableId::NUM_MULTI_TABLES> MULTI_TABLES;
+// Set once MULTI_TABLES is complete, read without the lock by get_multitable
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-bool initialised = false;
+std::atomic<bool> initialised = false;
 #ifndef NO_MULTITHREADING
 
 // The multitables initialisation procedure is not thread-safe, so we need to make sure only 1 thread gets to initialize
 // them.
 std::mutex multi_table_mutex;
 #endif
+
+// The basic tables created so far. A table is never modified once it is in the cache, so it can be read by any number
+// of circuits (and threads) at once
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::unordered_map<BasicTableId, std::shared_ptr<const BasicTable>> BASIC_TABLES;
+#ifndef NO_MULTITHREADING
+std::mutex basic_table_mutex;
+#endif
 void init_multi_tables()
 {
 #ifndef NO_MULTITHREADING
     std::unique_lock<std::mutex> lock(multi_table_mutex);
 #endif
-    if (initialised) {
+    if (initialised.load(std::memory_order_relaxed)) {
         return;
     }
     MULTI_TABLES[MultiTableId::SHA256_CH_INPUT] = sha256_tables::get_choose_input_table(MultiTableId::SHA256_CH_INPUT);
@@ -120,7 +131,7 @@ void init_multi_tables()
             keccak_tables::Rho<8, i>::get_rho_output_table(MultiTableId::KECCAK_NORMALIZE_AND_ROTATE);
     });
     MULTI_TABLES[MultiTableId::HONK_DUMMY_MULTI] = dummy_tables::get_honk_dummy_multitable();
-    initialised = true;
+    initialised.store(true, std::memory_order_release);
 }
 } // namespace
 /**
@@ -134,9 +145,8 @@ void init_multi_tables()
  */
 const MultiTable& get_multitable(const MultiTableId id)
 {
-    if (!initialised) {
+    if (!initialised.load(std::memory_order_acquire)) {
         init_multi_tables();
-        initialised = true;
     }
     return MULTI_TABLES[id];
 }
@@ -431,4 +441,19 @@ BasicTable create_basic_table(const BasicTableId id, const size_t index)
     }
     }
 }
+
+std::shared_ptr<const BasicTable> get_basic_table(const BasicTableId id)
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(basic_table_mutex);
+#endif
+    auto& table = BASIC_TABLES[id];
+    if (table == nullptr) {
+        // The index of a table is assigned by the circuit that uses it, see BasicTableUsage
+        auto new_table = std::make_shared<BasicTable>(create_basic_table(id, 0));
+        new_table->initialize_index_map();
+        table = std::move(new_table);
+    }
+    return table;
+}
 } // namespace bb::plookup
@@ -12,4 +12,10 @@ ReadData<bb::fr> get_lookup_accumulators(MultiTableId id,
                                          bool is_2_to_1_lookup = false);
 
 BasicTable create_basic_table(BasicTableId id, size_t index);
+
+/**
+ * @brief Get the basic table with the given id, with its index map initialized. Each table is created once per process
+ * and shared (read-only) by all the circuits that use it
+ */
+std::shared_ptr<const BasicTable> get_basic_table(BasicTableId id);
 } // namespace bb::plookup
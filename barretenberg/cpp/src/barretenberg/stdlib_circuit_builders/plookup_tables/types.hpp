@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <memory>
 #include <vector>
 
 #include "./fixed_base/fixed_base_params.hpp"
@@ -330,7 +331,8 @@ struct LookupHashTable {
 
 /**
  * @brief A basic table from which we can perform lookups (for example, an xor table)
- * @details Also stores the lookup gate data for all lookups performed on this table
+ * @details Basic tables are immutable once created and shared by all circuits, see get_basic_table. The lookups a
+ * circuit performs on a table are stored in a BasicTableUsage.
  *
  * @details You can find initialization example at
  * ../ultra_plonk_composer.cpp#UltraPlonkComposer::initialize_precomputed_table(..)
@@ -372,7 +374,6 @@ struct BasicTable {
     std::vector<bb::fr> column_1;
     std::vector<bb::fr> column_2;
     std::vector<bb::fr> column_3;
-    std::vector<LookupEntry> lookup_gates; // wire data for all lookup gates created for lookups on this table
 
     // Map from a table entry to its index in the table; used for constructing read counts
     LookupHashTable index_map;
@@ -390,6 +391,21 @@ struct BasicTable {
     }
 };
 
+/**
+ * @brief A basic table used by a circuit: the shared table, the index of the table in the circuit (which need not
+ * match basic_table->table_index) and the lookups the circuit performs on it
+ */
+struct BasicTableUsage {
+    std::shared_ptr<const BasicTable> basic_table;
+    size_t table_index;
+    // wire data for all lookup gates created for lookups on this table
+    std::vector<BasicTable::LookupEntry> lookup_gates;
+
+    bool operator==(const BasicTableUsage& other) const = default;
+
+    size_t size() const { return basic_table->size(); }
+};
+
 enum ColumnIdx { C1, C2, C3 };
 
 /**
@@ -6,13 +6,88 @@
  *
  */
 #include "ultra_circuit_builder.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/crypto/poseidon2/poseidon2_params.hpp"
 #include <barretenberg/plonk/proof_system/constants.hpp>
+#include <numeric>
 #include <unordered_map>
 #include <unordered_set>
 
 namespace bb {
 
+namespace {
+/**
+ * @brief Sort the ROM/RAM records or range lists of finalize_circuit(). These are sorted concurrently with a
+ * parallel_for when there are several of them, in which case each individual sort is serial.
+ */
+template <typename Iterator, typename Compare = std::less<>>
+void sort_for_finalization(Iterator begin, Iterator end, Compare compare = {})
+{
+#ifdef NO_PAR_ALGOS
+    std::stable_sort(begin, end, compare);
+#else
+    if (is_in_parallel_for()) {
+        std::stable_sort(begin, end, compare);
+    } else {
+        std::stable_sort(std::execution::par_unseq, begin, end, compare);
+    }
+#endif
+}
+
+/**
+ * @brief Run func(i) for every i < num_items, in parallel if there is more than one item and the builder is not itself
+ * being finalized within a parallel_for
+ */
+template <typename Func> void for_each_finalization_item(const size_t num_items, Func&& func)
+{
+    if (num_items > 1 && !is_in_parallel_for()) {
+        parallel_for(num_items, func);
+        return;
+    }
+    for (size_t i = 0; i < num_items; ++i) {
+        func(i);
+    }
+}
+
+/**
+ * @brief Merge the records appended from position num_presorted_records onwards, which must already be in sorted order
+ * (e.g. the records initializing the cells that were never written), into the sorted order of the earlier records
+ */
+template <typename Record>
+void merge_appended_records(std::vector<uint32_t>& order,
+                            const std::vector<Record>& records,
+                            const size_t num_presorted_records)
+{
+    if (records.size() == num_presorted_records) {
+        return;
+    }
+    std::vector<uint32_t> appended(records.size() - num_presorted_records);
+    std::iota(appended.begin(), appended.end(), static_cast<uint32_t>(num_presorted_records));
+    std::vector<uint32_t> merged;
+    merged.reserve(records.size());
+    std::merge(order.begin(),
+               order.end(),
+               appended.begin(),
+               appended.end(),
+               std::back_inserter(merged),
+               [&records](const uint32_t lhs, const uint32_t rhs) { return records[lhs] < records[rhs]; });
+    order = std::move(merged);
+}
+
+/**
+ * @brief Reorder the records of a memory array into the given sorted order
+ */
+template <typename Record> void permute_records(std::vector<Record>& records, const std::vector<uint32_t>& order)
+{
+    std::vector<Record> sorted_records;
+    sorted_records.reserve(records.size());
+    for (const uint32_t position : order) {
+        sorted_records.emplace_back(records[position]);
+    }
+    records = std::move(sorted_records);
+}
+} // namespace
+
 template <typename Arithmetization>
 void UltraCircuitBuilder_<Arithmetization>::finalize_circuit(const bool ensure_nonzero)
 {
@@ -588,8 +663,8 @@ void UltraCircuitBuilder_<Arithmetization>::create_ecc_add_gate(const ecc_add_ga
     bool previous_elliptic_gate_exists = block.size() > 0;
     bool can_fuse_into_previous_gate = previous_elliptic_gate_exists;
     if (can_fuse_into_previous_gate) {
-        can_fuse_into_previous_gate = can_fuse_into_previous_gate && (block.w_r()[block.size() - 1] == in.x1);
-        can_fuse_into_previous_gate = can_fuse_into_previous_gate && (block.w_o()[block.size() - 1] == in.y1);
+        can_fuse_into_previous_gate = can_fuse_into_previous_gate && (block.w_r().back() == in.x1);
+        can_fuse_into_previous_gate = can_fuse_into_previous_gate && (block.w_o().back() == in.y1);
         can_fuse_into_previous_gate = can_fuse_into_previous_gate && (block.q_3()[block.size() - 1] == 0);
         can_fuse_into_previous_gate = can_fuse_into_previous_gate && (block.q_4()[block.size() - 1] == 0);
         can_fuse_into_previous_gate = can_fuse_into_previous_gate && (block.q_1()[block.size() - 1] == 0);
@@ -598,8 +673,8 @@ void UltraCircuitBuilder_<Arithmetization>::create_ecc_add_gate(const ecc_add_ga
     }
 
     if (can_fuse_into_previous_gate) {
-        block.q_1()[block.size() - 1] = in.sign_coefficient;
-        block.q_elliptic()[block.size() - 1] = 1;
+        block.q_1().set(block.size() - 1, in.sign_coefficient);
+        block.q_elliptic().set(block.size() - 1, 1);
     } else {
         block.populate_wires(this->zero_idx, in.x1, in.y1, this->zero_idx);
         block.q_3().emplace_back(0);
@@ -646,16 +721,16 @@ void UltraCircuitBuilder_<Arithmetization>::create_ecc_dbl_gate(const ecc_dbl_ga
     bool previous_elliptic_gate_exists = block.size() > 0;
     bool can_fuse_into_previous_gate = previous_elliptic_gate_exists;
     if (can_fuse_into_previous_gate) {
-        can_fuse_into_previous_gate = can_fuse_into_previous_gate && (block.w_r()[block.size() - 1] == in.x1);
-        can_fuse_into_previous_gate = can_fuse_into_previous_gate && (block.w_o()[block.size() - 1] == in.y1);
+        can_fuse_into_previous_gate = can_fuse_into_previous_gate && (block.w_r().back() == in.x1);
+        can_fuse_into_previous_gate = can_fuse_into_previous_gate && (block.w_o().back() == in.y1);
         can_fuse_into_previous_gate = can_fuse_into_previous_gate && (block.q_arith()[block.size() - 1] == 0);
         can_fuse_into_previous_gate = can_fuse_into_previous_gate && (block.q_lookup_type()[block.size() - 1] == 0);
         can_fuse_into_previous_gate = can_fuse_into_previous_gate && (block.q_aux()[block.size() - 1] == 0);
     }
 
     if (can_fuse_into_previous_gate) {
-        block.q_elliptic()[block.size() - 1] = 1;
-        block.q_m()[block.size() - 1] = 1;
+        block.q_elliptic().set(block.size() - 1, 1);
+        block.q_m().set(block.size() - 1, 1);
     } else {
         block.populate_wires(this->zero_idx, in.x1, in.y1, this->zero_idx);
         block.q_elliptic().emplace_back(1);
@@ -726,23 +801,26 @@ uint32_t UltraCircuitBuilder_<Arithmetization>::put_constant_variable(const FF&
 }
 
 /**
- * @brief Get the basic table with provided ID from the set of tables for the present circuit; create it if it doesnt
+ * @brief Get the basic table with provided ID from the set of tables for the present circuit; add it if it doesnt
  * yet exist
+ * @details The table itself is shared with all other circuits (see plookup::get_basic_table), the circuit only records
+ * its use of the table
  *
  * @tparam Arithmetization
  * @param id
- * @return plookup::BasicTable&
+ * @return plookup::BasicTableUsage&
  */
 template <typename Arithmetization>
-plookup::BasicTable& UltraCircuitBuilder_<Arithmetization>::get_table(const plookup::BasicTableId id)
+plookup::BasicTableUsage& UltraCircuitBuilder_<Arithmetization>::get_table(const plookup::BasicTableId id)
 {
-    for (plookup::BasicTable& table : lookup_tables) {
-        if (table.id == id) {
+    for (plookup::BasicTableUsage& table : lookup_tables) {
+        if (table.basic_table->id == id) {
             return table;
         }
     }
-    // Table doesn't exist! So try to create it.
-    lookup_tables.emplace_back(plookup::create_basic_table(id, lookup_tables.size()));
+    // Table isn't used yet! So add it.
+    lookup_tables.push_back(
+        { .basic_table = plookup::get_basic_table(id), .table_index = lookup_tables.size(), .lookup_gates = {} });
     return lookup_tables.back();
 }
 
@@ -764,7 +842,11 @@ plookup::ReadData<uint32_t> UltraCircuitBuilder_<Arithmetization>::create_gates_
         // get basic lookup table; construct and add to builder.lookup_tables if not already present
         auto& table = get_table(multi_table.basic_table_ids[i]);
 
-        table.lookup_gates.emplace_back(read_values.lookup_entries[i]); // used for constructing sorted polynomials
+        if (count_only) {
+            ++num_counted_lookup_gates;
+        } else {
+            table.lookup_gates.emplace_back(read_values.lookup_entries[i]); // used for constructing sorted polynomials
+        }
 
         const auto first_idx = (i == 0) ? key_a_index : this->add_variable(read_values[plookup::ColumnIdx::C1][i]);
         const auto second_idx = (i == 0 && (key_b_index.has_value()))
@@ -1004,7 +1086,12 @@ void UltraCircuitBuilder_<Arithmetization>::create_new_range_constraint(const ui
     }
 }
 
-template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::process_range_list(RangeList& list)
+/**
+ * @brief Deduplicate the variables of a range list and return their values in sorted order
+ * @details Only reads the variables of the builder, so this is run for all range lists concurrently
+ */
+template <typename Arithmetization>
+std::vector<uint32_t> UltraCircuitBuilder_<Arithmetization>::sort_range_list(RangeList& list)
 {
     this->assert_valid_variables(list.variable_indices);
 
@@ -1017,7 +1104,7 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
         x = this->real_variable_index[x];
     }
     // remove duplicate witness indices to prevent the sorted list set size being wrong!
-    std::sort(list.variable_indices.begin(), list.variable_indices.end());
+    sort_for_finalization(list.variable_indices.begin(), list.variable_indices.end());
     auto back_iterator = std::unique(list.variable_indices.begin(), list.variable_indices.end());
     list.variable_indices.erase(back_iterator, list.variable_indices.end());
 
@@ -1032,11 +1119,14 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
         sorted_list.emplace_back(shrinked_value);
     }
 
-#ifdef NO_PAR_ALGOS
-    std::sort(sorted_list.begin(), sorted_list.end());
-#else
-    std::sort(std::execution::par_unseq, sorted_list.begin(), sorted_list.end());
-#endif
+    sort_for_finalization(sorted_list.begin(), sorted_list.end());
+    return sorted_list;
+}
+
+template <typename Arithmetization>
+void UltraCircuitBuilder_<Arithmetization>::process_range_list(RangeList& list,
+                                                               const std::vector<uint32_t>& sorted_list)
+{
     // list must be padded to a multipe of 4 and larger than 4 (gate_width)
     constexpr size_t gate_width = NUM_WIRES;
     size_t padding = (gate_width - (list.variable_indices.size() % gate_width)) % gate_width;
@@ -1060,8 +1150,17 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
 
 template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::process_range_lists()
 {
+    // Deduplicating and sorting the lists only reads the variables, so it is done for all lists up front; the gates
+    // are then added list by list in the original order so that the circuit does not depend on the number of threads
+    std::vector<RangeList*> lists;
+    lists.reserve(range_lists.size());
     for (auto& i : range_lists) {
-        process_range_list(i.second);
+        lists.emplace_back(&i.second);
+    }
+    std::vector<std::vector<uint32_t>> sorted_lists(lists.size());
+    for_each_finalization_item(lists.size(), [&](size_t i) { sorted_lists[i] = sort_range_list(*lists[i]); });
+    for (size_t i = 0; i < lists.size(); ++i) {
+        process_range_list(*lists[i], sorted_lists[i]);
     }
 }
 
@@ -2538,13 +2637,40 @@ std::array<uint32_t, 2> UltraCircuitBuilder_<Arithmetization>::read_ROM_array_pa
     return value_witnesses;
 }
 
+/**
+ * @brief Sort the records of a ROM array by index and compute the values of their sorted copies
+ * @details Only reads the variables of the builder, so this is run for all ROM arrays concurrently
+ */
+template <typename Arithmetization>
+typename UltraCircuitBuilder_<Arithmetization>::SortedMemoryRecords UltraCircuitBuilder_<
+    Arithmetization>::sort_ROM_records(const RomTranscript& rom_array) const
+{
+    const auto& records = rom_array.records;
+    SortedMemoryRecords sorted_records;
+    sorted_records.order.resize(records.size());
+    std::iota(sorted_records.order.begin(), sorted_records.order.end(), 0U);
+    sort_for_finalization(
+        sorted_records.order.begin(),
+        sorted_records.order.end(),
+        [&records](const uint32_t lhs, const uint32_t rhs) { return records[lhs] < records[rhs]; });
+    sorted_records.values.reserve(records.size());
+    for (const RomRecord& record : records) {
+        sorted_records.values.push_back({ FF(static_cast<uint64_t>(record.index)),
+                                          this->get_variable(record.value_column1_witness),
+                                          this->get_variable(record.value_column2_witness) });
+    }
+    return sorted_records;
+}
+
 /**
  * @brief Compute additional gates required to validate ROM reads. Called when generating the proving key
  *
  * @param rom_id The id of the ROM table
- * @param gate_offset_from_public_inputs Required to track the gate position of where we're adding extra gates
+ * @param sorted_records The sorted order of the records of the array, from sort_ROM_records
  */
-template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::process_ROM_array(const size_t rom_id)
+template <typename Arithmetization>
+void UltraCircuitBuilder_<Arithmetization>::process_ROM_array(const size_t rom_id,
+                                                              SortedMemoryRecords& sorted_records)
 {
 
     auto& rom_array = rom_arrays[rom_id];
@@ -2554,23 +2680,26 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
     create_tag(sorted_list_tag, read_tag);
 
     // Make sure that every cell has been initialized
+    const size_t num_sorted_records = rom_array.records.size();
     for (size_t i = 0; i < rom_array.state.size(); ++i) {
         if (rom_array.state[i][0] == UNINITIALIZED_MEMORY_RECORD) {
             set_ROM_element_pair(rom_id, static_cast<uint32_t>(i), { this->zero_idx, this->zero_idx });
         }
     }
+    // Uninitialized cells cannot have been read, so their new records are the only ones with their indices
+    for (size_t i = num_sorted_records; i < rom_array.records.size(); ++i) {
+        const RomRecord& record = rom_array.records[i];
+        sorted_records.values.push_back({ FF(static_cast<uint64_t>(record.index)),
+                                          this->get_variable(record.value_column1_witness),
+                                          this->get_variable(record.value_column2_witness) });
+    }
+    merge_appended_records(sorted_records.order, rom_array.records, num_sorted_records);
 
-#ifdef NO_PAR_ALGOS
-    std::sort(rom_array.records.begin(), rom_array.records.end());
-#else
-    std::sort(std::execution::par_unseq, rom_array.records.begin(), rom_array.records.end());
-#endif
-
-    for (const RomRecord& record : rom_array.records) {
+    for (const uint32_t position : sorted_records.order) {
+        const RomRecord& record = rom_array.records[position];
         const auto index = record.index;
-        const auto value1 = this->get_variable(record.value_column1_witness);
-        const auto value2 = this->get_variable(record.value_column2_witness);
-        const auto index_witness = this->add_variable(FF((uint64_t)index));
+        const auto& [index_value, value1, value2] = sorted_records.values[position];
+        const auto index_witness = this->add_variable(index_value);
         const auto value1_witness = this->add_variable(value1);
         const auto value2_witness = this->add_variable(value2);
         RomRecord sorted_record{
@@ -2600,6 +2729,7 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
         memory_read_records.push_back(static_cast<uint32_t>(sorted_record.gate_index));
         memory_read_records.push_back(static_cast<uint32_t>(record.gate_index));
     }
+    permute_records(rom_array.records, sorted_records.order);
     // One of the checks we run on the sorted list, is to validate the difference between
     // the index field across two gates is either 0 or 1.
     // If we add a dummy gate at the end of the sorted list, where we force the first wire to
@@ -2628,13 +2758,40 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
     // because the first cell is explicitly initialized using zero_idx as the index field.
 }
 
+/**
+ * @brief Sort the records of a RAM array by index and timestamp and compute the values of their sorted copies
+ * @details Only reads the variables of the builder, so this is run for all RAM arrays concurrently
+ */
+template <typename Arithmetization>
+typename UltraCircuitBuilder_<Arithmetization>::SortedMemoryRecords UltraCircuitBuilder_<
+    Arithmetization>::sort_RAM_records(const RamTranscript& ram_array) const
+{
+    const auto& records = ram_array.records;
+    SortedMemoryRecords sorted_records;
+    sorted_records.order.resize(records.size());
+    std::iota(sorted_records.order.begin(), sorted_records.order.end(), 0U);
+    sort_for_finalization(
+        sorted_records.order.begin(),
+        sorted_records.order.end(),
+        [&records](const uint32_t lhs, const uint32_t rhs) { return records[lhs] < records[rhs]; });
+    sorted_records.values.reserve(records.size());
+    for (const RamRecord& record : records) {
+        sorted_records.values.push_back({ FF(static_cast<uint64_t>(record.index)),
+                                          FF(static_cast<uint64_t>(record.timestamp)),
+                                          this->get_variable(record.value_witness) });
+    }
+    return sorted_records;
+}
+
 /**
  * @brief Compute additional gates required to validate RAM read/writes. Called when generating the proving key
  *
  * @param ram_id The id of the RAM table
- * @param gate_offset_from_public_inputs Required to track the gate position of where we're adding extra gates
+ * @param sorted_records The sorted order of the records of the array, from sort_RAM_records
  */
-template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::process_RAM_array(const size_t ram_id)
+template <typename Arithmetization>
+void UltraCircuitBuilder_<Arithmetization>::process_RAM_array(const size_t ram_id,
+                                                              SortedMemoryRecords& sorted_records)
 {
     RamTranscript& ram_array = ram_arrays[ram_id];
     const auto access_tag = get_new_tag();      // current_tag + 1;
@@ -2646,28 +2803,33 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
     // TODO: throw some kind of error here? Circuit should initialize all RAM elements to prevent errors.
     // e.g. if a RAM record is uninitialized but the index of that record is a function of public/private inputs,
     // different public iputs will produce different circuit constraints.
+    const size_t num_sorted_records = ram_array.records.size();
     for (size_t i = 0; i < ram_array.state.size(); ++i) {
         if (ram_array.state[i] == UNINITIALIZED_MEMORY_RECORD) {
             init_RAM_element(ram_id, static_cast<uint32_t>(i), this->zero_idx);
         }
     }
-
-#ifdef NO_PAR_ALGOS
-    std::sort(ram_array.records.begin(), ram_array.records.end());
-#else
-    std::sort(std::execution::par_unseq, ram_array.records.begin(), ram_array.records.end());
-#endif
+    // Uninitialized cells cannot have been accessed, so their new records are the only ones with their indices
+    for (size_t i = num_sorted_records; i < ram_array.records.size(); ++i) {
+        const RamRecord& record = ram_array.records[i];
+        sorted_records.values.push_back({ FF(static_cast<uint64_t>(record.index)),
+                                          FF(static_cast<uint64_t>(record.timestamp)),
+                                          this->get_variable(record.value_witness) });
+    }
+    merge_appended_records(sorted_records.order, ram_array.records, num_sorted_records);
+    permute_records(ram_array.records, sorted_records.order);
 
     std::vector<RamRecord> sorted_ram_records;
+    sorted_ram_records.reserve(ram_array.records.size());
 
     // Iterate over all but final RAM record.
     for (size_t i = 0; i < ram_array.records.size(); ++i) {
         const RamRecord& record = ram_array.records[i];
 
         const auto index = record.index;
-        const auto value = this->get_variable(record.value_witness);
-        const auto index_witness = this->add_variable(FF((uint64_t)index));
-        const auto timestamp_witess = this->add_variable(record.timestamp);
+        const auto& [index_value, timestamp_value, value] = sorted_records.values[sorted_records.order[i]];
+        const auto index_witness = this->add_variable(index_value);
+        const auto timestamp_witess = this->add_variable(timestamp_value);
         const auto value_witness = this->add_variable(value);
         RamRecord sorted_record{
             .index_witness = index_witness,
@@ -2766,14 +2928,23 @@ template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::
 
 template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::process_ROM_arrays()
 {
+    // Sorting the records only reads the variables, so it is done for all arrays up front; the gates are then added
+    // array by array in the original order so that the circuit does not depend on the number of threads
+    std::vector<SortedMemoryRecords> sorted_records(rom_arrays.size());
+    for_each_finalization_item(rom_arrays.size(),
+                               [&](size_t i) { sorted_records[i] = sort_ROM_records(rom_arrays[i]); });
     for (size_t i = 0; i < rom_arrays.size(); ++i) {
-        process_ROM_array(i);
+        process_ROM_array(i, sorted_records[i]);
     }
 }
 template <typename Arithmetization> void UltraCircuitBuilder_<Arithmetization>::process_RAM_arrays()
 {
+    // As for ROM arrays, sort all arrays concurrently and then add their gates in order
+    std::vector<SortedMemoryRecords> sorted_records(ram_arrays.size());
+    for_each_finalization_item(ram_arrays.size(),
+                               [&](size_t i) { sorted_records[i] = sort_RAM_records(ram_arrays[i]); });
     for (size_t i = 0; i < ram_arrays.size(); ++i) {
-        process_RAM_array(i);
+        process_RAM_array(i, sorted_records[i]);
     }
 }
 
@@ -2948,7 +3119,8 @@ template <typename Arithmetization> msgpack::sbuffer UltraCircuitBuilder_<Arithm
         info("Table no: ", table.table_index);
         std::vector<std::vector<FF>> tmp_table;
         for (size_t i = 0; i < table.size(); ++i) {
-            tmp_table.push_back({ table.column_1[i], table.column_2[i], table.column_3[i] });
+            tmp_table.push_back(
+                { table.basic_table->column_1[i], table.basic_table->column_2[i], table.basic_table->column_3[i] });
         }
         cir.lookup_tables.push_back(tmp_table);
     }
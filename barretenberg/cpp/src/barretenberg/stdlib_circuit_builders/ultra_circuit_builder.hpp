@@ -189,6 +189,18 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
         }
     };
 
+    /**
+     * @brief The sorted order of the records of a ROM or RAM array, together with the values of the witnesses of their
+     * sorted copies. Computed for all arrays concurrently at finalization, before any of their gates are added.
+     */
+    struct SortedMemoryRecords {
+        // positions in the array's records, ordered by the records' operator<
+        std::vector<uint32_t> order;
+        // for each record (in the order of the array's records), the values of its sorted copy: (index, value 1,
+        // value 2) for ROM and (index, timestamp, value) for RAM
+        std::vector<std::array<FF, 3>> values;
+    };
+
     /**
      * @brief Used to store instructions to create partial_non_native_field_multiplication gates.
      *        We want to cache these (and remove duplicates) as the stdlib code can end up multiplying the same inputs
@@ -301,7 +313,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
     std::map<FF, uint32_t> constant_variable_indices;
 
     // The set of lookup tables used by the circuit, plus the gate data for the lookups from each table
-    std::vector<plookup::BasicTable> lookup_tables;
+    std::vector<plookup::BasicTableUsage> lookup_tables;
 
     std::map<uint64_t, RangeList> range_lists; // DOCTODO: explain this.
 
@@ -331,6 +343,11 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
 
     bool circuit_finalized = false;
 
+    // If true, only the witness is generated and gates are counted (see set_count_only())
+    bool count_only = false;
+    // Number of lookup gates whose data was not stored in lookup_tables since the builder is count only
+    size_t num_counted_lookup_gates = 0;
+
     void process_non_native_field_multiplications();
     UltraCircuitBuilder_(const size_t size_hint = 0)
         : CircuitBuilderBase<FF>(size_hint)
@@ -394,6 +411,8 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
         memory_write_records = other.memory_write_records;
         cached_partial_non_native_field_multiplications = other.cached_partial_non_native_field_multiplications;
         circuit_finalized = other.circuit_finalized;
+        count_only = other.count_only;
+        num_counted_lookup_gates = other.num_counted_lookup_gates;
     };
     UltraCircuitBuilder_& operator=(const UltraCircuitBuilder_& other) = default;
     UltraCircuitBuilder_& operator=(UltraCircuitBuilder_&& other)
@@ -410,6 +429,8 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
         memory_write_records = other.memory_write_records;
         cached_partial_non_native_field_multiplications = other.cached_partial_non_native_field_multiplications;
         circuit_finalized = other.circuit_finalized;
+        count_only = other.count_only;
+        num_counted_lookup_gates = other.num_counted_lookup_gates;
         return *this;
     };
     ~UltraCircuitBuilder_() override = default;
@@ -437,6 +458,29 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
 #endif // NDEBUG
     }
 
+    /**
+     * @brief Only generate the witness and count the gates of the circuit from now on
+     * @details Drops the wires and selectors of all gates but the last one of each block, as well as the data of the
+     * lookup gates, which is all memory wasted when the builder is only used to compute the witness or to count gates
+     * (e.g. for gate counts of ACIR programs or for the sizing of a structured trace). The copy constraints (the
+     * equivalence classes of the variables) are kept since they determine the gates added by the range constraints.
+     * All gate counts, per block and total, and circuit size estimates are exactly those of the full builder, but a
+     * count only builder cannot be used to construct a proving key, nor be checked or hashed.
+     */
+    void set_count_only()
+    {
+        for (auto& block : blocks.get()) {
+            block.set_count_only();
+        }
+        for (auto& table : lookup_tables) {
+            num_counted_lookup_gates += table.lookup_gates.size();
+            std::vector<plookup::BasicTable::LookupEntry>().swap(table.lookup_gates);
+        }
+        count_only = true;
+    }
+
+    bool is_count_only() const { return count_only; }
+
     void finalize_circuit(const bool ensure_nonzero);
 
     void add_gates_to_ensure_all_polys_are_non_zero();
@@ -672,7 +716,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
      */
     size_t get_lookups_size() const
     {
-        size_t lookups_size = 0;
+        size_t lookups_size = num_counted_lookup_gates;
         for (const auto& table : lookup_tables) {
             lookups_size += table.lookup_gates.size();
         }
@@ -750,7 +794,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
                                       bool (*generator)(std::vector<FF>&, std::vector<FF>&, std::vector<FF>&),
                                       std::array<FF, 2> (*get_values_from_key)(const std::array<uint64_t, 2>));
 
-    plookup::BasicTable& get_table(const plookup::BasicTableId id);
+    plookup::BasicTableUsage& get_table(const plookup::BasicTableId id);
     plookup::MultiTable& get_multitable(const plookup::MultiTableId id);
 
     plookup::ReadData<uint32_t> create_gates_from_plookup_accumulators(
@@ -800,7 +844,8 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
     }
 
     RangeList create_range_list(const uint64_t target_range);
-    void process_range_list(RangeList& list);
+    std::vector<uint32_t> sort_range_list(RangeList& list);
+    void process_range_list(RangeList& list, const std::vector<uint32_t>& sorted_list);
     void process_range_lists();
 
     /**
@@ -847,7 +892,8 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
     std::array<uint32_t, 2> read_ROM_array_pair(const size_t rom_id, const uint32_t index_witness);
     void create_ROM_gate(RomRecord& record);
     void create_sorted_ROM_gate(RomRecord& record);
-    void process_ROM_array(const size_t rom_id);
+    SortedMemoryRecords sort_ROM_records(const RomTranscript& rom_array) const;
+    void process_ROM_array(const size_t rom_id, SortedMemoryRecords& sorted_records);
     void process_ROM_arrays();
 
     void create_RAM_gate(RamRecord& record);
@@ -858,7 +904,8 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
     void init_RAM_element(const size_t ram_id, const size_t index_value, const uint32_t value_witness);
     uint32_t read_RAM_array(const size_t ram_id, const uint32_t index_witness);
     void write_RAM_array(const size_t ram_id, const uint32_t index_witness, const uint32_t value_witness);
-    void process_RAM_array(const size_t ram_id);
+    SortedMemoryRecords sort_RAM_records(const RamTranscript& ram_array) const;
+    void process_RAM_array(const size_t ram_id, SortedMemoryRecords& sorted_records);
     void process_RAM_arrays();
 
     void create_poseidon2_external_gate(const poseidon2_external_gate_<FF>& in);
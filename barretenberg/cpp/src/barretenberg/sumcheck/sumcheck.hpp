@@ -5,6 +5,7 @@
 #include "barretenberg/transcript/transcript.hpp"
 #include "barretenberg/ultra_honk/decider_proving_key.hpp"
 #include "sumcheck_round.hpp"
+#include <functional>
 
 namespace bb {
 
@@ -167,6 +168,9 @@ template <typename Flavor> class SumcheckProver {
     * TODO(#224)(Cody): might want to just do C-style multidimensional array? for guaranteed adjacency?
     */
     PartiallyEvaluatedMultivariates partially_evaluated_polynomials;
+    // If set, called once the first round has partially evaluated the full polynomials, which are not read by the
+    // remaining rounds (see ProverMemoryManager)
+    std::function<void()> on_full_polynomials_idle;
     // prover instantiates sumcheck with circuit size and a prover transcript
     SumcheckProver(size_t multivariate_n, const std::shared_ptr<Transcript>& transcript)
         : multivariate_n(multivariate_n)
@@ -213,6 +217,9 @@ template <typename Flavor> class SumcheckProver {
             multivariate_challenge.emplace_back(round_challenge);
             // Prepare sumcheck book-keeping table for the next round
             partially_evaluate(full_polynomials, multivariate_n, round_challenge);
+            if (on_full_polynomials_idle) {
+                on_full_polynomials_idle();
+            }
             // Prepare ZK Sumcheck data for the next round
             if constexpr (Flavor::HasZK) {
                 update_zk_sumcheck_data(zk_sumcheck_data, round_challenge, round_idx);
@@ -87,9 +87,10 @@ template <typename Flavor> class SumcheckProverRound {
      \{0,1\}\times\{0,1\}^{d-1 - i} \f$, accesses the evaluations \f$ P_j\left(u_0,\ldots, u_{i-1}, 0, \vec \ell\right)
      \f$ and \f$ P_j\left(u_0,\ldots, u_{i-1}, 1, \vec \ell\right) \f$ of \f$ N \f$ linear polynomials \f$
      P_j\left(u_0,\ldots, u_{i-1}, X_{i}, \vec \ell \right) \f$ that are already available either from the prover's
-     input in the first round, or from the \ref multivariates table. Using general method
-     \ref bb::Univariate::extend_to "extend_to", the evaluations of these polynomials are extended from the
-     domain \f$ \{0,1\} \f$ to the domain \f$ \{0,\ldots, D\} \f$ required for the computation of the round univariate.
+     input in the first round, or from the \ref multivariates table. Using
+     \ref bb::Univariate::self_extend_from "self_extend_from", the evaluations of these polynomials are extended in
+     place from the domain \f$ \{0,1\} \f$ to the domain \f$ \{0,\ldots, D\} \f$ required for the computation of the
+     round univariate.
      * In the case when witness polynomials are masked (ZK Flavors), this method has to distinguish between witness and
      * non-witness polynomials. The witness univariates obtained from witness multilinears are corrected by a masking
      * quadratic term extended to the same length MAX_PARTIAL_RELATION_LENGTH.
@@ -106,9 +107,12 @@ template <typename Flavor> class SumcheckProverRound {
                       const ProverPolynomialsOrPartiallyEvaluatedMultivariates& multivariates,
                       const size_t edge_idx)
     {
+        // Write the edge straight into the extended univariate and extend it in place, rather than materialising and
+        // copying a temporary univariate for every polynomial on every edge
         for (auto [extended_edge, multivariate] : zip_view(extended_edges.get_all(), multivariates.get_all())) {
-            bb::Univariate<FF, 2> edge({ multivariate[edge_idx], multivariate[edge_idx + 1] });
-            extended_edge = edge.template extend_to<MAX_PARTIAL_RELATION_LENGTH>();
+            extended_edge.value_at(0) = multivariate[edge_idx];
+            extended_edge.value_at(1) = multivariate[edge_idx + 1];
+            extended_edge.template self_extend_from<2>();
         }
     }
 
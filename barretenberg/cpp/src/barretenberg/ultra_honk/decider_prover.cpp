@@ -26,9 +26,13 @@ DeciderProver_<Flavor>::DeciderProver_(const std::shared_ptr<DeciderPK>& proving
  */
 template <IsUltraFlavor Flavor> void DeciderProver_<Flavor>::execute_relation_check_rounds()
 {
+    BB_OP_COUNT_MEMORY_NAME("sumcheck");
     using Sumcheck = SumcheckProver<Flavor>;
     size_t polynomial_size = proving_key->proving_key.circuit_size;
     auto sumcheck = Sumcheck(polynomial_size, transcript);
+    sumcheck.on_full_polynomials_idle = [&]() {
+        memory_manager.on_polynomials_idle(proving_key->proving_key.polynomials);
+    };
     {
 
         PROFILE_THIS_NAME("sumcheck.prove");
@@ -57,6 +61,8 @@ template <IsUltraFlavor Flavor> void DeciderProver_<Flavor>::execute_relation_ch
  */
 template <IsUltraFlavor Flavor> void DeciderProver_<Flavor>::execute_pcs_rounds()
 {
+    BB_OP_COUNT_MEMORY_NAME("pcs");
+    memory_manager.restore(proving_key->proving_key.polynomials);
     if (proving_key->proving_key.commitment_key == nullptr) {
         proving_key->proving_key.commitment_key =
             std::make_shared<CommitmentKey>(proving_key->proving_key.circuit_size);
@@ -83,6 +89,8 @@ template <IsUltraFlavor Flavor> void DeciderProver_<Flavor>::execute_pcs_rounds(
                                                               sumcheck_output.claimed_libra_evaluations);
     }
     vinfo("executed multivariate-to-univarite reduction");
+    // Shplemini has batched the prover polynomials, which are not used for the opening proof
+    memory_manager.on_last_use(proving_key->proving_key.polynomials);
     PCS::compute_opening_proof(proving_key->proving_key.commitment_key, prover_opening_claim, transcript);
     vinfo("computed opening proof");
 }
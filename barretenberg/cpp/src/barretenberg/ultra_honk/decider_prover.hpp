@@ -9,6 +9,7 @@
 #include "barretenberg/sumcheck/zk_sumcheck_data.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 #include "barretenberg/ultra_honk/decider_proving_key.hpp"
+#include "barretenberg/ultra_honk/prover_memory_manager.hpp"
 
 namespace bb {
 
@@ -49,6 +50,9 @@ template <IsUltraFlavor Flavor> class DeciderProver_ {
 
     SumcheckOutput<Flavor> sumcheck_output;
 
+    // Frees or spills the prover polynomials after their last use, see ProverMemoryManager
+    ProverMemoryManager<Flavor> memory_manager;
+
   private:
     HonkProof proof;
 };
@@ -72,11 +72,238 @@ void DeciderProvingKey_<Flavor>::construct_databus_polynomials(Circuit& circuit)
         return_data_read_counts.at(idx) = return_data.get_read_count(idx);        // read counts
         return_data_read_tags.at(idx) = return_data_read_counts[idx] > 0 ? 1 : 0; // has row been read or not
     }
+}
+
+/**
+ * @brief Finalize the circuit, set the (possibly structured) dyadic circuit size and complete the public inputs block
+ * and block offsets of the execution trace
+ */
+template <IsHonkFlavor Flavor>
+void DeciderProvingKey_<Flavor>::finalize_circuit_and_compute_sizes(Circuit& circuit,
+                                                                    const TraceSettings& trace_structure)
+{
+    circuit.finalize_circuit(/* ensure_nonzero = */ true);
+
+    // If using a structured trace, set fixed block sizes, check their validity, and set the dyadic circuit size
+    if (is_structured) {
+        circuit.blocks.set_fixed_block_sizes(trace_structure); // set the fixed sizes for each block
+        circuit.blocks.check_within_fixed_sizes();             // ensure that no block exceeds its fixed size
+        dyadic_circuit_size = compute_structured_dyadic_size(circuit); // set the dyadic size accordingly
+    } else {
+        dyadic_circuit_size = compute_dyadic_size(circuit); // set dyadic size directly from circuit block sizes
+    }
+
+    info("Finalized circuit size: ",
+         circuit.num_gates,
+         "\nLog dyadic circuit size: ",
+         numeric::get_msb(dyadic_circuit_size));
+
+    // Complete the public inputs execution trace block from circuit.public_inputs
+    Trace::populate_public_inputs_block(circuit);
+    circuit.blocks.compute_offsets(is_structured);
+
+    // TODO(https://github.com/AztecProtocol/barretenberg/issues/905): This is adding ops to the op queue but NOT to
+    // the circuit, meaning the ECCVM/Translator will use different ops than the main circuit. This will lead to
+    // failure once https://github.com/AztecProtocol/barretenberg/issues/746 is resolved.
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        circuit.op_queue->append_nonzero_ops();
+    }
+}
+
+/**
+ * @brief Allocate only the memory required by each witness polynomial
+ * @details Polynomials that are entirely zero for many circuits (ecc op wires, databus columns, lookup read
+ * counts/tags and inverses) are backed by shared zeroes and only allocate their memory when first written. This is not
+ * done for polynomials that are shifted, since the shift would keep reading the zeroes after the write.
+ */
+template <IsHonkFlavor Flavor> void DeciderProvingKey_<Flavor>::allocate_witness_polynomials(Circuit& circuit)
+{
+    {
+        PROFILE_THIS_NAME("allocating wires");
+
+        for (auto& wire : proving_key.polynomials.get_wires()) {
+            wire = Polynomial::shiftable(proving_key.circuit_size);
+        }
+    }
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        PROFILE_THIS_NAME("allocating ecc op wires");
+
+        const size_t ecc_op_block_size = circuit.blocks.ecc_op.get_fixed_size(is_structured);
+        const size_t op_wire_offset = Flavor::has_zero_row ? 1 : 0;
+        for (auto& wire : proving_key.polynomials.get_ecc_op_wires()) {
+            wire = Polynomial(
+                ecc_op_block_size, proving_key.circuit_size, op_wire_offset, Polynomial::AllocateOnWrite::FLAG);
+        }
+    }
+    if constexpr (HasDataBus<Flavor>) {
+        for (auto& databus_entity : proving_key.polynomials.get_databus_entities()) {
+            databus_entity = Polynomial(
+                MAX_DATABUS_SIZE, proving_key.circuit_size, /*start_index=*/0, Polynomial::AllocateOnWrite::FLAG);
+        }
+    }
+    const size_t max_tables_size = std::min(static_cast<size_t>(MAX_LOOKUP_TABLES_SIZE), dyadic_circuit_size - 1);
+    const size_t table_offset = dyadic_circuit_size - max_tables_size;
+    {
+        PROFILE_THIS_NAME("allocating lookup read counts and tags");
+        // Allocate the read counts and tags polynomials
+        proving_key.polynomials.lookup_read_counts =
+            Polynomial(max_tables_size, dyadic_circuit_size, table_offset, Polynomial::AllocateOnWrite::FLAG);
+        proving_key.polynomials.lookup_read_tags =
+            Polynomial(max_tables_size, dyadic_circuit_size, table_offset, Polynomial::AllocateOnWrite::FLAG);
+    }
+    {
+        PROFILE_THIS_NAME("allocating lookup and databus inverses");
+        // Allocate the lookup_inverses polynomial
+        const size_t lookup_offset = static_cast<size_t>(circuit.blocks.lookup.trace_offset);
+        // TODO(https://github.com/AztecProtocol/barretenberg/issues/1033): construct tables and counts at top of trace
+        const size_t lookup_inverses_start = std::min(lookup_offset, table_offset);
+        const size_t lookup_inverses_end =
+            std::min(dyadic_circuit_size,
+                     std::max(lookup_offset + circuit.blocks.lookup.get_fixed_size(is_structured),
+                              table_offset + MAX_LOOKUP_TABLES_SIZE));
+        proving_key.polynomials.lookup_inverses = Polynomial(lookup_inverses_end - lookup_inverses_start,
+                                                             dyadic_circuit_size,
+                                                             lookup_inverses_start,
+                                                             Polynomial::AllocateOnWrite::FLAG);
+        if constexpr (HasDataBus<Flavor>) {
+            const size_t q_busread_end =
+                circuit.blocks.busread.trace_offset + circuit.blocks.busread.get_fixed_size(is_structured);
+            // Allocate the databus inverse polynomials
+            const auto allocate_databus_inverses = [&](size_t databus_size) {
+                return Polynomial(std::max(databus_size, q_busread_end),
+                                  dyadic_circuit_size,
+                                  /*start_index=*/0,
+                                  Polynomial::AllocateOnWrite::FLAG);
+            };
+            proving_key.polynomials.calldata_inverses = allocate_databus_inverses(circuit.get_calldata().size());
+            proving_key.polynomials.secondary_calldata_inverses =
+                allocate_databus_inverses(circuit.get_secondary_calldata().size());
+            proving_key.polynomials.return_data_inverses = allocate_databus_inverses(circuit.get_return_data().size());
+        }
+    }
+    {
+        PROFILE_THIS_NAME("constructing z_perm");
+
+        // Allocate the z_perm polynomial
+        vinfo("constructing z_perm...");
+        proving_key.polynomials.z_perm = Polynomial::shiftable(proving_key.circuit_size);
+        vinfo("done constructing z_perm.");
+    }
+}
+
+/**
+ * @brief Allocate only the memory required by each precomputed (selector, permutation, table and lagrange) polynomial
+ */
+template <IsHonkFlavor Flavor> void DeciderProvingKey_<Flavor>::allocate_precomputed_polynomials(Circuit& circuit)
+{
+    {
+        PROFILE_THIS_NAME("allocating gate selectors");
+
+        // Define gate selectors over the block they are isolated to
+        for (auto [selector, block] :
+             zip_view(proving_key.polynomials.get_gate_selectors(), circuit.blocks.get_gate_blocks())) {
+
+            // TODO(https://github.com/AztecProtocol/barretenberg/issues/914): q_arith is currently used
+            // in aux block.
+            if (&block == &circuit.blocks.arithmetic) {
+                size_t arith_size = circuit.blocks.aux.trace_offset - circuit.blocks.arithmetic.trace_offset +
+                                    circuit.blocks.aux.get_fixed_size(is_structured);
+                selector = Polynomial(arith_size, proving_key.circuit_size, circuit.blocks.arithmetic.trace_offset);
+            } else {
+                selector =
+                    Polynomial(block.get_fixed_size(is_structured), proving_key.circuit_size, block.trace_offset);
+            }
+        }
+    }
+    {
+        PROFILE_THIS_NAME("allocating non-gate selectors");
+
+        // Set the other non-gate selector polynomials to full size
+        for (auto& selector : proving_key.polynomials.get_non_gate_selectors()) {
+            selector = Polynomial(proving_key.circuit_size);
+        }
+    }
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        PROFILE_THIS_NAME("allocating ecc op selector");
+
+        const size_t ecc_op_block_size = circuit.blocks.ecc_op.get_fixed_size(is_structured);
+        const size_t op_wire_offset = Flavor::has_zero_row ? 1 : 0;
+        proving_key.polynomials.lagrange_ecc_op = Polynomial(
+            ecc_op_block_size, proving_key.circuit_size, op_wire_offset, Polynomial::AllocateOnWrite::FLAG);
+    }
+    if constexpr (HasDataBus<Flavor>) {
+        // TODO(https://github.com/AztecProtocol/barretenberg/issues/1107): Restricting databus_id to
+        // databus_size leads to failure.
+        // const size_t databus_size = std::max({ calldata.size(), secondary_calldata.size(),
+        // return_data.size() });
+        proving_key.polynomials.databus_id = Polynomial(proving_key.circuit_size, proving_key.circuit_size);
+    }
+    {
+        PROFILE_THIS_NAME("allocating table polynomials");
+
+        const size_t max_tables_size = std::min(static_cast<size_t>(MAX_LOOKUP_TABLES_SIZE), dyadic_circuit_size - 1);
+        const size_t table_offset = dyadic_circuit_size - max_tables_size;
+        ASSERT(dyadic_circuit_size > max_tables_size);
+
+        // Allocate the table polynomials
+        for (auto& poly : proving_key.polynomials.get_tables()) {
+            poly = Polynomial(max_tables_size, dyadic_circuit_size, table_offset);
+        }
+    }
+    {
+        PROFILE_THIS_NAME("allocating sigmas and ids");
+
+        for (auto& sigma : proving_key.polynomials.get_sigmas()) {
+            sigma = Polynomial(proving_key.circuit_size);
+        }
+        for (auto& id : proving_key.polynomials.get_ids()) {
+            id = Polynomial(proving_key.circuit_size);
+        }
+    }
+    {
+        PROFILE_THIS_NAME("allocating lagrange polynomials");
+
+        // First and last lagrange polynomials (in the full circuit size)
+        proving_key.polynomials.lagrange_first = Polynomial(1, dyadic_circuit_size, 0);
+        proving_key.polynomials.lagrange_last = Polynomial(1, dyadic_circuit_size, dyadic_circuit_size - 1);
+    }
+}
+
+/**
+ * @brief Construct the witness data that is not part of the execution trace proper: databus columns, lookup read
+ * counts and tags, public inputs and the data needed for recursion and databus propagation
+ */
+template <IsHonkFlavor Flavor> void DeciderProvingKey_<Flavor>::construct_remaining_witness_data(Circuit& circuit)
+{
+    // If Goblin, construct the databus polynomials
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        PROFILE_THIS_NAME("constructing databus polynomials");
+
+        construct_databus_polynomials(circuit);
+    }
+
+    {
+        PROFILE_THIS_NAME("constructing lookup read counts");
+
+        construct_lookup_read_counts<Flavor>(proving_key.polynomials.lookup_read_counts,
+                                             proving_key.polynomials.lookup_read_tags,
+                                             circuit,
+                                             dyadic_circuit_size);
+    }
+
+    // Construct the public inputs array
+    for (size_t i = 0; i < proving_key.num_public_inputs; ++i) {
+        size_t idx = i + proving_key.pub_inputs_offset;
+        proving_key.public_inputs.emplace_back(proving_key.polynomials.w_r[idx]);
+    }
+
+    // Set the recursive proof indices
+    proving_key.pairing_point_accumulator_public_input_indices =
+        circuit.pairing_point_accumulator_public_input_indices;
+    proving_key.contains_pairing_point_accumulator = circuit.contains_pairing_point_accumulator;
 
-    auto& databus_id = proving_key.polynomials.databus_id;
-    // Compute a simple identity polynomial for use in the databus lookup argument
-    for (size_t i = 0; i < databus_id.size(); ++i) {
-        databus_id.at(i) = i;
+    if constexpr (IsGoblinFlavor<Flavor>) { // Set databus commitment propagation data
+        proving_key.databus_propagation_data = circuit.databus_propagation_data;
     }
 }
 
@@ -36,6 +36,8 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
     bool is_structured;
 
   public:
+    using PrecomputedPolynomials = typename Flavor::template PrecomputedEntities<Polynomial>;
+
     ProvingKey proving_key;
 
     bool is_accumulator = false;
@@ -46,42 +48,17 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
     FF target_sum;
 
     DeciderProvingKey_(Circuit& circuit,
-                       TraceStructure trace_structure = TraceStructure::NONE,
+                       const TraceSettings& trace_structure = TraceStructure::NONE,
                        std::shared_ptr<typename Flavor::CommitmentKey> commitment_key = nullptr)
-        : is_structured(trace_structure != TraceStructure::NONE)
+        : is_structured(trace_structure.is_structured())
     {
         PROFILE_THIS_NAME("DeciderProvingKey(Circuit&)");
         vinfo("Constructing DeciderProvingKey");
         auto start = std::chrono::steady_clock::now();
 
-        circuit.finalize_circuit(/* ensure_nonzero = */ true);
-
-        // If using a structured trace, set fixed block sizes, check their validity, and set the dyadic circuit size
-        if (is_structured) {
-            circuit.blocks.set_fixed_block_sizes(trace_structure); // set the fixed sizes for each block
-            circuit.blocks.check_within_fixed_sizes();             // ensure that no block exceeds its fixed size
-            dyadic_circuit_size = compute_structured_dyadic_size(circuit); // set the dyadic size accordingly
-        } else {
-            dyadic_circuit_size = compute_dyadic_size(circuit); // set dyadic size directly from circuit block sizes
-        }
-
-        info("Finalized circuit size: ",
-             circuit.num_gates,
-             "\nLog dyadic circuit size: ",
-             numeric::get_msb(dyadic_circuit_size));
-
-        // Complete the public inputs execution trace block from circuit.public_inputs
-        Trace::populate_public_inputs_block(circuit);
-        circuit.blocks.compute_offsets(is_structured);
+        finalize_circuit_and_compute_sizes(circuit, trace_structure);
 
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/905): This is adding ops to the op queue but NOT to
-        // the circuit, meaning the ECCVM/Translator will use different ops than the main circuit. This will lead to
-        // failure once https://github.com/AztecProtocol/barretenberg/issues/746 is resolved.
-        if constexpr (IsGoblinFlavor<Flavor>) {
-            circuit.op_queue->append_nonzero_ops();
-        }
         {
-
             PROFILE_THIS_NAME("constructing proving key");
 
             proving_key = ProvingKey(dyadic_circuit_size, circuit.public_inputs.size(), commitment_key);
@@ -89,155 +66,8 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
                 // Allocate full size polynomials
                 proving_key.polynomials = typename Flavor::ProverPolynomials(dyadic_circuit_size);
             } else { // Allocate only a correct amount of memory for each polynomial
-                // Allocate the wires and selectors polynomials
-                {
-                    PROFILE_THIS_NAME("allocating wires");
-
-                    for (auto& wire : proving_key.polynomials.get_wires()) {
-                        wire = Polynomial::shiftable(proving_key.circuit_size);
-                    }
-                }
-                {
-                    PROFILE_THIS_NAME("allocating gate selectors");
-
-                    // Define gate selectors over the block they are isolated to
-                    for (auto [selector, block] :
-                         zip_view(proving_key.polynomials.get_gate_selectors(), circuit.blocks.get_gate_blocks())) {
-
-                        // TODO(https://github.com/AztecProtocol/barretenberg/issues/914): q_arith is currently used
-                        // in aux block.
-                        if (&block == &circuit.blocks.arithmetic) {
-                            size_t arith_size = circuit.blocks.aux.trace_offset -
-                                                circuit.blocks.arithmetic.trace_offset +
-                                                circuit.blocks.aux.get_fixed_size(is_structured);
-                            selector = Polynomial(
-                                arith_size, proving_key.circuit_size, circuit.blocks.arithmetic.trace_offset);
-                        } else {
-                            selector = Polynomial(
-                                block.get_fixed_size(is_structured), proving_key.circuit_size, block.trace_offset);
-                        }
-                    }
-                }
-                {
-                    PROFILE_THIS_NAME("allocating non-gate selectors");
-
-                    // Set the other non-gate selector polynomials to full size
-                    for (auto& selector : proving_key.polynomials.get_non_gate_selectors()) {
-                        selector = Polynomial(proving_key.circuit_size);
-                    }
-                }
-                if constexpr (IsGoblinFlavor<Flavor>) {
-                    PROFILE_THIS_NAME("allocating ecc op wires and selector");
-
-                    // Allocate the ecc op wires and selector
-                    const size_t ecc_op_block_size = circuit.blocks.ecc_op.get_fixed_size(is_structured);
-                    const size_t op_wire_offset = Flavor::has_zero_row ? 1 : 0;
-                    for (auto& wire : proving_key.polynomials.get_ecc_op_wires()) {
-                        wire = Polynomial(ecc_op_block_size, proving_key.circuit_size, op_wire_offset);
-                    }
-                    proving_key.polynomials.lagrange_ecc_op =
-                        Polynomial(ecc_op_block_size, proving_key.circuit_size, op_wire_offset);
-                }
-
-                if constexpr (HasDataBus<Flavor>) {
-                    proving_key.polynomials.calldata = Polynomial(MAX_DATABUS_SIZE, proving_key.circuit_size);
-                    proving_key.polynomials.calldata_read_counts =
-                        Polynomial(MAX_DATABUS_SIZE, proving_key.circuit_size);
-                    proving_key.polynomials.calldata_read_tags = Polynomial(MAX_DATABUS_SIZE, proving_key.circuit_size);
-                    proving_key.polynomials.secondary_calldata = Polynomial(MAX_DATABUS_SIZE, proving_key.circuit_size);
-                    proving_key.polynomials.secondary_calldata_read_counts =
-                        Polynomial(MAX_DATABUS_SIZE, proving_key.circuit_size);
-                    proving_key.polynomials.secondary_calldata_read_tags =
-                        Polynomial(MAX_DATABUS_SIZE, proving_key.circuit_size);
-                    proving_key.polynomials.return_data = Polynomial(MAX_DATABUS_SIZE, proving_key.circuit_size);
-                    proving_key.polynomials.return_data_read_counts =
-                        Polynomial(MAX_DATABUS_SIZE, proving_key.circuit_size);
-                    proving_key.polynomials.return_data_read_tags =
-                        Polynomial(MAX_DATABUS_SIZE, proving_key.circuit_size);
-
-                    // TODO(https://github.com/AztecProtocol/barretenberg/issues/1107): Restricting databus_id to
-                    // databus_size leads to failure.
-                    // const size_t databus_size = std::max({ calldata.size(), secondary_calldata.size(),
-                    // return_data.size() });
-                    proving_key.polynomials.databus_id = Polynomial(proving_key.circuit_size, proving_key.circuit_size);
-                }
-                const size_t max_tables_size =
-                    std::min(static_cast<size_t>(MAX_LOOKUP_TABLES_SIZE), dyadic_circuit_size - 1);
-                size_t table_offset = dyadic_circuit_size - max_tables_size;
-                {
-                    PROFILE_THIS_NAME("allocating table polynomials");
-
-                    ASSERT(dyadic_circuit_size > max_tables_size);
-
-                    // Allocate the table polynomials
-                    if constexpr (IsHonkFlavor<Flavor>) {
-                        for (auto& poly : proving_key.polynomials.get_tables()) {
-                            poly = typename Flavor::Polynomial(max_tables_size, dyadic_circuit_size, table_offset);
-                        }
-                    }
-                }
-                {
-                    PROFILE_THIS_NAME("allocating sigmas and ids");
-
-                    for (auto& sigma : proving_key.polynomials.get_sigmas()) {
-                        sigma = typename Flavor::Polynomial(proving_key.circuit_size);
-                    }
-                    for (auto& id : proving_key.polynomials.get_ids()) {
-                        id = typename Flavor::Polynomial(proving_key.circuit_size);
-                    }
-                }
-                {
-                    ZoneScopedN("allocating lookup read counts and tags");
-                    // Allocate the read counts and tags polynomials
-                    proving_key.polynomials.lookup_read_counts =
-                        typename Flavor::Polynomial(max_tables_size, dyadic_circuit_size, table_offset);
-                    proving_key.polynomials.lookup_read_tags =
-                        typename Flavor::Polynomial(max_tables_size, dyadic_circuit_size, table_offset);
-                }
-                {
-                    ZoneScopedN("allocating lookup and databus inverses");
-                    // Allocate the lookup_inverses polynomial
-                    const size_t lookup_offset = static_cast<size_t>(circuit.blocks.lookup.trace_offset);
-                    // TODO(https://github.com/AztecProtocol/barretenberg/issues/1033): construct tables and counts
-                    // at top of trace
-                    const size_t table_offset =
-                        dyadic_circuit_size -
-                        std::min(dyadic_circuit_size - 1, static_cast<size_t>(MAX_LOOKUP_TABLES_SIZE));
-                    const size_t lookup_inverses_start = std::min(lookup_offset, table_offset);
-                    const size_t lookup_inverses_end =
-                        std::min(dyadic_circuit_size,
-                                 std::max(lookup_offset + circuit.blocks.lookup.get_fixed_size(is_structured),
-                                          table_offset + MAX_LOOKUP_TABLES_SIZE));
-                    proving_key.polynomials.lookup_inverses = Polynomial(
-                        lookup_inverses_end - lookup_inverses_start, dyadic_circuit_size, lookup_inverses_start);
-                    if constexpr (HasDataBus<Flavor>) {
-                        const size_t q_busread_end =
-                            circuit.blocks.busread.trace_offset + circuit.blocks.busread.get_fixed_size(is_structured);
-                        // Allocate the databus inverse polynomials
-                        proving_key.polynomials.calldata_inverses =
-                            Polynomial(std::max(circuit.get_calldata().size(), q_busread_end), dyadic_circuit_size);
-                        proving_key.polynomials.secondary_calldata_inverses = Polynomial(
-                            std::max(circuit.get_secondary_calldata().size(), q_busread_end), dyadic_circuit_size);
-                        proving_key.polynomials.return_data_inverses =
-                            Polynomial(std::max(circuit.get_return_data().size(), q_busread_end), dyadic_circuit_size);
-                    }
-                }
-                {
-                    PROFILE_THIS_NAME("constructing z_perm");
-
-                    // Allocate the z_perm polynomial
-                    vinfo("constructing z_perm...");
-                    proving_key.polynomials.z_perm = Polynomial::shiftable(proving_key.circuit_size);
-                    vinfo("done constructing z_perm.");
-                }
-
-                {
-                    PROFILE_THIS_NAME("allocating lagrange polynomials");
-
-                    // First and last lagrange polynomials (in the full circuit size)
-                    proving_key.polynomials.lagrange_first = Polynomial(1, dyadic_circuit_size, 0);
-                    proving_key.polynomials.lagrange_last = Polynomial(1, dyadic_circuit_size, dyadic_circuit_size - 1);
-                }
+                allocate_witness_polynomials(circuit);
+                allocate_precomputed_polynomials(circuit);
             }
             // We can finally set the shifted polynomials now that all of the to_be_shifted polynomials are
             // defined.
@@ -249,20 +79,18 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
         Trace::populate(circuit, proving_key, is_structured);
         vinfo("done populating trace.");
 
-        {
-            PROFILE_THIS_NAME("constructing prover instance after trace populate");
-
-            // If Goblin, construct the databus polynomials
-            if constexpr (IsGoblinFlavor<Flavor>) {
-                PROFILE_THIS_NAME("constructing databus polynomials");
-
-                construct_databus_polynomials(circuit);
-            }
-        }
         // Set the lagrange polynomials
         proving_key.polynomials.lagrange_first.at(0) = 1;
         proving_key.polynomials.lagrange_last.at(dyadic_circuit_size - 1) = 1;
 
+        if constexpr (HasDataBus<Flavor>) {
+            // Compute a simple identity polynomial for use in the databus lookup argument
+            auto& databus_id = proving_key.polynomials.databus_id;
+            for (size_t i = 0; i < databus_id.size(); ++i) {
+                databus_id.at(i) = i;
+            }
+        }
+
         {
             PROFILE_THIS_NAME("constructing lookup table polynomials");
 
@@ -270,32 +98,71 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
                 proving_key.polynomials.get_tables(), circuit, dyadic_circuit_size);
         }
 
-        {
-            PROFILE_THIS_NAME("constructing lookup read counts");
+        construct_remaining_witness_data(circuit);
 
-            construct_lookup_read_counts<Flavor>(proving_key.polynomials.lookup_read_counts,
-                                                 proving_key.polynomials.lookup_read_tags,
-                                                 circuit,
-                                                 dyadic_circuit_size);
-        }
+        auto end = std::chrono::steady_clock::now();
+        auto diff = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+        vinfo("time to construct proving key: ", diff.count(), " ms.");
+    }
 
-        // Construct the public inputs array
-        for (size_t i = 0; i < proving_key.num_public_inputs; ++i) {
-            size_t idx = i + proving_key.pub_inputs_offset;
-            proving_key.public_inputs.emplace_back(proving_key.polynomials.w_r[idx]);
+    /**
+     * @brief Construct a proving key for a circuit whose structure, and hence verification key, is identical to that of
+     * a previously constructed key, reusing that key's precomputed polynomials.
+     * @details Only the witness polynomials (wires, ecc op wires, databus columns, lookup read counts/tags and the
+     * memory records) are populated. Selectors, sigmas/ids, tables and lagrange polynomials are read-only
+     * (copy-on-write) views of precomputed_polynomials, so neither the copy cycles nor the lookup tables of the circuit
+     * are processed. It is the responsibility of the caller to ensure that the circuit matches the key the polynomials
+     * came from, e.g. by comparing verification keys.
+     *
+     * @param precomputed_polynomials Obtained via share_precomputed_polynomials() from a key for the same circuit
+     */
+    DeciderProvingKey_(Circuit& circuit,
+                       const PrecomputedPolynomials& precomputed_polynomials,
+                       const TraceSettings& trace_structure = TraceStructure::NONE,
+                       std::shared_ptr<typename Flavor::CommitmentKey> commitment_key = nullptr)
+        : is_structured(trace_structure.is_structured())
+    {
+        PROFILE_THIS_NAME("DeciderProvingKey(Circuit&, PrecomputedPolynomials&)");
+        vinfo("Constructing DeciderProvingKey from precomputed polynomials");
+        auto start = std::chrono::steady_clock::now();
+
+        finalize_circuit_and_compute_sizes(circuit, trace_structure);
+        if (precomputed_polynomials.lagrange_last.virtual_size() != dyadic_circuit_size) {
+            throw_or_abort("DeciderProvingKey: precomputed polynomials do not match the dyadic circuit size.");
         }
 
-        // Set the recursive proof indices
-        proving_key.pairing_point_accumulator_public_input_indices =
-            circuit.pairing_point_accumulator_public_input_indices;
-        proving_key.contains_pairing_point_accumulator = circuit.contains_pairing_point_accumulator;
+        {
+            PROFILE_THIS_NAME("constructing proving key");
 
-        if constexpr (IsGoblinFlavor<Flavor>) { // Set databus commitment propagation data
-            proving_key.databus_propagation_data = circuit.databus_propagation_data;
+            proving_key = ProvingKey(dyadic_circuit_size, circuit.public_inputs.size(), commitment_key);
+            if (IsGoblinFlavor<Flavor> && !is_structured) {
+                // Full size witnesses, as in the constructor above, since the databus columns may not fit otherwise
+                for (auto& witness : proving_key.polynomials.get_witness()) {
+                    witness = Polynomial(dyadic_circuit_size, dyadic_circuit_size);
+                }
+                for (auto& wire : proving_key.polynomials.get_wires()) {
+                    wire = Polynomial::shiftable(dyadic_circuit_size);
+                }
+                proving_key.polynomials.z_perm = Polynomial::shiftable(dyadic_circuit_size);
+            } else {
+                allocate_witness_polynomials(circuit);
+            }
+            for (auto [polynomial, precomputed] :
+                 zip_view(proving_key.polynomials.get_precomputed(), precomputed_polynomials.get_all())) {
+                polynomial = precomputed.copy_on_write();
+            }
+            proving_key.polynomials.set_shifted();
         }
+
+        vinfo("populating witness trace...");
+        Trace::populate_witness(circuit, proving_key, is_structured);
+        vinfo("done populating witness trace.");
+
+        construct_remaining_witness_data(circuit);
+
         auto end = std::chrono::steady_clock::now();
         auto diff = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
-        vinfo("time to construct proving key: ", diff.count(), " ms.");
+        vinfo("time to construct proving key from precomputed polynomials: ", diff.count(), " ms.");
     }
 
     DeciderProvingKey_() = default;
@@ -303,6 +170,23 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
 
     bool get_is_structured() { return is_structured; }
 
+    /**
+     * @brief Share the precomputed polynomials of this key, for constructing witness-only keys for later circuits with
+     * the same structure.
+     * @details They are shared as copy-on-write views, so that a write through another key would not reach this one.
+     * @warning The key must not be a folding accumulator, since the polynomials of an accumulator are folded in place.
+     */
+    PrecomputedPolynomials share_precomputed_polynomials() const
+    {
+        ASSERT(!is_accumulator);
+        PrecomputedPolynomials result;
+        const auto& precomputed = static_cast<const PrecomputedPolynomials&>(proving_key.polynomials);
+        for (auto [shared, polynomial] : zip_view(result.get_all(), precomputed.get_all())) {
+            shared = polynomial.copy_on_write();
+        }
+        return result;
+    }
+
   private:
     static constexpr size_t num_zero_rows = Flavor::has_zero_row ? 1 : 0;
     static constexpr size_t NUM_WIRES = Circuit::NUM_WIRES;
@@ -310,6 +194,14 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
 
     size_t compute_dyadic_size(Circuit&);
 
+    void finalize_circuit_and_compute_sizes(Circuit& circuit, const TraceSettings& trace_structure);
+
+    void allocate_witness_polynomials(Circuit& circuit);
+
+    void allocate_precomputed_polynomials(Circuit& circuit);
+
+    void construct_remaining_witness_data(Circuit& circuit);
+
     /**
      * @brief Compute dyadic size based on a structured trace with fixed block size
      *
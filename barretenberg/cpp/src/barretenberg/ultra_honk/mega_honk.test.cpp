@@ -105,6 +105,50 @@ TYPED_TEST(MegaHonkTests, BasicStructured)
     EXPECT_TRUE(verifier.verify_proof(proof));
 }
 
+/**
+ * @brief Test that a proving key constructed from the witness of a circuit and the precomputed polynomials of a key for
+ * an identically structured circuit matches a key constructed from scratch and produces a valid proof
+ *
+ */
+TYPED_TEST(MegaHonkTests, ReusePrecomputedPolynomials)
+{
+    using Flavor = TypeParam;
+    using DeciderProvingKey = DeciderProvingKey_<Flavor>;
+    using Prover = UltraProver_<Flavor>;
+    using Verifier = UltraVerifier_<Flavor>;
+
+    for (TraceStructure trace_structure : { TraceStructure::NONE, TraceStructure::SMALL_TEST }) {
+        // Two circuits with the same structure but different witnesses
+        typename Flavor::CircuitBuilder builder;
+        typename Flavor::CircuitBuilder other_builder;
+        GoblinMockCircuits::construct_simple_circuit(builder);
+        GoblinMockCircuits::construct_simple_circuit(other_builder);
+        auto other_builder_copy = other_builder;
+
+        auto proving_key = std::make_shared<DeciderProvingKey>(builder, trace_structure);
+        auto verification_key = std::make_shared<typename Flavor::VerificationKey>(proving_key->proving_key);
+
+        auto reused_key = std::make_shared<DeciderProvingKey>(
+            other_builder, proving_key->share_precomputed_polynomials(), trace_structure);
+        auto expected_key = std::make_shared<DeciderProvingKey>(other_builder_copy, trace_structure);
+
+        auto& reused_polynomials = reused_key->proving_key.polynomials;
+        auto& expected_polynomials = expected_key->proving_key.polynomials;
+        for (auto [reused, expected] : zip_view(reused_polynomials.get_all(), expected_polynomials.get_all())) {
+            EXPECT_EQ(reused, expected);
+        }
+        EXPECT_EQ(reused_key->proving_key.pub_inputs_offset, expected_key->proving_key.pub_inputs_offset);
+        EXPECT_EQ(reused_key->proving_key.memory_read_records, expected_key->proving_key.memory_read_records);
+        EXPECT_EQ(reused_key->proving_key.memory_write_records, expected_key->proving_key.memory_write_records);
+
+        // The key for the second circuit is valid w.r.t. the verification key of the first
+        Prover prover(reused_key);
+        Verifier verifier(verification_key);
+        auto proof = prover.construct_proof();
+        EXPECT_TRUE(verifier.verify_proof(proof));
+    }
+}
+
 /**
  * @brief Test proof construction/verification for a circuit with ECC op gates, public inputs, and basic arithmetic
  * gates
@@ -13,6 +13,7 @@ namespace bb {
  */
 template <IsUltraFlavor Flavor> void OinkProver<Flavor>::prove()
 {
+    BB_OP_COUNT_MEMORY_NAME("oink");
     if (proving_key->proving_key.commitment_key == nullptr) {
         proving_key->proving_key.commitment_key =
             std::make_shared<CommitmentKey>(proving_key->proving_key.circuit_size);
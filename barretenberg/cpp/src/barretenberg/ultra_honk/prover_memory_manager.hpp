@@ -0,0 +1,197 @@
+#pragma once
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/peak_memory.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief Frees or spills to disk the prover polynomials of an Ultra or Mega decider proving key once the prover is
+ * past their last use
+ *
+ * @details The prover polynomials are used as follows:
+ *  - Oink computes the witness polynomials (wires, sorted list accumulator, log derivative inverses, grand products),
+ *  - the first round of sumcheck reads every polynomial, after which sumcheck only reads its own partially evaluated
+ *    copies,
+ *  - Gemini batches every polynomial, shifted or not, into a single polynomial at the start of the PCS rounds,
+ *    which is their last use.
+ * Between the first round of sumcheck and the PCS rounds the witness polynomials are therefore idle. If the resident
+ * set size exceeds memory_budget at that point, they are written to files and read back right before the PCS rounds.
+ * The files are created with unique names in a directory of the process that only its user can access, itself created
+ * in spill_directory, which must be set along with memory_budget. The precomputed polynomials are never spilled, since
+ * they may be shared with other proving keys, in which case spilling would not free any memory. If
+ * release_after_last_use is set, every prover polynomial is freed once the PCS has batched them, which leaves the
+ * proving key unusable for another proof.
+ *
+ * @tparam Flavor
+ */
+template <typename Flavor> class ProverMemoryManager {
+    using FF = typename Flavor::FF;
+    using Polynomial = typename Flavor::Polynomial;
+    using ProverPolynomials = typename Flavor::ProverPolynomials;
+
+    struct SpilledPolynomial {
+        size_t witness_index;
+        size_t start_index;
+        size_t size;
+        size_t virtual_size;
+        std::string path;
+    };
+
+  public:
+    // Resident set size in bytes above which idle polynomials are spilled to disk, or 0 for no budget
+    size_t memory_budget = 0;
+    // Directory in which the spill files are placed, required if memory_budget is set
+    std::string spill_directory;
+    bool release_after_last_use = false;
+
+    ProverMemoryManager() = default;
+    ProverMemoryManager(const ProverMemoryManager&) = delete;
+    ProverMemoryManager(ProverMemoryManager&&) = delete;
+    ProverMemoryManager& operator=(const ProverMemoryManager&) = delete;
+    ProverMemoryManager& operator=(ProverMemoryManager&&) = delete;
+    ~ProverMemoryManager() { remove_spill_files(); }
+
+    /**
+     * @brief Spill the witness polynomials to disk if over budget, to be called once they are idle
+     * @details The shifts of the spilled witnesses share their memory, so they are cleared as well.
+     */
+    void on_polynomials_idle(ProverPolynomials& polynomials)
+    {
+        if (memory_budget == 0) {
+            return;
+        }
+        if (spill_directory.empty()) {
+            throw_or_abort("ProverMemoryManager: a spill_directory is required along with a memory_budget");
+        }
+        if (get_current_rss_bytes() <= memory_budget) {
+            return;
+        }
+        size_t witness_index = 0;
+        for (auto& witness : polynomials.get_witness()) {
+            // Unwritten polynomials share their zeroes and spilling them would not free anything
+            if (!witness.is_empty() && !witness.is_copy_on_write()) {
+                spill(witness_index, witness);
+            }
+            ++witness_index;
+        }
+        if (spilled_polynomials.empty()) {
+            return;
+        }
+        for (auto& shifted_witness : polynomials.get_shifted_witnesses()) {
+            shifted_witness = Polynomial{};
+        }
+        vinfo("spilled ", spilled_polynomials.size(), " witness polynomials to ", spill_files_directory);
+    }
+
+    /**
+     * @brief Read back the spilled polynomials, to be called before their next use
+     */
+    void restore(ProverPolynomials& polynomials)
+    {
+        if (spilled_polynomials.empty()) {
+            return;
+        }
+        auto witnesses = polynomials.get_witness();
+        for (const SpilledPolynomial& spilled : spilled_polynomials) {
+            Polynomial witness(
+                spilled.size, spilled.virtual_size, spilled.start_index, Polynomial::DontZeroMemory::FLAG);
+            std::ifstream file(spilled.path, std::ios::binary);
+            file.read(reinterpret_cast<char*>(witness.data()),
+                      static_cast<std::streamsize>(spilled.size * sizeof(FF)));
+            if (!file) {
+                throw_or_abort("ProverMemoryManager: could not read back spilled polynomial from " + spilled.path);
+            }
+            witnesses[spilled.witness_index] = std::move(witness);
+        }
+        remove_spill_files();
+        polynomials.set_shifted();
+    }
+
+    /**
+     * @brief Free every prover polynomial if release_after_last_use is set, to be called after their last use
+     */
+    void on_last_use(ProverPolynomials& polynomials) const
+    {
+        if (!release_after_last_use) {
+            return;
+        }
+        for (auto& polynomial : polynomials.get_all()) {
+            polynomial = Polynomial{};
+        }
+    }
+
+    size_t num_spilled_polynomials() const { return spilled_polynomials.size(); }
+
+  private:
+    std::vector<SpilledPolynomial> spilled_polynomials;
+    // Private directory holding the spill files, created on the first spill
+    std::string spill_files_directory;
+
+    void spill(size_t witness_index, Polynomial& witness)
+    {
+        if (spill_files_directory.empty()) {
+            // mkdtemp creates the directory with permissions 0700
+            std::string directory_template =
+                spill_directory + "/bb_prover_polynomials_" + std::to_string(::getpid()) + "_XXXXXX";
+            if (::mkdtemp(directory_template.data()) == nullptr) {
+                throw_or_abort("ProverMemoryManager: could not create a spill directory in " + spill_directory);
+            }
+            spill_files_directory = std::move(directory_template);
+        }
+        // mkstemp creates and opens a file that did not exist, with permissions 0600
+        std::string path = spill_files_directory + "/witness_" + std::to_string(witness_index) + "_XXXXXX";
+        const int fd = ::mkstemp(path.data());
+        if (fd < 0) {
+            throw_or_abort("ProverMemoryManager: could not create a spill file in " + spill_files_directory);
+        }
+        SpilledPolynomial spilled{
+            witness_index, witness.start_index(), witness.size(), witness.virtual_size(), std::move(path)
+        };
+        const bool written = write_all(fd, std::as_const(witness).data(), spilled.size * sizeof(FF));
+        ::close(fd);
+        // Recorded even if the write failed, so that the file is removed
+        spilled_polynomials.emplace_back(std::move(spilled));
+        if (!written) {
+            throw_or_abort("ProverMemoryManager: could not spill polynomial to " + spilled_polynomials.back().path);
+        }
+        witness = Polynomial{};
+    }
+
+    static bool write_all(int fd, const FF* data, size_t num_bytes)
+    {
+        const auto* bytes = reinterpret_cast<const char*>(data);
+        while (num_bytes > 0) {
+            const ssize_t num_written = ::write(fd, bytes, num_bytes);
+            if (num_written <= 0) {
+                return false;
+            }
+            bytes += num_written;
+            num_bytes -= static_cast<size_t>(num_written);
+        }
+        return true;
+    }
+
+    void remove_spill_files()
+    {
+        for (const SpilledPolynomial& spilled : spilled_polynomials) {
+            std::remove(spilled.path.c_str());
+        }
+        spilled_polynomials.clear();
+        if (!spill_files_directory.empty()) {
+            ::rmdir(spill_files_directory.c_str());
+            spill_files_directory.clear();
+        }
+    }
+};
+
+} // namespace bb
@@ -1,3 +1,4 @@
+#include "barretenberg/common/peak_memory.hpp"
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
@@ -9,9 +10,12 @@
 #include "barretenberg/stdlib_circuit_builders/plookup_tables/types.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
 #include "barretenberg/sumcheck/sumcheck_round.hpp"
+#include "barretenberg/ultra_honk/decider_prover.hpp"
+#include "barretenberg/ultra_honk/oink_prover.hpp"
 #include "barretenberg/ultra_honk/ultra_prover.hpp"
 #include "barretenberg/ultra_honk/ultra_verifier.hpp"
 
+#include <filesystem>
 #include <gtest/gtest.h>
 
 using namespace bb;
@@ -109,6 +113,43 @@ TYPED_TEST(UltraHonkTests, StructuredTrace)
     EXPECT_TRUE(verifier.verify_proof(proof));
 }
 
+/**
+ * @brief Test that witness polynomials spilled to disk while idle during sumcheck are read back for the PCS rounds
+ *
+ */
+TYPED_TEST(UltraHonkTests, SpillWitnessPolynomials)
+{
+    if (get_current_rss_bytes() == 0) {
+        GTEST_SKIP() << "memory usage is not available on this platform";
+    }
+    auto builder = UltraCircuitBuilder();
+    MockCircuits::add_arithmetic_gates_with_public_inputs(builder, /*num_gates=*/10);
+    MockCircuits::add_lookup_gates(builder);
+
+    auto proving_key = std::make_shared<typename TestFixture::DeciderProvingKey>(builder);
+    typename TestFixture::Prover prover(proving_key);
+    auto verification_key = std::make_shared<typename TestFixture::VerificationKey>(proving_key->proving_key);
+    typename TestFixture::Verifier verifier(verification_key);
+
+    OinkProver<TypeParam> oink_prover(proving_key, prover.transcript);
+    oink_prover.prove();
+    prover.generate_gate_challenges();
+
+    // Any process is over a budget of a single byte
+    DeciderProver_<TypeParam> decider_prover(proving_key, prover.transcript);
+    decider_prover.memory_manager.memory_budget = 1;
+    decider_prover.memory_manager.spill_directory = std::filesystem::temp_directory_path();
+    decider_prover.execute_relation_check_rounds();
+    EXPECT_GT(decider_prover.memory_manager.num_spilled_polynomials(), 0);
+    EXPECT_TRUE(proving_key->proving_key.polynomials.w_l.is_empty());
+    EXPECT_TRUE(proving_key->proving_key.polynomials.w_l_shift.is_empty());
+
+    decider_prover.execute_pcs_rounds();
+    EXPECT_EQ(decider_prover.memory_manager.num_spilled_polynomials(), 0);
+    EXPECT_EQ(proving_key->proving_key.polynomials.w_l_shift, proving_key->proving_key.polynomials.w_l.shifted());
+    EXPECT_TRUE(verifier.verify_proof(decider_prover.export_proof()));
+}
+
 /**
  * @brief Test simple circuit with public inputs
  *
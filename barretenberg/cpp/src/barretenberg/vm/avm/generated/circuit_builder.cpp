@@ -1,6 +1,9 @@
 // AUTOGENERATED FILE
 #include "barretenberg/vm/avm/generated/circuit_builder.hpp"
 
+#include <atomic>
+#include <limits>
+#include <map>
 #include <mutex>
 #include <set>
 #include <unordered_map>
@@ -16,6 +19,134 @@
 #include "barretenberg/vm/stats.hpp"
 
 namespace bb {
+namespace {
+
+using FF = AvmCircuitBuilder::FF;
+
+/**
+ * @brief Failure bookkeeping shared by all check_circuit tasks.
+ * @details Failures are keyed by (relation index, subrelation index) so that the report does not depend on the order
+ * in which tasks complete. Linearly dependent subrelations only vanish when summed over the whole trace, so their
+ * per-chunk contributions are accumulated here and checked once all tasks are done.
+ */
+struct CheckCircuitState {
+    struct SubrelationFailure {
+        std::string description;
+        size_t first_row = std::numeric_limits<size_t>::max();
+        size_t num_failing_rows = 0;
+    };
+    struct DependentSum {
+        std::string description;
+        FF sum = 0;
+    };
+
+    bool exit_on_first_failure = false;
+    std::atomic<bool> cancelled = false;
+    std::mutex mutex;
+    std::map<std::pair<size_t, size_t>, SubrelationFailure> failures;
+    std::map<std::pair<size_t, size_t>, DependentSum> dependent_sums;
+
+    bool is_cancelled() const { return exit_on_first_failure && cancelled.load(std::memory_order_relaxed); }
+
+    std::string report() const
+    {
+        std::string errors;
+        for (const auto& [key, failure] : failures) {
+            errors += format(failure.description, " failed at row ", failure.first_row);
+            if (failure.num_failing_rows > 1) {
+                errors += format(" (", failure.num_failing_rows, " failing rows)");
+            }
+            errors += "\n";
+        }
+        // After a cancellation the sums are partial and meaningless.
+        if (!cancelled.load()) {
+            for (const auto& [key, dependent_sum] : dependent_sums) {
+                if (!dependent_sum.sum.is_zero()) {
+                    errors += dependent_sum.description + " failed.\n";
+                }
+            }
+        }
+        return errors;
+    }
+};
+
+template <typename Relation> std::string get_subrelation_label(size_t index)
+{
+    if constexpr (requires { Relation::get_subrelation_label(size_t{}); }) {
+        return Relation::get_subrelation_label(index);
+    } else {
+        return std::to_string(index);
+    }
+}
+
+/**
+ * @brief Evaluates a relation independently on every row in [start, end) and records the failures in the state.
+ * @details Rows are not accumulated into each other, so every failing row of a linearly independent subrelation is
+ * localised and not only the first one.
+ */
+template <typename Relation>
+void check_relation_rows(CheckCircuitState& state,
+                         const std::string& kind,
+                         size_t relation_idx,
+                         const AvmCircuitBuilder::ProverPolynomials& polys,
+                         const RelationParameters<FF>& params,
+                         size_t start,
+                         size_t end)
+{
+    using Values = typename Relation::SumcheckArrayOfValuesOverSubrelations;
+    constexpr size_t NUM_SUBRELATIONS = std::tuple_size_v<Values>;
+
+    std::array<size_t, NUM_SUBRELATIONS> first_row{};
+    std::array<size_t, NUM_SUBRELATIONS> num_failing_rows{};
+    Values dependent_sums;
+    for (auto& sum : dependent_sums) {
+        sum = 0;
+    }
+
+    for (size_t r = start; r < end && !state.is_cancelled(); ++r) {
+        Values result;
+        for (auto& value : result) {
+            value = 0;
+        }
+        Relation::accumulate(result, polys.get_row(r), params, 1);
+
+        bool row_failed = false;
+        bb::constexpr_for<0, NUM_SUBRELATIONS, 1>([&]<size_t j>() {
+            if constexpr (subrelation_is_linearly_independent<Relation, j>()) {
+                if (result[j] != 0) {
+                    if (num_failing_rows[j]++ == 0) {
+                        first_row[j] = r;
+                    }
+                    row_failed = true;
+                }
+            } else {
+                dependent_sums[j] += result[j];
+            }
+        });
+        if (row_failed && state.exit_on_first_failure) {
+            state.cancelled.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(state.mutex);
+    bb::constexpr_for<0, NUM_SUBRELATIONS, 1>([&]<size_t j>() {
+        if constexpr (subrelation_is_linearly_independent<Relation, j>()) {
+            if (num_failing_rows[j] > 0) {
+                auto& failure = state.failures[{ relation_idx, j }];
+                failure.description =
+                    format(kind, Relation::NAME, ", subrelation ", get_subrelation_label<Relation>(j));
+                failure.first_row = std::min(failure.first_row, first_row[j]);
+                failure.num_failing_rows += num_failing_rows[j];
+            }
+        } else {
+            auto& dependent_sum = state.dependent_sums[{ relation_idx, j }];
+            dependent_sum.description = format(kind, Relation::NAME);
+            dependent_sum.sum += dependent_sums[j];
+        }
+    });
+}
+
+} // namespace
 
 AvmCircuitBuilder::ProverPolynomials AvmCircuitBuilder::compute_polynomials() const
 {
@@ -833,7 +964,7 @@ AvmCircuitBuilder::ProverPolynomials AvmCircuitBuilder::compute_polynomials() co
     return polys;
 }
 
-bool AvmCircuitBuilder::check_circuit() const
+bool AvmCircuitBuilder::check_circuit(bool exit_on_first_failure) const
 {
     const FF gamma = FF::random_element();
     const FF beta = FF::random_element();
@@ -851,70 +982,49 @@ bool AvmCircuitBuilder::check_circuit() const
     auto polys = compute_polynomials();
     // We'll only check up to the generated trace which might be << than the circuit subgroup size.
     const size_t num_rows = get_estimated_num_finalized_gates();
+    const size_t num_chunks = (num_rows + CHECK_CIRCUIT_ROWS_PER_TASK - 1) / CHECK_CIRCUIT_ROWS_PER_TASK;
+    constexpr size_t NUM_MAIN_RELATIONS = std::tuple_size_v<AvmFlavor::MainRelations>;
+
+    CheckCircuitState state{ .exit_on_first_failure = exit_on_first_failure };
 
-    // Checks that we will run.
-    using SignalErrorFn = const std::function<void(const std::string&)>&;
-    std::vector<std::function<void(SignalErrorFn)>> checks;
+    // Tasks are (relation, row chunk) pairs so that a handful of heavy relations do not bound the wall-time.
+    // Lookups additionally need their inverses before any of their rows can be checked, so they run in two phases.
+    std::vector<std::function<void()>> tasks;
+    std::vector<std::function<void()>> lookup_tasks;
 
     // Add relation checks.
-    bb::constexpr_for<0, std::tuple_size_v<AvmFlavor::MainRelations>, 1>([&]<size_t i>() {
+    bb::constexpr_for<0, NUM_MAIN_RELATIONS, 1>([&]<size_t i>() {
         using Relation = std::tuple_element_t<i, AvmFlavor::MainRelations>;
-        checks.push_back([&](SignalErrorFn signal_error) {
-            typename Relation::SumcheckArrayOfValuesOverSubrelations result;
-            for (auto& r : result) {
-                r = 0;
-            }
-
-            std::array<bool, result.size()> subrelation_failed = { false };
-            for (size_t r = 0; r < num_rows; ++r) {
-                Relation::accumulate(result, polys.get_row(r), {}, 1);
-                for (size_t j = 0; j < result.size(); ++j) {
-                    if (!subrelation_failed[j] && result[j] != 0) {
-                        signal_error(format("Relation ",
-                                            Relation::NAME,
-                                            ", subrelation ",
-                                            Relation::get_subrelation_label(j),
-                                            " failed at row ",
-                                            r));
-                        // We will not check this subrelation for any other rows.
-                        // Since the accumulation will keep being != 0.
-                        subrelation_failed[j] = true;
-                    }
-                }
-            }
-        });
+        for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+            const size_t start = chunk * CHECK_CIRCUIT_ROWS_PER_TASK;
+            const size_t end = std::min(start + CHECK_CIRCUIT_ROWS_PER_TASK, num_rows);
+            tasks.push_back([&, start, end]() {
+                check_relation_rows<Relation>(state, "Relation ", i, polys, RelationParameters<FF>{}, start, end);
+            });
+        }
     });
 
     // Add calculation of logderivatives and lookup/permutation checks.
     bb::constexpr_for<0, std::tuple_size_v<AvmFlavor::LookupRelations>, 1>([&]<size_t i>() {
         using Relation = std::tuple_element_t<i, AvmFlavor::LookupRelations>;
-        checks.push_back([&, num_rows](SignalErrorFn signal_error) {
-            // Check the logderivative relation
-            bb::compute_logderivative_inverse<Flavor, Relation>(polys, params, num_rows);
-
-            typename Relation::SumcheckArrayOfValuesOverSubrelations lookup_result;
-
-            for (auto& r : lookup_result) {
-                r = 0;
-            }
-            for (size_t r = 0; r < num_rows; ++r) {
-                Relation::accumulate(lookup_result, polys.get_row(r), params, 1);
-            }
-            for (auto r : lookup_result) {
-                if (r != 0) {
-                    signal_error(format("Lookup ", Relation::NAME, " failed."));
-                }
+        tasks.push_back([&, num_rows]() {
+            if (!state.is_cancelled()) {
+                bb::compute_logderivative_inverse<Flavor, Relation>(polys, params, num_rows);
             }
         });
+        for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+            const size_t start = chunk * CHECK_CIRCUIT_ROWS_PER_TASK;
+            const size_t end = std::min(start + CHECK_CIRCUIT_ROWS_PER_TASK, num_rows);
+            lookup_tasks.push_back([&, start, end]() {
+                check_relation_rows<Relation>(state, "Lookup ", NUM_MAIN_RELATIONS + i, polys, params, start, end);
+            });
+        }
     });
 
-    std::string errors;
-    std::mutex m;
-    auto signal_error = [&](const std::string& error) {
-        std::lock_guard<std::mutex> lock(m);
-        errors += error + "\n";
-    };
-    bb::parallel_for(checks.size(), [&](size_t i) { checks[i](signal_error); });
+    bb::parallel_for(tasks.size(), [&](size_t i) { tasks[i](); });
+    bb::parallel_for(lookup_tasks.size(), [&](size_t i) { lookup_tasks[i](); });
+
+    const std::string errors = state.report();
     if (!errors.empty()) {
         throw_or_abort(errors);
     }
@@ -922,4 +1032,4 @@ bool AvmCircuitBuilder::check_circuit() const
     return errors.empty();
 }
 
-} // namespace bb
\ No newline at end of file
+} // namespace bb
@@ -12,6 +12,8 @@ class AvmCircuitBuilder {
   public:
     // Do not use this constant directly, use get_circuit_subgroup_size() instead.
     constexpr static size_t CIRCUIT_SUBGROUP_SIZE = 1 << 21;
+    // Number of rows checked by a single check_circuit task.
+    constexpr static size_t CHECK_CIRCUIT_ROWS_PER_TASK = 1 << 13;
 
     using Flavor = bb::AvmFlavor;
     using FF = Flavor::FF;
@@ -33,7 +35,13 @@ class AvmCircuitBuilder {
 
     ProverPolynomials compute_polynomials() const;
 
-    bool check_circuit() const;
+    /**
+     * @brief Checks all relations and lookups on the trace, throwing with the failing rows/subrelations on failure.
+     *
+     * @param exit_on_first_failure Cancel all outstanding work as soon as a failure is found. The report then only
+     * contains the failures found so far.
+     */
+    bool check_circuit(bool exit_on_first_failure = false) const;
 
     size_t get_estimated_num_finalized_gates() const { return num_rows; }
 
@@ -1687,6 +1687,15 @@ TEST_F(AvmArithmeticNegativeTestsFF, addition)
     EXPECT_THROW_WITH_MESSAGE(validate_trace_check_circuit(std::move(trace)), "ALU_ADD_SUB_1");
 }
 
+// Test that an incorrect addition is still caught when the circuit check is cancelled on the first failure.
+TEST_F(AvmArithmeticNegativeTestsFF, additionExitOnFirstFailure)
+{
+    auto trace = gen_mutated_trace_add(FF(37), FF(4), FF(40), AvmMemoryTag::FF);
+    auto circuit_builder = AvmCircuitBuilder();
+    circuit_builder.set_trace(std::move(trace));
+    EXPECT_THROW_WITH_MESSAGE(circuit_builder.check_circuit(/*exit_on_first_failure=*/true), "failed at row");
+}
+
 // Test on basic incorrect subtraction over finite field type.
 TEST_F(AvmArithmeticNegativeTestsFF, subtraction)
 {